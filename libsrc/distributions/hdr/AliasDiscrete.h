@@ -0,0 +1,76 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_ALIAS_DISCRETE_H
+#define __OMBT_ALIAS_DISCRETE_H
+
+// system headers
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+#include <algorithm>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+#include "random/Random.h"
+
+namespace ombt {
+
+// arbitrary discrete distribution - alias method. values are 
+// 0 to k-1 for k masses. O(k) to build, O(1) per value.
+template <class RNG>
+class AliasDiscreteT: public BaseObject
+{
+public:
+    // ctors and dtor
+    AliasDiscreteT();
+    AliasDiscreteT(const std::vector<double> &mass, const RNG &rng);
+    AliasDiscreteT(const AliasDiscreteT &src);
+    ~AliasDiscreteT();
+
+    // assignment
+    AliasDiscreteT &operator=(const AliasDiscreteT &rhs);
+
+    // get a random value
+    double nextValue();
+
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
+    // number of values
+    size_t size() const { return(prob_.size()); }
+
+protected:
+    // data
+    std::vector<double> prob_;
+    std::vector<uint32_t> alias_;
+    std::vector<double> cdf_;
+    RNG rng_;
+};
+
+// default instantiation, engine chosen at run-time
+typedef AliasDiscreteT<Random> AliasDiscrete;
+
+}
+
+#include "distributions/AliasDiscrete.i"
+
+#endif
@@ -0,0 +1,255 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// arbitrary discrete distribution, alias method (walker, vose)
+//
+// p(0), p(1), p(2), ..., p(k-1)
+// the masses are scaled so the average is 1, then the table is
+// built by pairing a column below 1 (small) with one above 1 
+// (large): the small column keeps its own mass as prob(small) and
+// takes the rest from alias(small) = large, whose mass drops by
+// 1-prob(small). this repeats until every column is full.
+// to get a value, choose column I uniformly from 0 to k-1 and U in
+// (0,1), then return X=I if U < prob(I), else X=alias(I).
+// 
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+AliasDiscreteT<RNG>::AliasDiscreteT(): 
+    BaseObject(false), prob_(), alias_(), cdf_(), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+AliasDiscreteT<RNG>::AliasDiscreteT(
+    const std::vector<double> &mass, const RNG &rng): 
+        BaseObject(false), prob_(), alias_(), cdf_(), rng_(rng)
+{
+    size_t k = mass.size();
+    double sum = 0.0;
+    for (size_t i=0; i<k; ++i)
+    {
+        if (mass[i] < 0.0)
+        {
+            setOk(false);
+            return;
+        }
+        sum += mass[i];
+    }
+    if (k == 0 || sum <= 0.0 || k > size_t(uint32_t(-1)))
+    {
+        setOk(false);
+        return;
+    }
+
+    prob_.resize(k);
+    alias_.resize(k);
+    cdf_.resize(k);
+
+    // cumulative mass, for cdf() and quantile()
+    double cum = 0.0;
+    for (size_t i=0; i<k; ++i)
+    {
+        cum += mass[i];
+        cdf_[i] = cum/sum;
+    }
+    cdf_[k-1] = 1.0;
+
+    std::vector<double> scaled(k);
+    std::vector<uint32_t> small, large;
+    small.reserve(k);
+    large.reserve(k);
+    for (size_t i=0; i<k; ++i)
+    {
+        scaled[i] = mass[i]*k/sum;
+        alias_[i] = uint32_t(i);
+        if (scaled[i] < 1.0)
+            small.push_back(uint32_t(i));
+        else
+            large.push_back(uint32_t(i));
+    }
+
+    while (!small.empty() && !large.empty())
+    {
+        uint32_t s = small.back();
+        small.pop_back();
+        uint32_t l = large.back();
+        large.pop_back();
+
+        prob_[s] = scaled[s];
+        alias_[s] = l;
+        scaled[l] = (scaled[l]+scaled[s])-1.0;
+        if (scaled[l] < 1.0)
+            small.push_back(l);
+        else
+            large.push_back(l);
+    }
+
+    // anything left is full, up to rounding
+    for (size_t i=0; i<large.size(); ++i)
+    {
+        prob_[large[i]] = 1.0;
+    }
+    for (size_t i=0; i<small.size(); ++i)
+    {
+        prob_[small[i]] = 1.0;
+    }
+
+    setOk(true);
+}
+
+template <class RNG>
+AliasDiscreteT<RNG>::AliasDiscreteT(const AliasDiscreteT<RNG> &src): 
+    BaseObject(src), 
+    prob_(src.prob_), alias_(src.alias_), cdf_(src.cdf_), 
+    rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+AliasDiscreteT<RNG>::~AliasDiscreteT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+AliasDiscreteT<RNG> &
+AliasDiscreteT<RNG>::operator=(const AliasDiscreteT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        prob_ = rhs.prob_;
+        alias_ = rhs.alias_;
+        cdf_ = rhs.cdf_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+AliasDiscreteT<RNG>::nextValue()
+{
+    size_t k = prob_.size();
+    size_t I = size_t(rng_.random0to1()*k);
+    if (I >= k) I = k-1;
+    double U = rng_.random0to1();
+    return((U < prob_[I]) ? I : alias_[I]);
+}
+
+// fill an array with random values
+template <class RNG>
+void
+AliasDiscreteT<RNG>::fill(double *out, size_t n)
+{
+    // two uniforms per value, drawn a block at a time in the same 
+    // order as nextValue(), then looked up without branches.
+    const size_t blocksize = 256;
+    double u[2*blocksize];
+    size_t k = prob_.size();
+    const double *prob = &prob_[0];
+    const uint32_t *alias = &alias_[0];
+
+    for (size_t start=0; start<n; start+=blocksize)
+    {
+        size_t m = n-start;
+        if (m > blocksize) m = blocksize;
+        rng_.fill(u, 2*m);
+
+        for (size_t j=0; j<m; ++j)
+        {
+            size_t I = size_t(u[2*j]*k);
+            I = (I < k) ? I : k-1;
+            out[start+j] = (u[2*j+1] < prob[I]) ? double(I) : double(alias[I]);
+        }
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+AliasDiscreteT<RNG>::pdf(double x) const
+{
+    size_t k = cdf_.size();
+    if (x < 0.0 || x >= k || x != floor(x)) return(0.0);
+    size_t I = size_t(x);
+    return((I == 0) ? cdf_[0] : cdf_[I]-cdf_[I-1]);
+}
+
+template <class RNG>
+double
+AliasDiscreteT<RNG>::logpdf(double x) const
+{
+    return(log(pdf(x)));
+}
+
+template <class RNG>
+double
+AliasDiscreteT<RNG>::cdf(double x) const
+{
+    size_t k = cdf_.size();
+    if (x < 0.0) return(0.0);
+    if (x >= k-1) return(1.0);
+    return(cdf_[size_t(x)]);
+}
+
+template <class RNG>
+double
+AliasDiscreteT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    size_t k = cdf_.size();
+    size_t I = std::lower_bound(cdf_.begin(), cdf_.end(), p)-cdf_.begin();
+    return((I >= k) ? k-1 : I);
+}
+
+template <class RNG>
+void
+AliasDiscreteT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = pdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+AliasDiscreteT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = logpdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+AliasDiscreteT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = cdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+AliasDiscreteT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = quantile(p[i]);
+    }
+}
+
+}
@@ -6,6 +6,9 @@
 #ifndef __OMBT_BERNOULLI_H
 #define __OMBT_BERNOULLI_H
 
+// system headers
+#include <math.h>
+
 // local headers
 #include "system/Returns.h"
 #include "system/Debug.h"
@@ -15,27 +18,49 @@
 namespace ombt {
 
 // uniform distribution
-class Bernoulli: public BaseObject
+template <class RNG>
+class BernoulliT: public BaseObject
 {
 public:
     // ctors and dtor
-    Bernoulli();
-    Bernoulli(double p, const Random &rng);
-    Bernoulli(const Bernoulli &src);
-    ~Bernoulli();
+    BernoulliT();
+    BernoulliT(double p, const RNG &rng);
+    BernoulliT(const BernoulliT &src);
+    ~BernoulliT();
 
     // assignment
-    Bernoulli &operator=(const Bernoulli &rhs);
+    BernoulliT &operator=(const BernoulliT &rhs);
 
     // get a random value
     double nextValue();
 
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
 protected:
     // data
     double p_;
-    Random rng_;
+    RNG rng_;
 };
 
+// default instantiation, engine chosen at run-time
+typedef BernoulliT<Random> Bernoulli;
+
 }
 
+#include "distributions/Bernoulli.i"
+
 #endif
@@ -0,0 +1,151 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// bernoulli distribution
+//
+// F(X) = if (X<=p) return 1, else return 0;
+//
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+BernoulliT<RNG>::BernoulliT(): 
+    BaseObject(false), p_(0), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+BernoulliT<RNG>::BernoulliT(double p, const RNG &rng): 
+    BaseObject(false), p_(p), rng_(rng)
+{
+    setOk(true);
+}
+
+template <class RNG>
+BernoulliT<RNG>::BernoulliT(const BernoulliT<RNG> &src): 
+    BaseObject(src), p_(src.p_), rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+BernoulliT<RNG>::~BernoulliT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+BernoulliT<RNG> &
+BernoulliT<RNG>::operator=(const BernoulliT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        p_ = rhs.p_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+BernoulliT<RNG>::nextValue()
+{
+    double u = rng_.random0to1();
+    return((u <= p_) ? 1 : 0);
+}
+
+// fill an array with random values
+template <class RNG>
+void
+BernoulliT<RNG>::fill(double *out, size_t n)
+{
+    rng_.fill(out, n);
+    double p = p_;
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = (out[i] <= p) ? 1 : 0;
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+BernoulliT<RNG>::pdf(double x) const
+{
+    if (x == 1.0) return(p_);
+    if (x == 0.0) return(1.0-p_);
+    return(0.0);
+}
+
+template <class RNG>
+double
+BernoulliT<RNG>::logpdf(double x) const
+{
+    return(log(pdf(x)));
+}
+
+template <class RNG>
+double
+BernoulliT<RNG>::cdf(double x) const
+{
+    if (x < 0.0) return(0.0);
+    if (x < 1.0) return(1.0-p_);
+    return(1.0);
+}
+
+template <class RNG>
+double
+BernoulliT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    return((p <= 1.0-p_) ? 0.0 : 1.0);
+}
+
+template <class RNG>
+void
+BernoulliT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = pdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+BernoulliT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = logpdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+BernoulliT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = cdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+BernoulliT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = quantile(p[i]);
+    }
+}
+
+}
@@ -14,35 +14,58 @@
 #include "system/Returns.h"
 #include "system/Debug.h"
 #include "atomic/BaseObject.h"
-#include "atomic/ExtUseCntPtr.h"
 #include "distributions/Gamma.h"
+#include "specialfunctions/SpecialFunctions.h"
 
 namespace ombt {
 
 // beta distribution
-class Beta: public BaseObject
+template <class RNG>
+class BetaT: public BaseObject
 {
 public:
     // ctors and dtor
-    Beta();
-    Beta(double alpha1, double alpha2, const Random &rng);
-    Beta(const Beta &src);
-    ~Beta();
+    BetaT();
+    BetaT(double alpha1, double alpha2, const RNG &rng);
+    BetaT(const BetaT &src);
+    ~BetaT();
 
     // assignment
-    Beta &operator=(const Beta &rhs);
+    BetaT &operator=(const BetaT &rhs);
 
     // get a random value
     double nextValue();
 
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
 protected:
     // data
     double alpha1_;
     double alpha2_;
-    ExtUseCntPtr<Gamma> pgrng1_;
-    ExtUseCntPtr<Gamma> pgrng2_;
+    typename GammaT<RNG>::Setup gamma1_;
+    typename GammaT<RNG>::Setup gamma2_;
+    RNG rng_;
 };
 
+// default instantiation, engine chosen at run-time
+typedef BetaT<Random> Beta;
+
 }
 
+#include "distributions/Beta.i"
+
 #endif
@@ -0,0 +1,159 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// beta distribution
+//
+// 1) y1 ~ gamma(alpha1, 1), y2 ~ gamma(alpha2, 1).
+// 2) return x = y1/(y1+y2);
+// both gammas come from the same engine, so they are independent.
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+BetaT<RNG>::BetaT(): 
+    BaseObject(false),
+    alpha1_(0), alpha2_(0), gamma1_(), gamma2_(), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+BetaT<RNG>::BetaT(double alpha1, double alpha2, const RNG &rng): 
+    BaseObject(false), 
+    alpha1_(alpha1), alpha2_(alpha2), 
+    gamma1_(alpha1), gamma2_(alpha2), rng_(rng)
+{
+    setOk(true);
+}
+
+template <class RNG>
+BetaT<RNG>::BetaT(const BetaT<RNG> &src): 
+    BaseObject(src), 
+    alpha1_(src.alpha1_), alpha2_(src.alpha2_), 
+    gamma1_(src.gamma1_), gamma2_(src.gamma2_), rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+BetaT<RNG>::~BetaT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+BetaT<RNG> &
+BetaT<RNG>::operator=(const BetaT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        alpha1_ = rhs.alpha1_;
+        alpha2_ = rhs.alpha2_;
+        gamma1_ = rhs.gamma1_;
+        gamma2_ = rhs.gamma2_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+BetaT<RNG>::nextValue()
+{
+    double y1 = GammaT<RNG>::standard(rng_, gamma1_);
+    double y2 = GammaT<RNG>::standard(rng_, gamma2_);
+    return(y1/(y1+y2));
+}
+
+// fill an array with random values
+template <class RNG>
+void
+BetaT<RNG>::fill(double *out, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = nextValue();
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+BetaT<RNG>::pdf(double x) const
+{
+    return((x < 0.0 || x > 1.0) ? 0.0 : exp(logpdf(x)));
+}
+
+template <class RNG>
+double
+BetaT<RNG>::logpdf(double x) const
+{
+    if (x < 0.0 || x > 1.0) return(-HUGE_VAL);
+    return(xlogy(alpha1_-1.0, x) + xlog1py(alpha2_-1.0, -x) - 
+           logBeta(alpha1_, alpha2_));
+}
+
+template <class RNG>
+double
+BetaT<RNG>::cdf(double x) const
+{
+    return(betaI(alpha1_, alpha2_, x));
+}
+
+template <class RNG>
+double
+BetaT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    return(betaIInverse(alpha1_, alpha2_, p));
+}
+
+template <class RNG>
+void
+BetaT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = pdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+BetaT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    const double a1 = alpha1_-1.0;
+    const double a2 = alpha2_-1.0;
+    const double c = -logBeta(alpha1_, alpha2_);
+    for (size_t i=0; i<n; ++i)
+    {
+        double f = a1*log(x[i]) + a2*log1p(-x[i]) + c;
+        out[i] = (x[i] <= 0.0 || x[i] >= 1.0) ? logpdf(x[i]) : f;
+    }
+}
+
+template <class RNG>
+void
+BetaT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    betaI(alpha1_, alpha2_, x, out, n);
+}
+
+template <class RNG>
+void
+BetaT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = (p[i] < 0.0 || p[i] > 1.0) ? NAN : p[i];
+    }
+    betaIInverse(alpha1_, alpha2_, out, out, n);
+}
+
+}
@@ -6,37 +6,95 @@
 #ifndef __OMBT_BINOMIAL_H
 #define __OMBT_BINOMIAL_H
 
+// system headers
+#include <stdio.h>
+#include <math.h>
+
 // local headers
 #include "system/Returns.h"
 #include "system/Debug.h"
 #include "atomic/BaseObject.h"
 #include "random/Random.h"
+#include "specialfunctions/SpecialFunctions.h"
 
 namespace ombt {
 
 // binomial distribution
-class Binomial: public BaseObject
+template <class RNG>
+class BinomialT: public BaseObject
 {
 public:
     // ctors and dtor
-    Binomial();
-    Binomial(double p, unsigned long n, const Random &rng);
-    Binomial(const Binomial &src);
-    ~Binomial();
+    BinomialT();
+    BinomialT(double p, unsigned long n, const RNG &rng);
+    BinomialT(const BinomialT &src);
+    ~BinomialT();
 
     // assignment
-    Binomial &operator=(const Binomial &rhs);
+    BinomialT &operator=(const BinomialT &rhs);
 
     // get a random value
     double nextValue();
 
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
+protected:
+    // constants for the sampler, r = min(p, 1-p)
+    struct Setup {
+        Setup(double p = 0, unsigned long n = 0);
+
+        bool btpe_;
+        double r_;
+        double q_;
+        // inversion
+        double qn_;
+        double bound_;
+        // btpe
+        double nrq_;
+        double m_;
+        double xm_;
+        double xl_;
+        double xr_;
+        double c_;
+        double laml_;
+        double lamr_;
+        double p1_;
+        double p2_;
+        double p3_;
+        double p4_;
+    };
+
+    // utilities
+    double nextValueInversion();
+    double nextValueBTPE();
+
 protected:
     // data
     double p_;
     unsigned long n_;
-    Random rng_;
+    Setup setup_;
+    RNG rng_;
 };
 
+// default instantiation, engine chosen at run-time
+typedef BinomialT<Random> Binomial;
+
 }
 
+#include "distributions/Binomial.i"
+
 #endif
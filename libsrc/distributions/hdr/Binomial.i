@@ -0,0 +1,335 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// binomial distribution
+//
+// the value is drawn for r = min(p, 1-p) and mirrored to n-X
+// if p > 0.5.
+//
+// n*r < BTPEMean, inversion: 
+// U ~ U(0,1) is compared with P(X=0), P(X=1), ..., which are
+// built up with P(X=x) = P(X=x-1)*(n-x+1)/x*r/(1-r). the search
+// restarts with a new U if it runs past n*r + 10*sd, the expected
+// number of steps is about n*r+1.
+//
+// n*r >= BTPEMean, BTPE (kachitvichyanukul and schmeiser, 1988):
+// the mass is covered by a triangle around the mode, two 
+// parallelograms and two exponential tails. a point is chosen 
+// under the cover with two uniforms. the triangle is accepted at 
+// once, the rest is accepted by an explicit ratio of probabilities
+// near the mode, or by squeezes and a stirling bound further out.
+// the expected number of uniform pairs is bounded for all n and p.
+//
+
+namespace ombt {
+
+// switch to BTPE at this mean
+static const double BTPEMean = 30.0;
+
+// constants for the sampler
+template <class RNG>
+BinomialT<RNG>::Setup::Setup(double p, unsigned long n):
+    btpe_(false), r_(0), q_(0), qn_(0), bound_(0), 
+    nrq_(0), m_(0), xm_(0), xl_(0), xr_(0), c_(0), 
+    laml_(0), lamr_(0), p1_(0), p2_(0), p3_(0), p4_(0)
+{
+    r_ = (p <= 0.5) ? p : 1.0-p;
+    q_ = 1.0-r_;
+    double np = n*r_;
+    btpe_ = (np >= BTPEMean);
+    if (!btpe_)
+    {
+        qn_ = exp(n*log(q_));
+        bound_ = np + 10.0*sqrt(np*q_ + 1);
+        if (bound_ > n) bound_ = n;
+        return;
+    }
+
+    double fm = np + r_;
+    nrq_ = np*q_;
+    m_ = floor(fm);
+    p1_ = floor(2.195*sqrt(nrq_) - 4.6*q_) + 0.5;
+    xm_ = m_ + 0.5;
+    xl_ = xm_ - p1_;
+    xr_ = xm_ + p1_;
+    c_ = 0.134 + 20.5/(15.3 + m_);
+    double a = (fm - xl_)/(fm - xl_*r_);
+    laml_ = a*(1.0 + a/2.0);
+    a = (xr_ - fm)/(xr_*q_);
+    lamr_ = a*(1.0 + a/2.0);
+    p2_ = p1_*(1.0 + 2.0*c_);
+    p3_ = p2_ + c_/laml_;
+    p4_ = p3_ + c_/lamr_;
+}
+
+// ctors and dtor
+template <class RNG>
+BinomialT<RNG>::BinomialT(): 
+    BaseObject(false), p_(0), n_(0), setup_(), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+BinomialT<RNG>::BinomialT(double p, unsigned long n, const RNG &rng): 
+    BaseObject(false), p_(p), n_(n), setup_(p, n), rng_(rng)
+{
+    setOk(true);
+}
+
+template <class RNG>
+BinomialT<RNG>::BinomialT(const BinomialT<RNG> &src): 
+    BaseObject(src), 
+    p_(src.p_), n_(src.n_), setup_(src.setup_), rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+BinomialT<RNG>::~BinomialT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+BinomialT<RNG> &
+BinomialT<RNG>::operator=(const BinomialT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        p_ = rhs.p_;
+        n_ = rhs.n_;
+        setup_ = rhs.setup_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+BinomialT<RNG>::nextValue()
+{
+    if (p_ <= 0.0 || n_ == 0) return(0);
+    if (p_ >= 1.0) return(n_);
+
+    double X = setup_.btpe_ ? nextValueBTPE() : nextValueInversion();
+    return((p_ > 0.5) ? n_-X : X);
+}
+
+template <class RNG>
+double
+BinomialT<RNG>::nextValueInversion()
+{
+    double X = 0;
+    double px = setup_.qn_;
+    double U = rng_.random0to1();
+    while (U > px)
+    {
+        X += 1;
+        if (X > setup_.bound_)
+        {
+            X = 0;
+            px = setup_.qn_;
+            U = rng_.random0to1();
+        }
+        else
+        {
+            U -= px;
+            px = ((n_-X+1)*setup_.r_*px)/(X*setup_.q_);
+        }
+    }
+    return(X);
+}
+
+template <class RNG>
+double
+BinomialT<RNG>::nextValueBTPE()
+{
+    const Setup &s = setup_;
+    const double n = n_;
+
+    for (;;)
+    {
+        double u = rng_.random0to1()*s.p4_;
+        double v = rng_.random0to1();
+        double y;
+
+        if (u <= s.p1_)
+        {
+            // triangle
+            return(floor(s.xm_ - s.p1_*v + u));
+        }
+        else if (u <= s.p2_)
+        {
+            // parallelograms
+            double x = s.xl_ + (u - s.p1_)/s.c_;
+            v = v*s.c_ + 1.0 - fabs(s.m_ - x + 0.5)/s.p1_;
+            if (v > 1.0) continue;
+            y = floor(x);
+        }
+        else if (u <= s.p3_)
+        {
+            // left tail
+            y = floor(s.xl_ + log(v)/s.laml_);
+            if (y < 0 || v == 0.0) continue;
+            v = v*(u - s.p2_)*s.laml_;
+        }
+        else
+        {
+            // right tail
+            y = floor(s.xr_ - log(v)/s.lamr_);
+            if (y > n || v == 0.0) continue;
+            v = v*(u - s.p3_)*s.lamr_;
+        }
+
+        double k = fabs(y - s.m_);
+        if (k <= 20 || k >= s.nrq_/2.0 - 1)
+        {
+            // explicit ratio f(y)/f(m)
+            double rq = s.r_/s.q_;
+            double a = rq*(n+1);
+            double F = 1.0;
+            if (s.m_ < y)
+            {
+                for (double i=s.m_+1; i<=y; i+=1) F *= (a/i - rq);
+            }
+            else if (s.m_ > y)
+            {
+                for (double i=y+1; i<=s.m_; i+=1) F /= (a/i - rq);
+            }
+            if (v > F) continue;
+            return(y);
+        }
+
+        // squeeze on log(f(y)/f(m))
+        double rho = (k/s.nrq_)*
+                     ((k*(k/3.0 + 0.625) + 0.16666666666666666)/s.nrq_ + 0.5);
+        double t = -k*k/(2*s.nrq_);
+        double A = log(v);
+        if (A < t - rho) return(y);
+        if (A > t + rho) continue;
+
+        // stirling bound
+        double x1 = y+1;
+        double f1 = s.m_+1;
+        double z = n+1-s.m_;
+        double w = n-y+1;
+        double x2 = x1*x1;
+        double f2 = f1*f1;
+        double z2 = z*z;
+        double w2 = w*w;
+        double bound = 
+            s.xm_*log(f1/x1) + (n-s.m_+0.5)*log(z/w) + 
+            (y-s.m_)*log(w*s.r_/(x1*s.q_)) +
+            (13680.-(462.-(132.-(99.-140./f2)/f2)/f2)/f2)/f1/166320. +
+            (13680.-(462.-(132.-(99.-140./z2)/z2)/z2)/z2)/z/166320. +
+            (13680.-(462.-(132.-(99.-140./x2)/x2)/x2)/x2)/x1/166320. +
+            (13680.-(462.-(132.-(99.-140./w2)/w2)/w2)/w2)/w/166320.;
+        if (A > bound) continue;
+        return(y);
+    }
+}
+
+// fill an array with random values
+template <class RNG>
+void
+BinomialT<RNG>::fill(double *out, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = nextValue();
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+BinomialT<RNG>::pdf(double x) const
+{
+    if (x < 0.0 || x > n_ || x != floor(x)) return(0.0);
+    return(exp(logpdf(x)));
+}
+
+template <class RNG>
+double
+BinomialT<RNG>::logpdf(double x) const
+{
+    if (x < 0.0 || x > n_ || x != floor(x)) return(-HUGE_VAL);
+    double n = n_;
+    return(logGamma(n+1) - logGamma(x+1) - logGamma(n-x+1) +
+           xlogy(x, p_) + xlog1py(n-x, -p_));
+}
+
+template <class RNG>
+double
+BinomialT<RNG>::cdf(double x) const
+{
+    if (x < 0.0) return(0.0);
+    if (x >= n_) return(1.0);
+    double k = floor(x);
+    return(betaI(n_-k, k+1, 1.0-p_));
+}
+
+template <class RNG>
+double
+BinomialT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    double n = n_;
+    if (p == 1.0) return(n);
+    double mean = n*p_;
+    double sd = sqrt(n*p_*(1.0-p_));
+    double k = floor(mean+sd*normalQuantile(p));
+    if (!(k >= 0.0)) k = 0.0;
+    if (k > n) k = n;
+    while (k < n && cdf(k) < p) k += 1;
+    while (k > 0.0 && cdf(k-1) >= p) k -= 1;
+    return(k);
+}
+
+template <class RNG>
+void
+BinomialT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = pdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+BinomialT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = logpdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+BinomialT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = cdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+BinomialT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = quantile(p[i]);
+    }
+}
+
+}
@@ -19,28 +19,50 @@
 namespace ombt {
 
 // discrete uniform distribution
-class DiscreteUniform: public BaseObject
+template <class RNG>
+class DiscreteUniformT: public BaseObject
 {
 public:
     // ctors and dtor
-    DiscreteUniform();
-    DiscreteUniform(double start, double end, const Random &rng);
-    DiscreteUniform(const DiscreteUniform &src);
-    ~DiscreteUniform();
+    DiscreteUniformT();
+    DiscreteUniformT(double start, double end, const RNG &rng);
+    DiscreteUniformT(const DiscreteUniformT &src);
+    ~DiscreteUniformT();
 
     // assignment
-    DiscreteUniform &operator=(const DiscreteUniform &rhs);
+    DiscreteUniformT &operator=(const DiscreteUniformT &rhs);
 
     // get a random value
     double nextValue();
 
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
 protected:
     // data
     double start_;
     double end_;
-    Random rng_;
+    RNG rng_;
 };
 
+// default instantiation, engine chosen at run-time
+typedef DiscreteUniformT<Random> DiscreteUniform;
+
 }
 
+#include "distributions/DiscreteUniform.i"
+
 #endif
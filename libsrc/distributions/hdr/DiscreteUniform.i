@@ -0,0 +1,158 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// discrete uniform distribution
+//
+// P(x) = i/(j-i+1) for x in {i,i+1,...,j}
+// X = i+floor((j-i+1)*U), U in (0,1).
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+DiscreteUniformT<RNG>::DiscreteUniformT(): 
+    BaseObject(false), start_(0), end_(0), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+DiscreteUniformT<RNG>::DiscreteUniformT(
+    double start, double end, const RNG &rng): 
+    BaseObject(false), start_(start), end_(end), rng_(rng)
+{
+    setOk(true);
+}
+
+template <class RNG>
+DiscreteUniformT<RNG>::DiscreteUniformT(const DiscreteUniformT<RNG> &src): 
+    BaseObject(src), 
+    start_(src.start_), end_(src.end_), rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+DiscreteUniformT<RNG>::~DiscreteUniformT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+DiscreteUniformT<RNG> &
+DiscreteUniformT<RNG>::operator=(const DiscreteUniformT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        start_ = rhs.start_;
+        end_ = rhs.end_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+DiscreteUniformT<RNG>::nextValue()
+{
+    double u = rng_.random0to1();
+    return(start_+floor((end_-start_+1)*u));
+}
+
+// fill an array with random values
+template <class RNG>
+void
+DiscreteUniformT<RNG>::fill(double *out, size_t n)
+{
+    rng_.fill(out, n);
+    double start = start_;
+    double width = end_-start_+1;
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = start+floor(width*out[i]);
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+DiscreteUniformT<RNG>::pdf(double x) const
+{
+    if (x < start_ || x > end_ || x != floor(x)) return(0.0);
+    return(1.0/(end_-start_+1));
+}
+
+template <class RNG>
+double
+DiscreteUniformT<RNG>::logpdf(double x) const
+{
+    if (x < start_ || x > end_ || x != floor(x)) return(-HUGE_VAL);
+    return(-log(end_-start_+1));
+}
+
+template <class RNG>
+double
+DiscreteUniformT<RNG>::cdf(double x) const
+{
+    if (x < start_) return(0.0);
+    if (x >= end_) return(1.0);
+    return((floor(x)-start_+1)/(end_-start_+1));
+}
+
+template <class RNG>
+double
+DiscreteUniformT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    double k = start_+ceil(p*(end_-start_+1))-1;
+    if (k < start_) k = start_;
+    if (k > end_) k = end_;
+    return(k);
+}
+
+template <class RNG>
+void
+DiscreteUniformT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = pdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+DiscreteUniformT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = logpdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+DiscreteUniformT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = cdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+DiscreteUniformT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = quantile(p[i]);
+    }
+}
+
+}
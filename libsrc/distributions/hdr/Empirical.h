@@ -0,0 +1,142 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_EMPIRICAL_H
+#define __OMBT_EMPIRICAL_H
+
+// system headers
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+#include <algorithm>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+#include "random/Random.h"
+#include "distributions/Gaussian.h"
+
+namespace ombt {
+
+// empirical distribution of observed values, mass 1/n at each of
+// the n values, or with a bandwidth h > 0, the values smoothed by a
+// gaussian kernel of standard deviation h (a smoothed bootstrap).
+//
+// values are kept as one sorted array of doubles. new values go
+// into a buffer, which is sorted into a run when it fills, and runs
+// of about the same size are merged, so a stream of n values costs
+// O(n log n) in all and is never sorted again from scratch. merge()
+// adds the values of another distribution as one more run. the
+// runs are merged into one, lazily, by the first query after an
+// add, which also rebuilds an index of the sorted values by equal
+// steps of x.
+//
+// unsmoothed, a value and quantile() are O(1), and cdf() and pdf()
+// are a search of one step of the index, expected O(1) for data
+// without heavy clusters. smoothed, a value is O(1) plus a gaussian,
+// and cdf() and pdf() sum the kernels within 8h of x.
+template <class RNG>
+class EmpiricalT: public BaseObject
+{
+public:
+    // sizes
+    enum {
+        RunSize = 65536,
+        IndexStep = 8,
+        BufferSize = 256
+    };
+
+    // ctors and dtor
+    EmpiricalT();
+    EmpiricalT(const RNG &rng, double bandwidth = 0.0);
+    EmpiricalT(const std::vector<double> &values, const RNG &rng,
+               double bandwidth = 0.0);
+    EmpiricalT(const EmpiricalT &src);
+    ~EmpiricalT();
+
+    // assignment
+    EmpiricalT &operator=(const EmpiricalT &rhs);
+
+    // accumulate, nans are ignored
+    void clear();
+    void add(double x);
+    void add(const double *x, size_t n);
+    void merge(const EmpiricalT &other);
+
+    // kernel bandwidth, 0 for none. silverman() is the rule of thumb
+    // 0.9 min(s, iqr/1.34) n^(-1/5) for the values so far.
+    void setBandwidth(double bandwidth);
+    double bandwidth() const { return(bandwidth_); }
+    double silverman() const;
+
+    // get a random value
+    double nextValue();
+
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse. nan if there are no
+    // values.
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
+    // the values, sorted
+    size_t size() const { return(count_); }
+    const std::vector<double> &values() const;
+    double minimum() const;
+    double maximum() const;
+
+protected:
+    // sort the buffer into a run, merge runs of about the same
+    // size or all of them, and merge all with a new index
+    void flush() const;
+    void collapse(bool all) const;
+    void compact() const;
+    static void mergeRuns(const std::vector<double> &first,
+                          const std::vector<double> &second,
+                          std::vector<double> &out);
+
+    // number of values < x, or <= x if inclusive
+    size_t rank(double x, bool inclusive) const;
+
+    // smoothed density and distribution functions
+    double kernelPdf(double x) const;
+    double kernelCdf(double x) const;
+
+protected:
+    // internal data. the buffer and runs are merged lazily, also by
+    // the const queries. runs_[0] holds the sorted values after
+    // compact().
+    size_t count_;
+    double bandwidth_;
+    mutable std::vector<double> buffer_;
+    mutable std::vector<std::vector<double> > runs_;
+    mutable std::vector<double> scratch_;
+    mutable std::vector<size_t> index_;
+    mutable double origin_;
+    mutable double scale_;
+    RNG rng_;
+    GaussianT<RNG> kernel_;
+};
+
+// default instantiation, engine chosen at run-time
+typedef EmpiricalT<Random> Empirical;
+
+}
+
+#include "distributions/Empirical.i"
+
+#endif
@@ -0,0 +1,492 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// empirical distribution
+//
+// for sorted values x(0) <= x(1) <= ... <= x(n-1),
+// F(x) = #{x(i) <= x}/n, Q(p) = x(ceil(n*p)-1), and X = x(floor(n*U)),
+// U in (0,1). with a bandwidth h,
+// f(x) = 1/(n h) sum phi((x-x(i))/h), F(x) = 1/n sum PHI((x-x(i))/h),
+// and X = x(floor(n*U)) + h*Z, Z standard gaussian. values more
+// than 8h from x are 0 or 1 to double precision in F and are
+// counted, not summed.
+//
+// the index splits [x(0),x(n-1)] into n/IndexStep equal steps, and
+// index_[b] is the first value in step b, so the values in a step
+// are found without a search of the whole array.
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+EmpiricalT<RNG>::EmpiricalT(): 
+    BaseObject(false), count_(0), bandwidth_(0.0), buffer_(), runs_(),
+    scratch_(), index_(), origin_(0.0), scale_(0.0), rng_(), kernel_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+EmpiricalT<RNG>::EmpiricalT(const RNG &rng, double bandwidth): 
+    BaseObject(false), count_(0), bandwidth_(0.0), buffer_(), runs_(),
+    scratch_(), index_(), origin_(0.0), scale_(0.0), rng_(rng),
+    kernel_(0.0, 1.0, rng.substream(1))
+{
+    setBandwidth(bandwidth);
+    setOk(true);
+}
+
+template <class RNG>
+EmpiricalT<RNG>::EmpiricalT(const std::vector<double> &values,
+                            const RNG &rng, double bandwidth): 
+    BaseObject(false), count_(0), bandwidth_(0.0), buffer_(), runs_(),
+    scratch_(), index_(), origin_(0.0), scale_(0.0), rng_(rng),
+    kernel_(0.0, 1.0, rng.substream(1))
+{
+    if (!values.empty()) add(&values[0], values.size());
+    setBandwidth(bandwidth);
+    setOk(true);
+}
+
+template <class RNG>
+EmpiricalT<RNG>::EmpiricalT(const EmpiricalT<RNG> &src): 
+    BaseObject(src), count_(src.count_), bandwidth_(src.bandwidth_),
+    buffer_(src.buffer_), runs_(src.runs_), scratch_(), 
+    index_(src.index_), origin_(src.origin_), scale_(src.scale_),
+    rng_(src.rng_), kernel_(src.kernel_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+EmpiricalT<RNG>::~EmpiricalT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+EmpiricalT<RNG> &
+EmpiricalT<RNG>::operator=(const EmpiricalT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        count_ = rhs.count_;
+        bandwidth_ = rhs.bandwidth_;
+        buffer_ = rhs.buffer_;
+        runs_ = rhs.runs_;
+        index_ = rhs.index_;
+        origin_ = rhs.origin_;
+        scale_ = rhs.scale_;
+        rng_ = rhs.rng_;
+        kernel_ = rhs.kernel_;
+    }
+    return(*this);
+}
+
+// accumulate
+template <class RNG>
+void
+EmpiricalT<RNG>::clear()
+{
+    count_ = 0;
+    buffer_.clear();
+    runs_.clear();
+    index_.clear();
+}
+
+template <class RNG>
+void
+EmpiricalT<RNG>::add(double x)
+{
+    if (isnan(x)) return;
+    if (!index_.empty()) index_.clear();
+    buffer_.push_back(x);
+    ++count_;
+    if (buffer_.size() >= RunSize) flush();
+}
+
+template <class RNG>
+void
+EmpiricalT<RNG>::add(const double *x, size_t n)
+{
+    if (!index_.empty()) index_.clear();
+    for (size_t i=0; i<n; ++i)
+    {
+        if (isnan(x[i])) continue;
+        buffer_.push_back(x[i]);
+        ++count_;
+        if (buffer_.size() >= RunSize) flush();
+    }
+}
+
+template <class RNG>
+void
+EmpiricalT<RNG>::merge(const EmpiricalT<RNG> &other)
+{
+    std::vector<double> run(other.values());
+    if (run.empty()) return;
+    flush();
+    count_ += run.size();
+    runs_.push_back(std::vector<double>());
+    runs_.back().swap(run);
+    collapse(false);
+}
+
+// bandwidth
+template <class RNG>
+void
+EmpiricalT<RNG>::setBandwidth(double bandwidth)
+{
+    bandwidth_ = (bandwidth > 0.0 && isfinite(bandwidth)) ? bandwidth : 0.0;
+}
+
+template <class RNG>
+double
+EmpiricalT<RNG>::silverman() const
+{
+    if (count_ < 2) return(0.0);
+    const std::vector<double> &x = values();
+    double n = double(x.size());
+
+    double mean = 0.0;
+    for (size_t i=0; i<x.size(); ++i) mean += x[i];
+    mean /= n;
+    double sum2 = 0.0;
+    for (size_t i=0; i<x.size(); ++i) sum2 += (x[i]-mean)*(x[i]-mean);
+    double s = sqrt(sum2/(n-1.0));
+
+    double iqr = (x[size_t(0.75*(n-1))]-x[size_t(0.25*(n-1))])/1.34;
+    double spread = (iqr > 0.0) ? std::min(s, iqr) : s;
+    return(0.9*spread*pow(n, -0.2));
+}
+
+// sort the buffer into a run
+template <class RNG>
+void
+EmpiricalT<RNG>::flush() const
+{
+    index_.clear();
+    if (buffer_.empty()) return;
+    std::sort(buffer_.begin(), buffer_.end());
+    runs_.push_back(std::vector<double>());
+    runs_.back().swap(buffer_);
+    collapse(false);
+}
+
+// merge the last two runs while the one below is at most twice the
+// size of the last, so the sizes at least double going down and
+// each value is merged O(log n) times. or merge them all.
+template <class RNG>
+void
+EmpiricalT<RNG>::collapse(bool all) const
+{
+    while (runs_.size() > 1)
+    {
+        std::vector<double> &below = runs_[runs_.size()-2];
+        std::vector<double> &last = runs_.back();
+        if (!all && below.size() > 2*last.size()) break;
+        scratch_.resize(below.size()+last.size());
+        mergeRuns(below, last, scratch_);
+        below.swap(scratch_);
+        runs_.pop_back();
+    }
+    if (all) scratch_ = std::vector<double>();
+}
+
+// merge two sorted runs. the choice of the next value is a select,
+// not a branch, since on data in random order a branch would be
+// mispredicted about every other value. ties take the first run.
+template <class RNG>
+void
+EmpiricalT<RNG>::mergeRuns(const std::vector<double> &first, 
+                           const std::vector<double> &second,
+                           std::vector<double> &out)
+{
+    const double *a = &first[0];
+    const double *b = &second[0];
+    const double *aend = a+first.size();
+    const double *bend = b+second.size();
+    double *o = &out[0];
+    while (a < aend && b < bend)
+    {
+        double x = *a;
+        double y = *b;
+        bool later = (y < x);
+        *o++ = later ? y : x;
+        a += !later;
+        b += later;
+    }
+    o = std::copy(a, aend, o);
+    std::copy(b, bend, o);
+}
+
+// everything in one sorted run, and its index
+template <class RNG>
+void
+EmpiricalT<RNG>::compact() const
+{
+    if (!index_.empty()) return;
+    flush();
+    collapse(true);
+    if (runs_.empty()) runs_.push_back(std::vector<double>());
+
+    const std::vector<double> &x = runs_[0];
+    size_t n = x.size();
+    size_t steps = std::max(n/IndexStep, size_t(1));
+    double range = (n > 0) ? x[n-1]-x[0] : 0.0;
+    origin_ = (n > 0) ? x[0] : 0.0;
+    scale_ = (range > 0.0) ? steps/range : 0.0;
+
+    index_.resize(steps+1);
+    size_t b = 0;
+    for (size_t i=0; i<n; ++i)
+    {
+        size_t step = std::min(size_t((x[i]-origin_)*scale_), steps-1);
+        while (b <= step) index_[b++] = i;
+    }
+    while (b <= steps) index_[b++] = n;
+}
+
+// the step of x holds the values from index_[step] to
+// index_[step+1], everything before it is below x and everything
+// after it above.
+template <class RNG>
+size_t
+EmpiricalT<RNG>::rank(double x, bool inclusive) const
+{
+    compact();
+    const std::vector<double> &v = runs_[0];
+    if (v.empty() || !(x >= v.front())) return(0);
+    if (x > v.back()) return(v.size());
+
+    size_t steps = index_.size()-1;
+    size_t step = std::min(size_t((x-origin_)*scale_), steps-1);
+    std::vector<double>::const_iterator lo = v.begin()+index_[step];
+    std::vector<double>::const_iterator hi = v.begin()+index_[step+1];
+    if (inclusive)
+        return(std::upper_bound(lo, hi, x)-v.begin());
+    else
+        return(std::lower_bound(lo, hi, x)-v.begin());
+}
+
+// the values
+template <class RNG>
+const std::vector<double> &
+EmpiricalT<RNG>::values() const
+{
+    compact();
+    return(runs_[0]);
+}
+
+template <class RNG>
+double
+EmpiricalT<RNG>::minimum() const
+{
+    const std::vector<double> &x = values();
+    return(x.empty() ? NAN : x.front());
+}
+
+template <class RNG>
+double
+EmpiricalT<RNG>::maximum() const
+{
+    const std::vector<double> &x = values();
+    return(x.empty() ? NAN : x.back());
+}
+
+// get value
+template <class RNG>
+double
+EmpiricalT<RNG>::nextValue()
+{
+    const std::vector<double> &x = values();
+    size_t n = x.size();
+    if (n == 0) return(NAN);
+    double u = rng_.random0to1();
+    double value = x[std::min(size_t(u*n), n-1)];
+    if (bandwidth_ > 0.0) value += bandwidth_*kernel_.nextValue();
+    return(value);
+}
+
+// fill an array with random values
+template <class RNG>
+void
+EmpiricalT<RNG>::fill(double *out, size_t n)
+{
+    const std::vector<double> &x = values();
+    size_t count = x.size();
+    if (count == 0)
+    {
+        std::fill(out, out+n, NAN);
+        return;
+    }
+
+    // uniforms to values in place, then the kernel a buffer at a time
+    rng_.fill(out, n);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = x[std::min(size_t(out[i]*count), count-1)];
+    }
+    if (bandwidth_ <= 0.0) return;
+
+    double z[BufferSize];
+    for (size_t k=0; k<n; k+=BufferSize)
+    {
+        size_t m = std::min(n-k, size_t(BufferSize));
+        kernel_.fill(z, m);
+        for (size_t i=0; i<m; ++i)
+        {
+            out[k+i] += bandwidth_*z[i];
+        }
+    }
+}
+
+// smoothed density and distribution functions
+template <class RNG>
+double
+EmpiricalT<RNG>::kernelPdf(double x) const
+{
+    const std::vector<double> &v = runs_[0];
+    double h = bandwidth_;
+    size_t lo = rank(x-8.0*h, false);
+    size_t hi = rank(x+8.0*h, true);
+    double sum = 0.0;
+    for (size_t i=lo; i<hi; ++i)
+    {
+        double z = (x-v[i])/h;
+        sum += exp(-0.5*z*z);
+    }
+    return(sum/(v.size()*h*sqrt(2.0*M_PI)));
+}
+
+template <class RNG>
+double
+EmpiricalT<RNG>::kernelCdf(double x) const
+{
+    const std::vector<double> &v = runs_[0];
+    double h = bandwidth_;
+    size_t lo = rank(x-8.0*h, false);
+    size_t hi = rank(x+8.0*h, true);
+    double sum = double(lo);
+    for (size_t i=lo; i<hi; ++i)
+    {
+        sum += 0.5*erfc((v[i]-x)/(h*M_SQRT2));
+    }
+    return(sum/v.size());
+}
+
+// density and distribution functions
+template <class RNG>
+double
+EmpiricalT<RNG>::pdf(double x) const
+{
+    size_t n = values().size();
+    if (n == 0) return(NAN);
+    if (bandwidth_ > 0.0) return(kernelPdf(x));
+    return(double(rank(x, true)-rank(x, false))/n);
+}
+
+template <class RNG>
+double
+EmpiricalT<RNG>::logpdf(double x) const
+{
+    return(log(pdf(x)));
+}
+
+template <class RNG>
+double
+EmpiricalT<RNG>::cdf(double x) const
+{
+    size_t n = values().size();
+    if (n == 0) return(NAN);
+    if (bandwidth_ > 0.0) return(kernelCdf(x));
+    return(double(rank(x, true))/n);
+}
+
+template <class RNG>
+double
+EmpiricalT<RNG>::quantile(double p) const
+{
+    const std::vector<double> &v = values();
+    size_t n = v.size();
+    if (n == 0 || p < 0.0 || p > 1.0) return(NAN);
+
+    size_t k = size_t(ceil(n*p));
+    double x = v[std::min((k > 0) ? k-1 : 0, n-1)];
+    if (bandwidth_ <= 0.0) return(x);
+    if (p == 0.0) return(-HUGE_VAL);
+    if (p == 1.0) return(HUGE_VAL);
+
+    // smoothed, within 8h of the unsmoothed quantile but for the
+    // far tails. safeguarded newton from there.
+    double h = bandwidth_;
+    double lo = x-8.0*h;
+    double hi = x+8.0*h;
+    while (kernelCdf(lo) > p) lo -= 8.0*h;
+    while (kernelCdf(hi) < p) hi += 8.0*h;
+    for (int iteration=0; iteration<100; ++iteration)
+    {
+        double f = kernelCdf(x)-p;
+        if (f == 0.0) break;
+        if (f > 0.0)
+            hi = x;
+        else
+            lo = x;
+        double d = kernelPdf(x);
+        double next = (d > 0.0) ? x-f/d : lo-1.0;
+        if (!(next > lo && next < hi)) next = 0.5*(lo+hi);
+        if (fabs(next-x) <= 1.0e-12*h)
+        {
+            x = next;
+            break;
+        }
+        x = next;
+    }
+    return(x);
+}
+
+template <class RNG>
+void
+EmpiricalT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = pdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+EmpiricalT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = logpdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+EmpiricalT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = cdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+EmpiricalT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = quantile(p[i]);
+    }
+}
+
+}
@@ -15,31 +15,54 @@
 #include "system/Debug.h"
 #include "atomic/BaseObject.h"
 #include "random/Random.h"
+#include "specialfunctions/SpecialFunctions.h"
 
 namespace ombt {
 
 // exponential distribution
-class Exponential: public BaseObject
+template <class RNG>
+class ExponentialT: public BaseObject
 {
 public:
     // ctors and dtor
-    Exponential();
-    Exponential(double beta, const Random &rng);
-    Exponential(const Exponential &src);
-    ~Exponential();
+    ExponentialT();
+    ExponentialT(double beta, const RNG &rng);
+    ExponentialT(const ExponentialT &src);
+    ~ExponentialT();
 
     // assignment
-    Exponential &operator=(const Exponential &rhs);
+    ExponentialT &operator=(const ExponentialT &rhs);
 
     // get a random value
     double nextValue();
 
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
 protected:
     // data
     double beta_;
-    Random rng_;
+    RNG rng_;
 };
 
+// default instantiation, engine chosen at run-time
+typedef ExponentialT<Random> Exponential;
+
 }
 
+#include "distributions/Exponential.i"
+
 #endif
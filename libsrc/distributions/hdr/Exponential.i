@@ -0,0 +1,162 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// exponential distribution
+//
+// F(x) = 1-exp(x/beta)
+// X = -beta*log(1-U), U in (0,1).
+// or, 
+// X = -beta*log(U), U in (0,1).
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+ExponentialT<RNG>::ExponentialT(): 
+    BaseObject(false), beta_(0), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+ExponentialT<RNG>::ExponentialT(double beta, const RNG &rng): 
+    BaseObject(false), beta_(beta), rng_(rng)
+{
+    setOk(true);
+}
+
+template <class RNG>
+ExponentialT<RNG>::ExponentialT(const ExponentialT<RNG> &src): 
+    BaseObject(src), beta_(src.beta_), rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+ExponentialT<RNG>::~ExponentialT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+ExponentialT<RNG> &
+ExponentialT<RNG>::operator=(const ExponentialT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        beta_ = rhs.beta_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+ExponentialT<RNG>::nextValue()
+{
+    double u = rng_.random0to1();
+    return(-beta_*log(u));
+}
+
+// fill an array with random values
+template <class RNG>
+void
+ExponentialT<RNG>::fill(double *out, size_t n)
+{
+    // uniforms first, then a branch-free transform the
+    // compiler can vectorize.
+    rng_.fill(out, n);
+    double mbeta = -beta_;
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = mbeta*log(out[i]);
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+ExponentialT<RNG>::pdf(double x) const
+{
+    return((x < 0.0) ? 0.0 : exp(-x/beta_)/beta_);
+}
+
+template <class RNG>
+double
+ExponentialT<RNG>::logpdf(double x) const
+{
+    return((x < 0.0) ? -HUGE_VAL : -x/beta_-log(beta_));
+}
+
+template <class RNG>
+double
+ExponentialT<RNG>::cdf(double x) const
+{
+    return((x <= 0.0) ? 0.0 : -expm1(-x/beta_));
+}
+
+template <class RNG>
+double
+ExponentialT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    return(-beta_*log1p(-p));
+}
+
+template <class RNG>
+void
+ExponentialT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    const double ibeta = 1.0/beta_;
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = (x[i] < 0.0) ? -HUGE_VAL : -x[i]*ibeta;
+    }
+    exponential(out, out, n);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] *= ibeta;
+    }
+}
+
+template <class RNG>
+void
+ExponentialT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    const double ibeta = 1.0/beta_;
+    const double lbeta = log(beta_);
+    for (size_t i=0; i<n; ++i)
+    {
+        double f = -x[i]*ibeta-lbeta;
+        out[i] = (x[i] < 0.0) ? -HUGE_VAL : f;
+    }
+}
+
+template <class RNG>
+void
+ExponentialT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    const double ibeta = 1.0/beta_;
+    for (size_t i=0; i<n; ++i)
+    {
+        double c = -expm1(-x[i]*ibeta);
+        out[i] = (x[i] <= 0.0) ? 0.0 : c;
+    }
+}
+
+template <class RNG>
+void
+ExponentialT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = quantile(p[i]);
+    }
+}
+
+}
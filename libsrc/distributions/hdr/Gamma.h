@@ -15,32 +15,72 @@
 #include "system/Debug.h"
 #include "atomic/BaseObject.h"
 #include "random/Random.h"
+#include "specialfunctions/SpecialFunctions.h"
+#include "distributions/Gaussian.h"
 
 namespace ombt {
 
 // gamma distribution
-class Gamma: public BaseObject
+template <class RNG>
+class GammaT: public BaseObject
 {
 public:
     // ctors and dtor
-    Gamma();
-    Gamma(double beta, double alpha, const Random &rng);
-    Gamma(const Gamma &src);
-    ~Gamma();
+    GammaT();
+    GammaT(double alpha, double beta, const RNG &rng);
+    GammaT(const GammaT &src);
+    ~GammaT();
 
     // assignment
-    Gamma &operator=(const Gamma &rhs);
+    GammaT &operator=(const GammaT &rhs);
 
     // get a random value
     double nextValue();
 
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
+    // constants for one shape. distributions built on gamma keep
+    // these by value and pass in their own engine.
+    struct Setup {
+        Setup(double alpha = 1);
+
+        double alpha_;
+        double d_;
+        double c_;
+        double ialpha_;
+    };
+
+    // gamma(alpha, 1) value from the given engine
+    static double standard(RNG &rng, const Setup &setup);
+    static double standard(RNG &rng, double alpha);
+
 protected:
     // data
     double alpha_;
     double beta_;
-    Random rng_;
+    Setup setup_;
+    RNG rng_;
 };
 
+// default instantiation, engine chosen at run-time
+typedef GammaT<Random> Gamma;
+
 }
 
+#include "distributions/Gamma.i"
+
 #endif
@@ -0,0 +1,235 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// gamma distribution
+//
+// X ~ gamma(alpha, beta) is beta*gamma(alpha, 1), so only the
+// standard gamma is generated (marsaglia and tsang, 2000):
+//
+// alpha >= 1:
+// 1) d = alpha - 1/3, c = 1/sqrt(9*d).
+// 2) generate x ~ N(0,1) until v = 1 + c*x > 0, let v = v**3 and 
+// generate u ~ U(0,1).
+// 3) if u < 1 - 0.0331*x**4, return d*v (the squeeze, most values).
+// 4) if log(u) < x**2/2 + d*(1 - v + log(v)), return d*v, 
+// else go back to step 2.
+// about 98% of tries are accepted for any alpha >= 1, each needs
+// one normal and one uniform.
+//
+// alpha < 1:
+// return gamma(alpha+1, 1)*u**(1/alpha), u ~ U(0,1).
+//
+
+namespace ombt {
+
+// constants for one shape
+template <class RNG>
+GammaT<RNG>::Setup::Setup(double alpha):
+    alpha_(alpha), d_(0), c_(0), ialpha_(0)
+{
+    MustBeTrue(alpha > 0.0);
+    if (alpha < 1.0)
+    {
+        ialpha_ = 1.0/alpha;
+        alpha += 1.0;
+    }
+    d_ = alpha - 1.0/3.0;
+    c_ = 1.0/sqrt(9.0*d_);
+}
+
+// ctors and dtor
+template <class RNG>
+GammaT<RNG>::GammaT(): 
+    BaseObject(false), 
+    alpha_(0), beta_(0), setup_(), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+GammaT<RNG>::GammaT(double alpha, double beta, const RNG &rng): 
+    BaseObject(false), 
+    alpha_(alpha), beta_(beta), setup_(alpha), rng_(rng)
+{
+    MustBeTrue(alpha_ > 0 && beta_ > 0);
+    setOk(true);
+}
+
+template <class RNG>
+GammaT<RNG>::GammaT(const GammaT<RNG> &src): 
+    BaseObject(src), 
+    alpha_(src.alpha_), beta_(src.beta_), 
+    setup_(src.setup_), rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+GammaT<RNG>::~GammaT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+GammaT<RNG> &
+GammaT<RNG>::operator=(const GammaT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        alpha_ = rhs.alpha_;
+        beta_ = rhs.beta_;
+        setup_ = rhs.setup_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+GammaT<RNG>::nextValue()
+{
+    return(beta_*standard(rng_, setup_));
+}
+
+template <class RNG>
+double
+GammaT<RNG>::standard(RNG &rng, double alpha)
+{
+    return(standard(rng, Setup(alpha)));
+}
+
+template <class RNG>
+double
+GammaT<RNG>::standard(RNG &rng, const Setup &setup)
+{
+    const double d = setup.d_;
+    const double c = setup.c_;
+    double y;
+
+    for (;;)
+    {
+        double x, v;
+        do {
+            x = GaussianT<RNG>::standard(rng);
+            v = 1.0 + c*x;
+        } while (v <= 0.0);
+        v = v*v*v;
+        double u = rng.random0to1();
+        double x2 = x*x;
+        if (u < 1.0 - 0.0331*x2*x2)
+        {
+            y = d*v;
+            break;
+        }
+        if (log(u) < 0.5*x2 + d*(1.0 - v + log(v)))
+        {
+            y = d*v;
+            break;
+        }
+    }
+
+    if (setup.ialpha_ > 0.0)
+        y *= exp(log(rng.random0to1())*setup.ialpha_);
+    return(y);
+}
+
+// fill an array with random values
+template <class RNG>
+void
+GammaT<RNG>::fill(double *out, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = nextValue();
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+GammaT<RNG>::pdf(double x) const
+{
+    return((x < 0.0) ? 0.0 : exp(logpdf(x)));
+}
+
+template <class RNG>
+double
+GammaT<RNG>::logpdf(double x) const
+{
+    if (x < 0.0) return(-HUGE_VAL);
+    double z = x/beta_;
+    return(xlogy(alpha_-1.0, z) - z - logGamma(alpha_) - log(beta_));
+}
+
+template <class RNG>
+double
+GammaT<RNG>::cdf(double x) const
+{
+    return(gammaP(alpha_, x/beta_));
+}
+
+template <class RNG>
+double
+GammaT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    return(beta_*gammaPInverse(alpha_, p));
+}
+
+template <class RNG>
+void
+GammaT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    logpdf(x, out, n);
+    exponential(out, out, n);
+}
+
+template <class RNG>
+void
+GammaT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    const double ibeta = 1.0/beta_;
+    const double a1 = alpha_-1.0;
+    const double c = -logGamma(alpha_) - log(beta_);
+    for (size_t i=0; i<n; ++i)
+    {
+        double z = x[i]*ibeta;
+        double f = a1*log(z) - z + c;
+        out[i] = (x[i] <= 0.0) ? logpdf(x[i]) : f;
+    }
+}
+
+template <class RNG>
+void
+GammaT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    const double ibeta = 1.0/beta_;
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = x[i]*ibeta;
+    }
+    gammaP(alpha_, out, out, n);
+}
+
+template <class RNG>
+void
+GammaT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    const double beta = beta_;
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = (p[i] < 0.0 || p[i] > 1.0) ? NAN : p[i];
+    }
+    gammaPInverse(alpha_, out, out, n);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] *= beta;
+    }
+}
+
+}
@@ -15,34 +15,86 @@
 #include "system/Debug.h"
 #include "atomic/BaseObject.h"
 #include "random/Random.h"
+#include "specialfunctions/SpecialFunctions.h"
 
 namespace ombt {
 
+// ziggurat tables, shared by all instantiations. layer i is the
+// rectangle [0,x_[i]], r_[i] = x_[i+1]/x_[i] is the part of it
+// lying completely under the density.
+class GaussianZiggurat
+{
+public:
+    // constants
+    enum { Layers = 128 };
+    static const double R;
+    static const double V;
+
+    // the tables, built on first use
+    static const GaussianZiggurat &tables();
+
+    // data
+    double x_[Layers+1];
+    double r_[Layers];
+
+protected:
+    // ctors
+    GaussianZiggurat();
+};
+
 // gaussian distribution
-class Gaussian: public BaseObject
+template <class RNG>
+class GaussianT: public BaseObject
 {
 public:
     // ctors and dtor
-    Gaussian();
-    Gaussian(double mu, double sigma2, const Random &rng);
-    Gaussian(const Gaussian &src);
-    ~Gaussian();
+    GaussianT();
+    GaussianT(double mu, double sigma2, const RNG &rng);
+    GaussianT(const GaussianT &src);
+    ~GaussianT();
 
     // assignment
-    Gaussian &operator=(const Gaussian &rhs);
+    GaussianT &operator=(const GaussianT &rhs);
 
     // get a random value
     double nextValue();
 
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
+    // N(0,1) value from the given engine
+    static double standard(RNG &rng);
+
+protected:
+    // the draw fell outside the rectangles
+    static double standardSlow(RNG &rng, int i, double u);
+
 protected:
     // data
-    int xindex_;
     double mu_;
     double sigma_;
     double sigma2_;
-    Random rng_;
+    RNG rng_;
 };
 
+// default instantiation, engine chosen at run-time
+typedef GaussianT<Random> Gaussian;
+
 }
 
+#include "distributions/Gaussian.i"
+
 #endif
@@ -0,0 +1,270 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// gaussian distribution
+//
+// F(x) closed form does not exist.
+// given X ~ N(0,1), then X' ~ N(mu,sigma2) can
+// be obtained using this relation: X' = mu + sqrt(sigma2)*X
+// so we only need to generate N(0,1).
+//
+// N(0,1) is generated with the ziggurat method (marsaglia and 
+// tsang), using doornik's variant (ZIGNOR) with 128 layers:
+//
+// 1) generate u ~ U(0,1). the top 7 bits give the layer i, the
+// rest give v in (-1,1).
+// 2) if |v| < x[i+1]/x[i], return v*x[i]. about 99% of values
+// end here, for one uniform, a multiply and a compare.
+// 3) if i is 0 (the base layer), return a value from the tail
+// beyond R: x = log(u1)/R, y = log(u2) until -2y >= x**2, and
+// return +/-(R-x).
+// 4) else x = v*x[i] is in the wedge. accept it if
+// f(x[i+1]) + u*(f(x[i])-f(x[i+1])) < f(x), with f unnormalized,
+// else go back to step 1.
+// 
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+GaussianT<RNG>::GaussianT(): 
+    BaseObject(false), 
+    mu_(0), sigma_(0), sigma2_(0), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+GaussianT<RNG>::GaussianT(double mu, double sigma2, const RNG &rng): 
+    BaseObject(false), 
+    mu_(mu), sigma_(0), sigma2_(sigma2), rng_(rng)
+{
+    sigma_ = sqrt(sigma2);
+    setOk(true);
+}
+
+template <class RNG>
+GaussianT<RNG>::GaussianT(const GaussianT<RNG> &src): 
+    BaseObject(src), 
+    mu_(src.mu_), 
+    sigma_(src.sigma_), sigma2_(src.sigma2_), rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+GaussianT<RNG>::~GaussianT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+GaussianT<RNG> &
+GaussianT<RNG>::operator=(const GaussianT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        mu_ = rhs.mu_;
+        sigma_ = rhs.sigma_;
+        sigma2_ = rhs.sigma2_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+GaussianT<RNG>::nextValue()
+{
+    return(mu_+sigma_*standard(rng_));
+}
+
+template <class RNG>
+double
+GaussianT<RNG>::standard(RNG &rng)
+{
+    const GaussianZiggurat &zig = GaussianZiggurat::tables();
+
+    double w = rng.random0to1()*GaussianZiggurat::Layers;
+    int i = int(w);
+    double u = 2*(w-i)-1;
+    if (fabs(u) < zig.r_[i])
+        return(u*zig.x_[i]);
+    return(standardSlow(rng, i, u));
+}
+
+template <class RNG>
+double
+GaussianT<RNG>::standardSlow(RNG &rng, int i, double u)
+{
+    const GaussianZiggurat &zig = GaussianZiggurat::tables();
+    const double R = GaussianZiggurat::R;
+
+    for (;;)
+    {
+        if (i == 0)
+        {
+            // tail
+            double x, y;
+            do {
+                x = log(rng.random0to1())/R;
+                y = log(rng.random0to1());
+            } while (-2*y < x*x);
+            return((u < 0) ? x-R : R-x);
+        }
+
+        // wedge
+        double x = u*zig.x_[i];
+        double f0 = exp(-0.5*(zig.x_[i]*zig.x_[i]-x*x));
+        double f1 = exp(-0.5*(zig.x_[i+1]*zig.x_[i+1]-x*x));
+        if (f1+rng.random0to1()*(f0-f1) < 1.0)
+            return(x);
+
+        // try again
+        double w = rng.random0to1()*GaussianZiggurat::Layers;
+        i = int(w);
+        u = 2*(w-i)-1;
+        if (fabs(u) < zig.r_[i])
+            return(u*zig.x_[i]);
+    }
+}
+
+// fill an array with random values
+template <class RNG>
+void
+GaussianT<RNG>::fill(double *out, size_t n)
+{
+    // blocks of uniforms are drawn first, then the rectangle test is
+    // done for the whole block in a loop without branches. the few
+    // values outside the rectangles are finished in a second pass,
+    // so the sequence differs from n calls to nextValue().
+    const GaussianZiggurat &zig = GaussianZiggurat::tables();
+    const size_t blocksize = 256;
+    unsigned char slow[blocksize];
+
+    for (size_t start=0; start<n; start+=blocksize)
+    {
+        size_t m = n-start;
+        if (m > blocksize) m = blocksize;
+        double *block = out+start;
+        rng_.fill(block, m);
+
+        for (size_t k=0; k<m; ++k)
+        {
+            double w = block[k]*GaussianZiggurat::Layers;
+            int i = int(w);
+            double u = 2*(w-i)-1;
+            slow[k] = !(fabs(u) < zig.r_[i]);
+            block[k] = slow[k] ? block[k] : mu_+sigma_*u*zig.x_[i];
+        }
+
+        for (size_t k=0; k<m; ++k)
+        {
+            if (slow[k])
+            {
+                double w = block[k]*GaussianZiggurat::Layers;
+                int i = int(w);
+                double u = 2*(w-i)-1;
+                block[k] = mu_+sigma_*standardSlow(rng_, i, u);
+            }
+        }
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+GaussianT<RNG>::pdf(double x) const
+{
+    double z = (x-mu_)/sigma_;
+    return(exp(-0.5*z*z)/(sigma_*sqrt(2*M_PI)));
+}
+
+template <class RNG>
+double
+GaussianT<RNG>::logpdf(double x) const
+{
+    double z = (x-mu_)/sigma_;
+    return(-0.5*z*z - log(sigma_) - 0.5*log(2*M_PI));
+}
+
+template <class RNG>
+double
+GaussianT<RNG>::cdf(double x) const
+{
+    return(normalCdf((x-mu_)/sigma_));
+}
+
+template <class RNG>
+double
+GaussianT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    return(mu_+sigma_*normalQuantile(p));
+}
+
+template <class RNG>
+void
+GaussianT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    const double mu = mu_;
+    const double isigma = 1.0/sigma_;
+    const double c = isigma/sqrt(2*M_PI);
+    for (size_t i=0; i<n; ++i)
+    {
+        double z = (x[i]-mu)*isigma;
+        out[i] = -0.5*z*z;
+    }
+    exponential(out, out, n);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] *= c;
+    }
+}
+
+template <class RNG>
+void
+GaussianT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    const double mu = mu_;
+    const double isigma = 1.0/sigma_;
+    const double c = -log(sigma_) - 0.5*log(2*M_PI);
+    for (size_t i=0; i<n; ++i)
+    {
+        double z = (x[i]-mu)*isigma;
+        out[i] = c - 0.5*z*z;
+    }
+}
+
+template <class RNG>
+void
+GaussianT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    const double mu = mu_;
+    const double isigma = 1.0/sigma_;
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = (x[i]-mu)*isigma;
+    }
+    normalCdf(out, out, n);
+}
+
+template <class RNG>
+void
+GaussianT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    const double mu = mu_;
+    const double sigma = sigma_;
+    normalQuantile(p, out, n);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = mu+sigma*out[i];
+    }
+}
+
+}
@@ -14,31 +14,54 @@
 #include "system/Debug.h"
 #include "atomic/BaseObject.h"
 #include "random/Random.h"
+#include "specialfunctions/SpecialFunctions.h"
 
 namespace ombt {
 
 // geometric distribution
-class Geometric: public BaseObject
+template <class RNG>
+class GeometricT: public BaseObject
 {
 public:
     // ctors and dtor
-    Geometric();
-    Geometric(double p, const Random &rng);
-    Geometric(const Geometric &src);
-    ~Geometric();
+    GeometricT();
+    GeometricT(double p, const RNG &rng);
+    GeometricT(const GeometricT &src);
+    ~GeometricT();
 
     // assignment
-    Geometric &operator=(const Geometric &rhs);
+    GeometricT &operator=(const GeometricT &rhs);
 
     // get a random value
     double nextValue();
 
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
 protected:
     // data
     double p_;
-    Random rng_;
+    RNG rng_;
 };
 
+// default instantiation, engine chosen at run-time
+typedef GeometricT<Random> Geometric;
+
 }
 
+#include "distributions/Geometric.i"
+
 #endif
@@ -0,0 +1,156 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// geometric distribution
+//
+// U in U(0,1)
+// X = ceil(log(U)/log(1-p))
+//
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+GeometricT<RNG>::GeometricT(): 
+    BaseObject(false), p_(0), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+GeometricT<RNG>::GeometricT(double p, const RNG &rng): 
+    BaseObject(false), p_(p), rng_(rng)
+{
+    setOk(true);
+}
+
+template <class RNG>
+GeometricT<RNG>::GeometricT(const GeometricT<RNG> &src): 
+    BaseObject(src), p_(src.p_), rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+GeometricT<RNG>::~GeometricT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+GeometricT<RNG> &
+GeometricT<RNG>::operator=(const GeometricT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        p_ = rhs.p_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+GeometricT<RNG>::nextValue()
+{
+    double U = rng_.random0to1();
+    double X = ceil(log(U)/log(1-p_));
+    return(X);
+}
+
+// fill an array with random values
+template <class RNG>
+void
+GeometricT<RNG>::fill(double *out, size_t n)
+{
+    rng_.fill(out, n);
+    double ilog1mp = 1/log(1-p_);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = ceil(log(out[i])*ilog1mp);
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+GeometricT<RNG>::pdf(double x) const
+{
+    if (x < 1.0 || x != floor(x)) return(0.0);
+    return(exp(logpdf(x)));
+}
+
+template <class RNG>
+double
+GeometricT<RNG>::logpdf(double x) const
+{
+    if (x < 1.0 || x != floor(x)) return(-HUGE_VAL);
+    return(log(p_) + xlog1py(x-1.0, -p_));
+}
+
+template <class RNG>
+double
+GeometricT<RNG>::cdf(double x) const
+{
+    if (x < 1.0) return(0.0);
+    return(-expm1(floor(x)*log1p(-p_)));
+}
+
+template <class RNG>
+double
+GeometricT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    if (p == 1.0) return((p_ < 1.0) ? HUGE_VAL : 1.0);
+    double k = ceil(log1p(-p)/log1p(-p_));
+    if (!(k >= 1.0)) k = 1.0;
+    if (k > 1.0 && cdf(k-1) >= p) k -= 1;
+    return(k);
+}
+
+template <class RNG>
+void
+GeometricT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = pdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+GeometricT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = logpdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+GeometricT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = cdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+GeometricT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = quantile(p[i]);
+    }
+}
+
+}
@@ -0,0 +1,146 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_INVERSE_CDF_TABLE_H
+#define __OMBT_INVERSE_CDF_TABLE_H
+
+// system headers
+#include <stdio.h>
+#include <math.h>
+#include <vector>
+#include <algorithm>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+#include "random/Random.h"
+#include "interpolation/CubicSpline.h"
+#include "interpolation/UniformCubicSpline.h"
+
+namespace ombt {
+
+// arbitrary continuous distribution by a table of its quantile
+// function, a cubic on each cell of a uniform grid of u in (0,1).
+// O(cells) quantiles to build, O(1) per value and no search.
+//
+// the table is built from a distribution, anything with quantile(),
+// cdf() and pdf(), or from points of a distribution function, such
+// as an empirical one. a table from a distribution keeps a copy of
+// it for the cells at the ends where a quantile runs off to infinity
+// or has an infinite slope, so values there are exact.
+template <class RNG>
+class InverseCDFTableT: public BaseObject
+{
+public:
+    // sizes
+    enum {
+        DefaultCells = 4096,
+        BufferSize = 256
+    };
+
+    // ctors and dtor
+    InverseCDFTableT();
+    template <class Distribution>
+    InverseCDFTableT(const Distribution &distribution, const RNG &rng,
+                     int cells = DefaultCells);
+    InverseCDFTableT(const std::vector<double> &x,
+                     const std::vector<double> &F, const RNG &rng,
+                     int cells = DefaultCells);
+    InverseCDFTableT(const InverseCDFTableT &src);
+    ~InverseCDFTableT();
+
+    // assignment
+    InverseCDFTableT &operator=(const InverseCDFTableT &rhs);
+
+    // get a random value
+    inline double nextValue() {
+        double u = rng_.random0to1();
+        if (u < lower_ || u > upper_) return(source_->quantile(u));
+        return(spline_.interpolate(u));
+    }
+
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
+    // cells in the table, and the largest difference from what it
+    // was built from at the middles of the cells it covers
+    int cells() const { return(spline_.segments()); }
+    double error() const { return(error_); }
+
+protected:
+    // the distribution a table was built from, for the end cells
+    class Source {
+    public:
+        virtual ~Source() { }
+        virtual Source *clone() const = 0;
+        virtual double quantile(double p) const = 0;
+        virtual double cdf(double x) const = 0;
+        virtual double pdf(double x) const = 0;
+    };
+    template <class Distribution>
+    class SourceOf: public Source {
+    public:
+        SourceOf(const Distribution &distribution):
+            distribution_(distribution) {
+        }
+        virtual ~SourceOf() {
+        }
+        virtual Source *clone() const {
+            return(new SourceOf(distribution_));
+        }
+        virtual double quantile(double p) const {
+            return(distribution_.quantile(p));
+        }
+        virtual double cdf(double x) const {
+            return(distribution_.cdf(x));
+        }
+        virtual double pdf(double x) const {
+            return(distribution_.pdf(x));
+        }
+
+    protected:
+        Distribution distribution_;
+    };
+
+    // utilities
+    void build(std::vector<double> &q, std::vector<double> &dq,
+               int first, int last);
+    double invert(double x, int cell) const;
+
+protected:
+    // data
+    UniformCubicSpline<double> spline_;
+    std::vector<double> values_;
+    int first_;
+    int last_;
+    double lower_;
+    double upper_;
+    double error_;
+    Source *source_;
+    RNG rng_;
+};
+
+// default instantiation, engine chosen at run-time
+typedef InverseCDFTableT<Random> InverseCDFTable;
+
+}
+
+#include "distributions/InverseCDFTable.i"
+
+#endif
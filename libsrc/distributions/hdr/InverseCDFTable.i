@@ -0,0 +1,404 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// arbitrary continuous distribution, inverse cdf table
+//
+// X = Q(U), U in (0,1), for the quantile function Q = F^-1.
+// the grid is u(i) = i/n, i = 0 to n, and Q is a hermite cubic on
+// each cell, matching Q and Q' = 1/f(Q) at the knots. Q is
+// increasing, so the slopes are limited as in fritsch and carlson,
+// "monotone piecewise cubic interpolation", siam j. numer. anal.
+// 1980, and the table is increasing too. a value is the cubic of
+// cell floor(n*U) at the fraction n*U-floor(n*U).
+//
+// from points (x, F(x)) the quantile is first a CubicSpline through
+// (F, x), kept between the points on either side, then tabulated
+// the same way.
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+InverseCDFTableT<RNG>::InverseCDFTableT(): 
+    BaseObject(false), spline_(), values_(), first_(0), last_(-1),
+    lower_(0.0), upper_(1.0), error_(0.0), source_(NULL), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+template <class Distribution>
+InverseCDFTableT<RNG>::InverseCDFTableT(
+    const Distribution &distribution, const RNG &rng, int cells): 
+        BaseObject(false), spline_(), values_(), first_(0), last_(-1),
+        lower_(0.0), upper_(1.0), error_(0.0), source_(NULL), rng_(rng)
+{
+    if (cells < 4)
+    {
+        setOk(false);
+        return;
+    }
+
+    // knots 0 and n are left to the distribution
+    int n = cells;
+    std::vector<double> q(n+1);
+    std::vector<double> dq(n+1);
+    for (int i=1; i<n; ++i)
+    {
+        q[i] = distribution.quantile(double(i)/n);
+        if (!isfinite(q[i]))
+        {
+            setOk(false);
+            return;
+        }
+        double f = distribution.pdf(q[i]);
+        dq[i] = (f > 0.0 && isfinite(1.0/f)) ? 1.0/f : NAN;
+    }
+    build(q, dq, 1, n-1);
+
+    // near an end a quantile often has a pole or an infinite slope,
+    // and the error of a cubic there is the same size whatever the
+    // cells. those cells, up to 1/64 of the table at each end, are
+    // left to the distribution until the error is below 1/10000 of
+    // the width of the cell.
+    std::vector<double> e(n, 0.0);
+    for (int i=1; i<n-1; ++i)
+    {
+        double u = (i+0.5)/n;
+        e[i] = fabs(spline_.interpolate(u)-distribution.quantile(u));
+    }
+    int ends = std::max(n/64, 1);
+    int first = 1;
+    while (first < ends && e[first] > 1.0e-4*(q[first+1]-q[first])) 
+        ++first;
+    int last = n-2;
+    while (last > n-1-ends && e[last] > 1.0e-4*(q[last+1]-q[last])) 
+        --last;
+    for (int i=first; i<=last; ++i)
+    {
+        error_ = std::max(error_, e[i]);
+    }
+
+    source_ = new SourceOf<Distribution>(distribution);
+    first_ = first;
+    last_ = last;
+    lower_ = spline_.knot(first);
+    upper_ = spline_.knot(last+1);
+    setOk(true);
+}
+
+template <class RNG>
+InverseCDFTableT<RNG>::InverseCDFTableT(
+    const std::vector<double> &x, const std::vector<double> &F, 
+    const RNG &rng, int cells): 
+        BaseObject(false), spline_(), values_(), first_(0), last_(-1),
+        lower_(0.0), upper_(1.0), error_(0.0), source_(NULL), rng_(rng)
+{
+    size_t k = x.size();
+    if (cells < 1 || k < 2 || F.size() != k || 
+        !(F[k-1] > F[0]) || !isfinite(F[k-1]-F[0]))
+    {
+        setOk(false);
+        return;
+    }
+    for (size_t j=1; j<k; ++j)
+    {
+        if (!(x[j] > x[j-1]) || !(F[j] >= F[j-1]))
+        {
+            setOk(false);
+            return;
+        }
+    }
+
+    // F scaled to 0 to 1, keeping points where it goes up
+    std::vector<double> ps(1, 0.0);
+    std::vector<double> xs(1, x[0]);
+    double range = F[k-1]-F[0];
+    for (size_t j=1; j<k; ++j)
+    {
+        double p = (j == k-1) ? 1.0 : (F[j]-F[0])/range;
+        if (p <= ps.back()) continue;
+        ps.push_back(p);
+        xs.push_back(x[j]);
+    }
+    CubicSpline<double> quantile(ps, xs);
+
+    // the spline at the knots and the middles of the cells
+    int n = cells;
+    std::vector<double> q(n+1);
+    std::vector<double> dq(n+1);
+    std::vector<double> middle(n);
+    size_t j = 0;
+    for (int i=0; i<=2*n; ++i)
+    {
+        double u = 0.5*i/n;
+        while (j+2 < ps.size() && ps[j+1] <= u) ++j;
+        double y = quantile.interpolate(u);
+        y = std::min(std::max(y, xs[j]), xs[j+1]);
+        if (i%2 != 0)
+        {
+            middle[i/2] = y;
+            continue;
+        }
+        q[i/2] = y;
+        dq[i/2] = quantile.derivative(u);
+    }
+    build(q, dq, 0, n);
+
+    first_ = 0;
+    last_ = n-1;
+    for (int i=0; i<n; ++i)
+    {
+        error_ = std::max(error_, 
+            fabs(spline_.interpolate((i+0.5)/n)-middle[i]));
+    }
+    setOk(true);
+}
+
+template <class RNG>
+InverseCDFTableT<RNG>::InverseCDFTableT(const InverseCDFTableT<RNG> &src): 
+    BaseObject(src), spline_(src.spline_), values_(src.values_),
+    first_(src.first_), last_(src.last_), lower_(src.lower_),
+    upper_(src.upper_), error_(src.error_),
+    source_((src.source_ != NULL) ? src.source_->clone() : NULL), 
+    rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+InverseCDFTableT<RNG>::~InverseCDFTableT()
+{
+    delete source_;
+    source_ = NULL;
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+InverseCDFTableT<RNG> &
+InverseCDFTableT<RNG>::operator=(const InverseCDFTableT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        spline_ = rhs.spline_;
+        values_ = rhs.values_;
+        first_ = rhs.first_;
+        last_ = rhs.last_;
+        lower_ = rhs.lower_;
+        upper_ = rhs.upper_;
+        error_ = rhs.error_;
+        delete source_;
+        source_ = (rhs.source_ != NULL) ? rhs.source_->clone() : NULL;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// the table from quantiles and their slopes at knots first to last.
+// unknown slopes are nan. knots outside are copies, never used.
+template <class RNG>
+void
+InverseCDFTableT<RNG>::build(std::vector<double> &q, 
+                             std::vector<double> &dq, int first, int last)
+{
+    int n = int(q.size())-1;
+
+    for (int i=first+1; i<=last; ++i)
+    {
+        q[i] = std::max(q[i], q[i-1]);
+    }
+    for (int i=first; i<=last; ++i)
+    {
+        if (isfinite(dq[i])) continue;
+        int lo = (i > first) ? i-1 : i;
+        int hi = (i < last) ? i+1 : i;
+        dq[i] = (q[hi]-q[lo])*n/(hi-lo);
+    }
+
+    // fritsch-carlson: no negative slopes, and within the circle
+    // of radius 3 in units of the slope of the cell
+    for (int i=first; i<last; ++i)
+    {
+        double delta = (q[i+1]-q[i])*n;
+        if (delta <= 0.0)
+        {
+            dq[i] = 0.0;
+            dq[i+1] = 0.0;
+            continue;
+        }
+        double a = std::max(dq[i], 0.0)/delta;
+        double b = std::max(dq[i+1], 0.0)/delta;
+        double s = a*a+b*b;
+        double t = (s > 9.0) ? 3.0/sqrt(s) : 1.0;
+        dq[i] = t*a*delta;
+        dq[i+1] = t*b*delta;
+    }
+
+    for (int i=0; i<first; ++i)
+    {
+        q[i] = q[first];
+        dq[i] = 0.0;
+    }
+    for (int i=last+1; i<=n; ++i)
+    {
+        q[i] = q[last];
+        dq[i] = 0.0;
+    }
+
+    spline_.hermite(0.0, 1.0, n+1, &q[0], &dq[0]);
+    values_ = q;
+}
+
+// u in cell with Q(u) = x, safeguarded newton
+template <class RNG>
+double
+InverseCDFTableT<RNG>::invert(double x, int cell) const
+{
+    int n = cells();
+    double lo = spline_.knot(cell);
+    double hi = spline_.knot(cell+1);
+    double span = values_[cell+1]-values_[cell];
+    if (!(span > 0.0)) return(hi);
+
+    double u = lo+(hi-lo)*(x-values_[cell])/span;
+    for (int iteration=0; iteration<64; ++iteration)
+    {
+        double f = spline_.interpolate(u)-x;
+        if (f == 0.0) break;
+        if (f > 0.0)
+            hi = u;
+        else
+            lo = u;
+        double d = spline_.derivative(u);
+        double next = (d > 0.0) ? u-f/d : lo-1.0;
+        if (!(next > lo && next < hi)) next = 0.5*(lo+hi);
+        if (fabs(next-u) <= 1.0e-15/n) 
+        {
+            u = next;
+            break;
+        }
+        u = next;
+    }
+    return(u);
+}
+
+// fill an array with random values
+template <class RNG>
+void
+InverseCDFTableT<RNG>::fill(double *out, size_t n)
+{
+    // uniforms a buffer at a time, then the branch-free table
+    // lookup, then the few values from the end cells if any.
+    double u[BufferSize];
+    for (size_t k=0; k<n; k+=BufferSize)
+    {
+        size_t m = std::min(n-k, size_t(BufferSize));
+        rng_.fill(u, m);
+        spline_.interpolate(int(m), u, out+k);
+        if (source_ == NULL) continue;
+        for (size_t i=0; i<m; ++i)
+        {
+            if (u[i] < lower_ || u[i] > upper_) 
+                out[k+i] = source_->quantile(u[i]);
+        }
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+InverseCDFTableT<RNG>::pdf(double x) const
+{
+    if (source_ != NULL && (x < values_[first_] || x > values_[last_+1]))
+        return(source_->pdf(x));
+    if (x < values_[first_] || x > values_[last_+1]) return(0.0);
+    double d = spline_.derivative(cdf(x));
+    return((d > 0.0) ? 1.0/d : HUGE_VAL);
+}
+
+template <class RNG>
+double
+InverseCDFTableT<RNG>::logpdf(double x) const
+{
+    return(log(pdf(x)));
+}
+
+template <class RNG>
+double
+InverseCDFTableT<RNG>::cdf(double x) const
+{
+    if (source_ != NULL && (x < values_[first_] || x > values_[last_+1]))
+        return(source_->cdf(x));
+    if (x < values_[first_]) return(0.0);
+    if (x >= values_[last_+1]) return(1.0);
+    int cell = int(std::upper_bound(values_.begin(), values_.end(), x) -
+                   values_.begin())-1;
+    cell = std::min(std::max(cell, first_), last_);
+    return(invert(x, cell));
+}
+
+template <class RNG>
+double
+InverseCDFTableT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    if (p < lower_ || p > upper_) return(source_->quantile(p));
+    return(spline_.interpolate(p));
+}
+
+template <class RNG>
+void
+InverseCDFTableT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = pdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+InverseCDFTableT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = logpdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+InverseCDFTableT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = cdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+InverseCDFTableT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    // a buffer at a time, so out may be p
+    double u[BufferSize];
+    for (size_t k=0; k<n; k+=BufferSize)
+    {
+        size_t m = std::min(n-k, size_t(BufferSize));
+        std::copy(p+k, p+k+m, u);
+        spline_.interpolate(int(m), u, out+k);
+        for (size_t i=0; i<m; ++i)
+        {
+            if (u[i] < 0.0 || u[i] > 1.0) 
+                out[k+i] = NAN;
+            else if (u[i] < lower_ || u[i] > upper_) 
+                out[k+i] = source_->quantile(u[i]);
+        }
+    }
+}
+
+}
@@ -16,32 +16,57 @@
 #include "atomic/BaseObject.h"
 #include "atomic/ExtUseCntPtr.h"
 #include "distributions/Gaussian.h"
+#include "specialfunctions/SpecialFunctions.h"
 
 namespace ombt {
 
 // lognormal distribution
-class LogNormal: public BaseObject
+template <class RNG>
+class LogNormalT: public BaseObject
 {
 public:
     // ctors and dtor
-    LogNormal();
-    LogNormal(double muln, double sigmaln2, const Random &rng);
-    LogNormal(const LogNormal &src);
-    ~LogNormal();
+    LogNormalT();
+    LogNormalT(double muln, double sigmaln2, const RNG &rng);
+    LogNormalT(const LogNormalT &src);
+    ~LogNormalT();
 
     // assignment
-    LogNormal &operator=(const LogNormal &rhs);
+    LogNormalT &operator=(const LogNormalT &rhs);
 
     // get a random value
     double nextValue();
 
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
 protected:
     // data
     double muln_;
     double sigmaln2_;
-    ExtUseCntPtr<Gaussian> pgrng_;
+    double mu_;
+    double sigma_;
+    ExtUseCntPtr<GaussianT<RNG> > pgrng_;
 };
 
+// default instantiation, engine chosen at run-time
+typedef LogNormalT<Random> LogNormal;
+
 }
 
+#include "distributions/LogNormal.i"
+
 #endif
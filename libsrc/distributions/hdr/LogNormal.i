@@ -0,0 +1,186 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// lognormal distribution
+//
+// 1) calculate mu, sigma2 from the lognormal
+// muln, sigmaln2 as follows:
+// mu = log(muln**2/sqrt(sigmaln2+muln**2))
+// sigma2 = log((sigmaln2+muln**2)/muln**2)
+// 2) generate y ~ N(mu, sigma2).
+// 3) return x = exp(y).
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+LogNormalT<RNG>::LogNormalT(): 
+    BaseObject(false),
+    muln_(0), sigmaln2_(0), mu_(0), sigma_(0), pgrng_(NULL)
+{
+    setOk(false);
+}
+
+template <class RNG>
+LogNormalT<RNG>::LogNormalT(double muln, double sigmaln2, const RNG &rng): 
+    BaseObject(false), 
+    muln_(muln), sigmaln2_(sigmaln2), mu_(0), sigma_(0), pgrng_(NULL)
+{
+    mu_ = log(muln*muln/sqrt(sigmaln2+muln*muln));
+    sigma_ = sqrt(log((sigmaln2+muln*muln)/(muln*muln)));
+    pgrng_ = new GaussianT<RNG>(mu_, sigma_*sigma_, rng);
+    setOk(true);
+}
+
+template <class RNG>
+LogNormalT<RNG>::LogNormalT(const LogNormalT<RNG> &src): 
+    BaseObject(src), 
+    muln_(src.muln_), sigmaln2_(src.sigmaln2_), 
+    mu_(src.mu_), sigma_(src.sigma_), pgrng_(src.pgrng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+LogNormalT<RNG>::~LogNormalT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+LogNormalT<RNG> &
+LogNormalT<RNG>::operator=(const LogNormalT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        muln_ = rhs.muln_;
+        sigmaln2_ = rhs.sigmaln2_;
+        mu_ = rhs.mu_;
+        sigma_ = rhs.sigma_;
+        pgrng_ = rhs.pgrng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+LogNormalT<RNG>::nextValue()
+{
+    double y = pgrng_->nextValue();
+    return(exp(y));
+}
+
+// fill an array with random values
+template <class RNG>
+void
+LogNormalT<RNG>::fill(double *out, size_t n)
+{
+    // normals first, then a branch-free exp() the compiler
+    // can vectorize.
+    pgrng_->fill(out, n);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = exp(out[i]);
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+LogNormalT<RNG>::pdf(double x) const
+{
+    return((x <= 0.0) ? 0.0 : exp(logpdf(x)));
+}
+
+template <class RNG>
+double
+LogNormalT<RNG>::logpdf(double x) const
+{
+    if (x <= 0.0) return(-HUGE_VAL);
+    double lx = log(x);
+    double z = (lx-mu_)/sigma_;
+    return(-0.5*z*z - lx - log(sigma_) - 0.5*log(2*M_PI));
+}
+
+template <class RNG>
+double
+LogNormalT<RNG>::cdf(double x) const
+{
+    return((x <= 0.0) ? 0.0 : normalCdf((log(x)-mu_)/sigma_));
+}
+
+template <class RNG>
+double
+LogNormalT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    return(exp(mu_+sigma_*normalQuantile(p)));
+}
+
+template <class RNG>
+void
+LogNormalT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    logpdf(x, out, n);
+    exponential(out, out, n);
+}
+
+template <class RNG>
+void
+LogNormalT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    const double mu = mu_;
+    const double isigma = 1.0/sigma_;
+    const double c = -log(sigma_) - 0.5*log(2*M_PI);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = (x[i] <= 0.0) ? 0.0 : x[i];
+    }
+    logarithm(out, out, n);
+    for (size_t i=0; i<n; ++i)
+    {
+        double lx = out[i];
+        double z = (lx-mu)*isigma;
+        double f = c - lx - 0.5*z*z;
+        out[i] = (lx == -HUGE_VAL) ? -HUGE_VAL : f;
+    }
+}
+
+template <class RNG>
+void
+LogNormalT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    const double mu = mu_;
+    const double isigma = 1.0/sigma_;
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = (x[i] <= 0.0) ? 0.0 : x[i];
+    }
+    logarithm(out, out, n);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = (out[i]-mu)*isigma;
+    }
+    normalCdf(out, out, n);
+}
+
+template <class RNG>
+void
+LogNormalT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    const double mu = mu_;
+    const double sigma = sigma_;
+    normalQuantile(p, out, n);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = mu+sigma*out[i];
+    }
+    exponential(out, out, n);
+}
+
+}
@@ -0,0 +1,86 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_MULTIVARIATE_GAUSSIAN_H
+#define __OMBT_MULTIVARIATE_GAUSSIAN_H
+
+// system headers
+#include <stdio.h>
+#include <math.h>
+#include <vector>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+#include "random/Random.h"
+#include "matrix/Matrix.h"
+#include "matrix/Cholesky.h"
+#include "distributions/Gaussian.h"
+
+namespace ombt {
+
+// multivariate gaussian distribution. the values are vectors of
+// dimension() doubles, and arrays of them are stored one vector
+// after the other.
+template <class RNG>
+class MultivariateGaussianT: public BaseObject
+{
+public:
+    // vectors transformed together
+    enum { BlockSize = 256 };
+
+    // ctors and dtor
+    MultivariateGaussianT();
+    MultivariateGaussianT(const std::vector<double> &mu, 
+                          const Matrix<double> &covariance, const RNG &rng);
+    MultivariateGaussianT(const MultivariateGaussianT &src);
+    ~MultivariateGaussianT();
+
+    // assignment
+    MultivariateGaussianT &operator=(const MultivariateGaussianT &rhs);
+
+    // dimension of the vectors
+    size_t dimension() const { return(dimension_); }
+
+    // get a random vector
+    void nextValue(double *x);
+
+    // fill an array with n random vectors
+    void fill(double *out, size_t n);
+
+    // density and its log at a vector
+    double pdf(const double *x) const;
+    double logpdf(const double *x) const;
+
+    // the same over an array of n vectors
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+
+protected:
+    // out = mu + L*z for m vectors
+    void transform(const double *z, double *out, size_t m) const;
+
+    // log density, with y as scratch space
+    double logpdf(const double *x, double *y) const;
+
+protected:
+    // data
+    size_t dimension_;
+    std::vector<double> mu_;
+    std::vector<double> factor_;
+    double logconstant_;
+    std::vector<double> block_;
+    GaussianT<RNG> normal_;
+};
+
+// default instantiation, engine chosen at run-time
+typedef MultivariateGaussianT<Random> MultivariateGaussian;
+
+}
+
+#include "distributions/MultivariateGaussian.i"
+
+#endif
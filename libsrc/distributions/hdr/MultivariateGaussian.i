@@ -0,0 +1,243 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// multivariate gaussian distribution
+//
+// given the covariance C = L*L' (cholesky) and Z a vector of
+// independent N(0,1) values, X = mu + L*Z ~ N(mu, C).
+//
+// L is found once, in the ctor, and kept as a dense row-major
+// lower triangle. fill() draws the normals for BlockSize vectors
+// at a time into a scratch block, and turns the whole block into
+// vectors with one triangular matrix product, four vectors per
+// pass over L, so no memory is allocated per vector.
+//
+// the density is
+//
+// log f(x) = -d/2 log(2 pi) - sum log l(i,i) - |y|**2/2, L*y = x-mu.
+//
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+MultivariateGaussianT<RNG>::MultivariateGaussianT():
+    BaseObject(false),
+    dimension_(0), mu_(), factor_(), logconstant_(0), block_(), normal_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+MultivariateGaussianT<RNG>::MultivariateGaussianT(
+    const std::vector<double> &mu, const Matrix<double> &covariance,
+    const RNG &rng):
+    BaseObject(false),
+    dimension_(mu.size()), mu_(mu), factor_(), logconstant_(0),
+    block_(), normal_(0.0, 1.0, rng)
+{
+    Matrix<double> l(covariance);
+    if (dimension_ == 0 || l.getRows() != dimension_ ||
+        l.getCols() != dimension_ || Cholesky(l, 0.0) != OK)
+    {
+        setOk(false);
+        return;
+    }
+
+    const size_t d = dimension_;
+    factor_.resize(d*d);
+    logconstant_ = -0.5*d*log(2*M_PI);
+    for (size_t r=0; r<d; ++r)
+    {
+        for (size_t c=0; c<d; ++c)
+        {
+            factor_[r*d+c] = l(r, c);
+        }
+        logconstant_ -= log(l(r, r));
+    }
+    block_.resize(BlockSize*d);
+    setOk(true);
+}
+
+template <class RNG>
+MultivariateGaussianT<RNG>::MultivariateGaussianT(
+    const MultivariateGaussianT<RNG> &src):
+    BaseObject(src),
+    dimension_(src.dimension_), mu_(src.mu_), factor_(src.factor_),
+    logconstant_(src.logconstant_), block_(src.block_),
+    normal_(src.normal_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+MultivariateGaussianT<RNG>::~MultivariateGaussianT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+MultivariateGaussianT<RNG> &
+MultivariateGaussianT<RNG>::operator=(const MultivariateGaussianT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        dimension_ = rhs.dimension_;
+        mu_ = rhs.mu_;
+        factor_ = rhs.factor_;
+        logconstant_ = rhs.logconstant_;
+        block_ = rhs.block_;
+        normal_ = rhs.normal_;
+    }
+    return(*this);
+}
+
+// get a vector
+template <class RNG>
+void
+MultivariateGaussianT<RNG>::nextValue(double *x)
+{
+    MustBeTrue(isOk());
+    normal_.fill(&block_[0], dimension_);
+    transform(&block_[0], x, 1);
+}
+
+// fill an array with random vectors
+template <class RNG>
+void
+MultivariateGaussianT<RNG>::fill(double *out, size_t n)
+{
+    MustBeTrue(isOk());
+    const size_t d = dimension_;
+    for (size_t start=0; start<n; start+=BlockSize)
+    {
+        size_t m = n-start;
+        if (m > BlockSize) m = BlockSize;
+        normal_.fill(&block_[0], m*d);
+        transform(&block_[0], out+start*d, m);
+    }
+}
+
+// out = mu + L*z, vector by vector. z and out must not overlap.
+template <class RNG>
+void
+MultivariateGaussianT<RNG>::transform(const double *z, double *out,
+                                      size_t m) const
+{
+    const size_t d = dimension_;
+    const double *l = &factor_[0];
+    const double *mu = &mu_[0];
+
+    size_t i = 0;
+    for ( ; i+4<=m; i+=4)
+    {
+        const double *z0 = z+i*d;
+        const double *z1 = z0+d;
+        const double *z2 = z1+d;
+        const double *z3 = z2+d;
+        double *o0 = out+i*d;
+        double *o1 = o0+d;
+        double *o2 = o1+d;
+        double *o3 = o2+d;
+        for (size_t r=0; r<d; ++r)
+        {
+            const double *lr = l+r*d;
+            double s0 = mu[r];
+            double s1 = mu[r];
+            double s2 = mu[r];
+            double s3 = mu[r];
+            for (size_t c=0; c<=r; ++c)
+            {
+                double lrc = lr[c];
+                s0 += lrc*z0[c];
+                s1 += lrc*z1[c];
+                s2 += lrc*z2[c];
+                s3 += lrc*z3[c];
+            }
+            o0[r] = s0;
+            o1[r] = s1;
+            o2[r] = s2;
+            o3[r] = s3;
+        }
+    }
+    for ( ; i<m; ++i)
+    {
+        const double *zi = z+i*d;
+        double *oi = out+i*d;
+        for (size_t r=0; r<d; ++r)
+        {
+            const double *lr = l+r*d;
+            double s = mu[r];
+            for (size_t c=0; c<=r; ++c)
+            {
+                s += lr[c]*zi[c];
+            }
+            oi[r] = s;
+        }
+    }
+}
+
+// density
+template <class RNG>
+double
+MultivariateGaussianT<RNG>::logpdf(const double *x, double *y) const
+{
+    const size_t d = dimension_;
+    const double *l = &factor_[0];
+    double q = 0.0;
+    for (size_t r=0; r<d; ++r)
+    {
+        const double *lr = l+r*d;
+        double s = x[r]-mu_[r];
+        for (size_t c=0; c<r; ++c)
+        {
+            s -= lr[c]*y[c];
+        }
+        y[r] = s/lr[r];
+        q += y[r]*y[r];
+    }
+    return(logconstant_ - 0.5*q);
+}
+
+template <class RNG>
+double
+MultivariateGaussianT<RNG>::pdf(const double *x) const
+{
+    return(exp(logpdf(x)));
+}
+
+template <class RNG>
+double
+MultivariateGaussianT<RNG>::logpdf(const double *x) const
+{
+    MustBeTrue(isOk());
+    std::vector<double> y(dimension_);
+    return(logpdf(x, &y[0]));
+}
+
+template <class RNG>
+void
+MultivariateGaussianT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    logpdf(x, out, n);
+    exponential(out, out, n);
+}
+
+template <class RNG>
+void
+MultivariateGaussianT<RNG>::logpdf(const double *x, double *out,
+                                   size_t n) const
+{
+    MustBeTrue(isOk());
+    std::vector<double> y(dimension_);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = logpdf(x+i*dimension_, &y[0]);
+    }
+}
+
+}
@@ -10,6 +10,7 @@
 #include <stdio.h>
 #include <math.h>
 #include <vector>
+#include <algorithm>
 
 // local headers
 #include "system/Returns.h"
@@ -20,27 +21,49 @@
 namespace ombt {
 
 // arbitrary discrete distribution - naive implementation
-class NaiveArbitraryDiscrete: public BaseObject
+template <class RNG>
+class NaiveArbitraryDiscreteT: public BaseObject
 {
 public:
     // ctors and dtor
-    NaiveArbitraryDiscrete();
-    NaiveArbitraryDiscrete(const std::vector<double> &mass, const Random &rng);
-    NaiveArbitraryDiscrete(const NaiveArbitraryDiscrete &src);
-    ~NaiveArbitraryDiscrete();
+    NaiveArbitraryDiscreteT();
+    NaiveArbitraryDiscreteT(const std::vector<double> &mass, const RNG &rng);
+    NaiveArbitraryDiscreteT(const NaiveArbitraryDiscreteT &src);
+    ~NaiveArbitraryDiscreteT();
 
     // assignment
-    NaiveArbitraryDiscrete &operator=(const NaiveArbitraryDiscrete &rhs);
+    NaiveArbitraryDiscreteT &operator=(const NaiveArbitraryDiscreteT &rhs);
 
     // get a random value
     double nextValue();
 
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
 protected:
     // data
     std::vector<double> dist_;
-    Random rng_;
+    RNG rng_;
 };
 
+// default instantiation, engine chosen at run-time
+typedef NaiveArbitraryDiscreteT<Random> NaiveArbitraryDiscrete;
+
 }
 
+#include "distributions/NaiveArbitraryDiscrete.i"
+
 #endif
@@ -0,0 +1,166 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// arbitrary discrete distribution
+//
+// p(0), p(1), p(2), ..., p(n)
+// choose U in (0,1), then return X=I where:
+// sum from j=0 to j=I-1 of p(j) <= U < sum from j=0 to I of p(j)
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+NaiveArbitraryDiscreteT<RNG>::NaiveArbitraryDiscreteT(): 
+    BaseObject(false), dist_(), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+NaiveArbitraryDiscreteT<RNG>::NaiveArbitraryDiscreteT(
+    const std::vector<double> &mass, const RNG &rng): 
+        BaseObject(false), dist_(), rng_(rng)
+{
+    long distsize = mass.size() + 1;
+    dist_.resize(distsize);
+    dist_[0] = 0.0;
+    for (int i=1; i<distsize; ++i)
+    {
+        dist_[i] = dist_[i-1] + mass[i-1];
+    }
+    setOk(true);
+}
+
+template <class RNG>
+NaiveArbitraryDiscreteT<RNG>::NaiveArbitraryDiscreteT(
+    const NaiveArbitraryDiscreteT<RNG> &src): 
+        BaseObject(src), dist_(src.dist_), rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+NaiveArbitraryDiscreteT<RNG>::~NaiveArbitraryDiscreteT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+NaiveArbitraryDiscreteT<RNG> &
+NaiveArbitraryDiscreteT<RNG>::operator=(const NaiveArbitraryDiscreteT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        dist_ = rhs.dist_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+NaiveArbitraryDiscreteT<RNG>::nextValue()
+{
+    // very naive way 
+    double U = rng_.random0to1();
+    long I;
+    for (I=dist_.size()-1; I>=0 && U<=dist_[I]; --I) ;
+    return(I+1);
+}
+
+// fill an array with random values
+template <class RNG>
+void
+NaiveArbitraryDiscreteT<RNG>::fill(double *out, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = nextValue();
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+NaiveArbitraryDiscreteT<RNG>::pdf(double x) const
+{
+    long k = dist_.size()-1;
+    if (x < 1.0 || x > k || x != floor(x)) return(0.0);
+    long I = long(x);
+    return(dist_[I]-dist_[I-1]);
+}
+
+template <class RNG>
+double
+NaiveArbitraryDiscreteT<RNG>::logpdf(double x) const
+{
+    return(log(pdf(x)));
+}
+
+template <class RNG>
+double
+NaiveArbitraryDiscreteT<RNG>::cdf(double x) const
+{
+    long k = dist_.size()-1;
+    if (x < 1.0) return(0.0);
+    if (x >= k) return(dist_[k]);
+    return(dist_[long(x)]);
+}
+
+template <class RNG>
+double
+NaiveArbitraryDiscreteT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    long k = dist_.size()-1;
+    long I = std::lower_bound(dist_.begin()+1, dist_.end(), p)-dist_.begin();
+    return((I > k) ? k : I);
+}
+
+template <class RNG>
+void
+NaiveArbitraryDiscreteT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = pdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+NaiveArbitraryDiscreteT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = logpdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+NaiveArbitraryDiscreteT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = cdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+NaiveArbitraryDiscreteT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = quantile(p[i]);
+    }
+}
+
+}
@@ -11,32 +11,58 @@
 #include "system/Debug.h"
 #include "atomic/BaseObject.h"
 #include "random/Random.h"
-#include "distributions/Geometric.h"
+#include "specialfunctions/SpecialFunctions.h"
+#include "distributions/Gamma.h"
+#include "distributions/Poisson.h"
 
 namespace ombt {
 
 // negative binomial distribution
-class NegativeBinomial: public BaseObject
+template <class RNG>
+class NegativeBinomialT: public BaseObject
 {
 public:
     // ctors and dtor
-    NegativeBinomial();
-    NegativeBinomial(double p, unsigned long n, const Random &rng);
-    NegativeBinomial(const NegativeBinomial &src);
-    ~NegativeBinomial();
+    NegativeBinomialT();
+    NegativeBinomialT(double p, unsigned long n, const RNG &rng);
+    NegativeBinomialT(const NegativeBinomialT &src);
+    ~NegativeBinomialT();
 
     // assignment
-    NegativeBinomial &operator=(const NegativeBinomial &rhs);
+    NegativeBinomialT &operator=(const NegativeBinomialT &rhs);
 
     // get a random value
     double nextValue();
 
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
 protected:
     // data
+    double p_;
     unsigned long n_;
-    Geometric grng_;
+    double scale_;
+    RNG rng_;
 };
 
+// default instantiation, engine chosen at run-time
+typedef NegativeBinomialT<Random> NegativeBinomial;
+
 }
 
+#include "distributions/NegativeBinomial.i"
+
 #endif
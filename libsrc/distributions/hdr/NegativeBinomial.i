@@ -0,0 +1,177 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// negative binomial distribution
+//
+// X is the number of trials up to and including the n-th success,
+// the sum of n geometric values. the n*(1-p)/p expected failures
+// are drawn as a gamma-poisson mixture instead of one geometric 
+// value per success:
+//
+// 1) generate L ~ gamma(n, (1-p)/p).
+// 2) generate F ~ poisson(L).
+// 3) return X = n + F.
+//
+// so the cost per value does not depend on n.
+//
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+NegativeBinomialT<RNG>::NegativeBinomialT(): 
+    BaseObject(false), p_(0), n_(0), scale_(0), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+NegativeBinomialT<RNG>::NegativeBinomialT(double p, unsigned long n, const RNG &rng): 
+    BaseObject(false), p_(p), n_(n), scale_(0), rng_(rng)
+{
+    MustBeTrue(0.0 < p && p <= 1.0);
+    scale_ = (1.0-p)/p;
+    setOk(true);
+}
+
+template <class RNG>
+NegativeBinomialT<RNG>::NegativeBinomialT(const NegativeBinomialT<RNG> &src): 
+    BaseObject(src), 
+    p_(src.p_), n_(src.n_), scale_(src.scale_), rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+NegativeBinomialT<RNG>::~NegativeBinomialT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+NegativeBinomialT<RNG> &
+NegativeBinomialT<RNG>::operator=(const NegativeBinomialT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        p_ = rhs.p_;
+        n_ = rhs.n_;
+        scale_ = rhs.scale_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+NegativeBinomialT<RNG>::nextValue()
+{
+    if (n_ == 0) return(0);
+    double L = scale_*GammaT<RNG>::standard(rng_, n_);
+    return(n_+PoissonT<RNG>::value(rng_, L));
+}
+
+// fill an array with random values
+template <class RNG>
+void
+NegativeBinomialT<RNG>::fill(double *out, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = nextValue();
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+NegativeBinomialT<RNG>::pdf(double x) const
+{
+    if (x < n_ || x != floor(x)) return(0.0);
+    return(exp(logpdf(x)));
+}
+
+template <class RNG>
+double
+NegativeBinomialT<RNG>::logpdf(double x) const
+{
+    if (x < n_ || x != floor(x)) return(-HUGE_VAL);
+    if (n_ == 0) return(0.0);
+    double n = n_;
+    double f = x-n;
+    return(logGamma(x) - logGamma(n) - logGamma(f+1) +
+           n*log(p_) + xlog1py(f, -p_));
+}
+
+template <class RNG>
+double
+NegativeBinomialT<RNG>::cdf(double x) const
+{
+    if (x < n_) return(0.0);
+    if (n_ == 0 || p_ >= 1.0) return(1.0);
+    return(betaI(n_, floor(x)-n_+1, p_));
+}
+
+template <class RNG>
+double
+NegativeBinomialT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    double n = n_;
+    if (p == 1.0) return((n_ > 0 && p_ < 1.0) ? HUGE_VAL : n);
+    double mean = n/p_;
+    double sd = sqrt(n*(1.0-p_))/p_;
+    double k = floor(mean+sd*normalQuantile(p));
+    if (!(k >= n)) k = n;
+    if (k > HUGE_VAL) k = HUGE_VAL;
+    while (k < HUGE_VAL && cdf(k) < p) k += 1;
+    while (k > n && cdf(k-1) >= p) k -= 1;
+    return(k);
+}
+
+template <class RNG>
+void
+NegativeBinomialT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = pdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+NegativeBinomialT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = logpdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+NegativeBinomialT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = cdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+NegativeBinomialT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = quantile(p[i]);
+    }
+}
+
+}
@@ -14,34 +14,57 @@
 #include "system/Returns.h"
 #include "system/Debug.h"
 #include "atomic/BaseObject.h"
-#include "atomic/ExtUseCntPtr.h"
 #include "distributions/Gamma.h"
+#include "specialfunctions/SpecialFunctions.h"
 
 namespace ombt {
 
 // pearson type V distribution
-class PearsonTypeV: public BaseObject
+template <class RNG>
+class PearsonTypeVT: public BaseObject
 {
 public:
     // ctors and dtor
-    PearsonTypeV();
-    PearsonTypeV(double alpha, double beta, const Random &rng);
-    PearsonTypeV(const PearsonTypeV &src);
-    ~PearsonTypeV();
+    PearsonTypeVT();
+    PearsonTypeVT(double alpha, double beta, const RNG &rng);
+    PearsonTypeVT(const PearsonTypeVT &src);
+    ~PearsonTypeVT();
 
     // assignment
-    PearsonTypeV &operator=(const PearsonTypeV &rhs);
+    PearsonTypeVT &operator=(const PearsonTypeVT &rhs);
 
     // get a random value
     double nextValue();
 
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
 protected:
     // data
     double alpha_;
     double beta_;
-    ExtUseCntPtr<Gamma> pgrng_;
+    typename GammaT<RNG>::Setup gamma_;
+    RNG rng_;
 };
 
+// default instantiation, engine chosen at run-time
+typedef PearsonTypeVT<Random> PearsonTypeV;
+
 }
 
+#include "distributions/PearsonTypeV.i"
+
 #endif
@@ -0,0 +1,155 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// pearson type V distribution
+//
+// 1) y ~ gamma(alpha, 1/beta)
+// 2) return x = 1/y.
+// which is x = beta/y', y' ~ gamma(alpha, 1).
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+PearsonTypeVT<RNG>::PearsonTypeVT(): 
+    BaseObject(false),
+    alpha_(0), beta_(0), gamma_(), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+PearsonTypeVT<RNG>::PearsonTypeVT(double alpha, double beta, const RNG &rng): 
+    BaseObject(false), 
+    alpha_(alpha), beta_(beta), gamma_(alpha), rng_(rng)
+{
+    setOk(true);
+}
+
+template <class RNG>
+PearsonTypeVT<RNG>::PearsonTypeVT(const PearsonTypeVT<RNG> &src): 
+    BaseObject(src), 
+    alpha_(src.alpha_), beta_(src.beta_), 
+    gamma_(src.gamma_), rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+PearsonTypeVT<RNG>::~PearsonTypeVT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+PearsonTypeVT<RNG> &
+PearsonTypeVT<RNG>::operator=(const PearsonTypeVT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        alpha_ = rhs.alpha_;
+        beta_ = rhs.beta_;
+        gamma_ = rhs.gamma_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+PearsonTypeVT<RNG>::nextValue()
+{
+    double y = GammaT<RNG>::standard(rng_, gamma_);
+    return(beta_/y);
+}
+
+// fill an array with random values
+template <class RNG>
+void
+PearsonTypeVT<RNG>::fill(double *out, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = nextValue();
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+PearsonTypeVT<RNG>::pdf(double x) const
+{
+    return((x <= 0.0) ? 0.0 : exp(logpdf(x)));
+}
+
+template <class RNG>
+double
+PearsonTypeVT<RNG>::logpdf(double x) const
+{
+    if (x <= 0.0) return(-HUGE_VAL);
+    double z = beta_/x;
+    return((alpha_+1.0)*log(z) - z - logGamma(alpha_) - log(beta_));
+}
+
+template <class RNG>
+double
+PearsonTypeVT<RNG>::cdf(double x) const
+{
+    return((x <= 0.0) ? 0.0 : gammaQ(alpha_, beta_/x));
+}
+
+template <class RNG>
+double
+PearsonTypeVT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    if (p == 0.0) return(0.0);
+    return(beta_/gammaPInverse(alpha_, 1.0-p));
+}
+
+template <class RNG>
+void
+PearsonTypeVT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = pdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+PearsonTypeVT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = logpdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+PearsonTypeVT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = cdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+PearsonTypeVT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = quantile(p[i]);
+    }
+}
+
+}
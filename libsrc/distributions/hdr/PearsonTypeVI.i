@@ -0,0 +1,164 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// pearson type VI distribution
+//
+// 1) y1 ~ gamma(alpha1, beta), y2 ~ gamma(alpha2, 1).
+// 2) return x = y1/y2;
+// both gammas come from the same engine, so they are independent.
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+PearsonTypeVIT<RNG>::PearsonTypeVIT(): 
+    BaseObject(false),
+    alpha1_(0), alpha2_(0), beta_(0), 
+    gamma1_(), gamma2_(), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+PearsonTypeVIT<RNG>::PearsonTypeVIT(double alpha1, double alpha2, double beta, const RNG &rng): 
+    BaseObject(false), 
+    alpha1_(alpha1), alpha2_(alpha2), beta_(beta), 
+    gamma1_(alpha1), gamma2_(alpha2), rng_(rng)
+{
+    setOk(true);
+}
+
+template <class RNG>
+PearsonTypeVIT<RNG>::PearsonTypeVIT(const PearsonTypeVIT<RNG> &src): 
+    BaseObject(src), 
+    alpha1_(src.alpha1_), alpha2_(src.alpha2_), beta_(src.beta_),
+    gamma1_(src.gamma1_), gamma2_(src.gamma2_), rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+PearsonTypeVIT<RNG>::~PearsonTypeVIT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+PearsonTypeVIT<RNG> &
+PearsonTypeVIT<RNG>::operator=(const PearsonTypeVIT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        alpha1_ = rhs.alpha1_;
+        alpha2_ = rhs.alpha2_;
+        beta_ = rhs.beta_;
+        gamma1_ = rhs.gamma1_;
+        gamma2_ = rhs.gamma2_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+PearsonTypeVIT<RNG>::nextValue()
+{
+    double y1 = beta_*GammaT<RNG>::standard(rng_, gamma1_);
+    double y2 = GammaT<RNG>::standard(rng_, gamma2_);
+    return(y1/y2);
+}
+
+// fill an array with random values
+template <class RNG>
+void
+PearsonTypeVIT<RNG>::fill(double *out, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = nextValue();
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+PearsonTypeVIT<RNG>::pdf(double x) const
+{
+    return((x < 0.0) ? 0.0 : exp(logpdf(x)));
+}
+
+template <class RNG>
+double
+PearsonTypeVIT<RNG>::logpdf(double x) const
+{
+    if (x < 0.0) return(-HUGE_VAL);
+    double z = x/beta_;
+    return(xlogy(alpha1_-1.0, z) - (alpha1_+alpha2_)*log1p(z) -
+           logBeta(alpha1_, alpha2_) - log(beta_));
+}
+
+template <class RNG>
+double
+PearsonTypeVIT<RNG>::cdf(double x) const
+{
+    if (x <= 0.0) return(0.0);
+    double z = x/beta_;
+    return(betaI(alpha1_, alpha2_, z/(1.0+z)));
+}
+
+template <class RNG>
+double
+PearsonTypeVIT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    if (p == 1.0) return(HUGE_VAL);
+    double y = betaIInverse(alpha1_, alpha2_, p);
+    return(beta_*y/(1.0-y));
+}
+
+template <class RNG>
+void
+PearsonTypeVIT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = pdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+PearsonTypeVIT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = logpdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+PearsonTypeVIT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = cdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+PearsonTypeVIT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = quantile(p[i]);
+    }
+}
+
+}
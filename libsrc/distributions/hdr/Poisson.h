@@ -14,32 +14,78 @@
 #include "system/Debug.h"
 #include "atomic/BaseObject.h"
 #include "random/Random.h"
+#include "specialfunctions/SpecialFunctions.h"
 
 namespace ombt {
 
 // poisson distribution
-class Poisson: public BaseObject
+template <class RNG>
+class PoissonT: public BaseObject
 {
 public:
     // ctors and dtor
-    Poisson();
-    Poisson(double lambda, const Random &rng);
-    Poisson(const Poisson &src);
-    ~Poisson();
+    PoissonT();
+    PoissonT(double lambda, const RNG &rng);
+    PoissonT(const PoissonT &src);
+    ~PoissonT();
 
     // assignment
-    Poisson &operator=(const Poisson &rhs);
+    PoissonT &operator=(const PoissonT &rhs);
 
     // get a random value
     double nextValue();
 
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
+    // value for any lambda from the given engine, for mixtures
+    static double value(RNG &rng, double lambda);
+
+    // log(k!)
+    static double logFactorial(double k);
+
+protected:
+    // constants for one lambda
+    struct Setup {
+        Setup(double lambda = 0);
+
+        double lambda_;
+        double a_;
+        double loglambda_;
+        double b_;
+        double alpha_;
+        double logialpha_;
+        double vr_;
+    };
+
+    // utilities
+    static double value(RNG &rng, const Setup &setup);
+    static double valuePTRS(RNG &rng, const Setup &setup);
+
 protected:
     // data
-    double lambda_;
-    double a_;
-    Random rng_;
+    Setup setup_;
+    RNG rng_;
 };
 
+// default instantiation, engine chosen at run-time
+typedef PoissonT<Random> Poisson;
+
 }
 
+#include "distributions/Poisson.i"
+
 #endif
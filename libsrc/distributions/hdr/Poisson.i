@@ -0,0 +1,272 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// poisson distribution
+//
+// small lambda, multiplication method:
+// multiply U(0,1) values until the product drops below 
+// exp(-lambda), the count before that is the value. this is 
+// O(lambda) uniforms per value and exp(-lambda) underflows 
+// past lambda of about 700.
+//
+// lambda >= PTRSLambda, transformed rejection with squeeze,
+// PTRS (hormann, 1993):
+// 1) b = 0.931 + 2.53*sqrt(lambda), a = -0.059 + 0.02483*b,
+// 1/alpha = 1.1239 + 1.1328/(b-3.4), vr = 0.9277 - 3.6224/(b-2)
+// 2) generate U ~ U(-0.5,0.5), V ~ U(0,1), let us = 0.5-|U| and
+// k = floor((2*a/us + b)*U + lambda + 0.43).
+// 3) if us >= 0.07 and V <= vr, return k (squeeze, most values).
+// 4) if k < 0, or us < 0.013 and V > us, go back to step 2.
+// 5) if log(V*(1/alpha)/(a/us**2 + b)) <= 
+// -lambda + k*log(lambda) - log(k!), return k, else go to step 2.
+// the expected number of uniform pairs is about 1.1 for any lambda.
+//
+
+namespace ombt {
+
+// switch to PTRS at this mean
+static const double PTRSLambda = 10.0;
+
+// constants for one lambda
+template <class RNG>
+PoissonT<RNG>::Setup::Setup(double lambda):
+    lambda_(lambda), a_(0), 
+    loglambda_(0), b_(0), alpha_(0), logialpha_(0), vr_(0)
+{
+    if (lambda < PTRSLambda)
+    {
+        a_ = exp(-lambda);
+    }
+    else
+    {
+        loglambda_ = log(lambda);
+        b_ = 0.931 + 2.53*sqrt(lambda);
+        alpha_ = -0.059 + 0.02483*b_;
+        logialpha_ = log(1.1239 + 1.1328/(b_-3.4));
+        vr_ = 0.9277 - 3.6224/(b_-2);
+    }
+}
+
+// ctors and dtor
+template <class RNG>
+PoissonT<RNG>::PoissonT(): 
+    BaseObject(false), setup_(), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+PoissonT<RNG>::PoissonT(double lambda, const RNG &rng): 
+    BaseObject(false), setup_(lambda), rng_(rng)
+{
+    setOk(true);
+}
+
+template <class RNG>
+PoissonT<RNG>::PoissonT(const PoissonT<RNG> &src): 
+    BaseObject(src), setup_(src.setup_), rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+PoissonT<RNG>::~PoissonT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+PoissonT<RNG> &
+PoissonT<RNG>::operator=(const PoissonT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        setup_ = rhs.setup_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+PoissonT<RNG>::nextValue()
+{
+    return(value(rng_, setup_));
+}
+
+template <class RNG>
+double
+PoissonT<RNG>::value(RNG &rng, double lambda)
+{
+    return(value(rng, Setup(lambda)));
+}
+
+template <class RNG>
+double
+PoissonT<RNG>::value(RNG &rng, const Setup &setup)
+{
+    if (setup.lambda_ >= PTRSLambda) return(valuePTRS(rng, setup));
+
+    double b = 1;
+    for (unsigned long i=0; ; ++i)
+    {
+        double U = rng.random0to1();
+        b = b*U;
+        if (b < setup.a_) return(i);
+    }
+}
+
+template <class RNG>
+double
+PoissonT<RNG>::valuePTRS(RNG &rng, const Setup &setup)
+{
+    for (;;)
+    {
+        double U = rng.random0to1()-0.5;
+        double V = rng.random0to1();
+        double us = 0.5-fabs(U);
+        double k = floor((2*setup.alpha_/us + setup.b_)*U + 
+                         setup.lambda_ + 0.43);
+        if (us >= 0.07 && V <= setup.vr_)
+            return(k);
+        if (k < 0 || (us < 0.013 && V > us))
+            continue;
+        if (log(V) + setup.logialpha_ - 
+            log(setup.alpha_/(us*us) + setup.b_) <=
+            -setup.lambda_ + k*setup.loglambda_ - logFactorial(k))
+            return(k);
+    }
+}
+
+// log(k!), stirling series for log(gamma(k+1)). small k are 
+// shifted up first, so it is good to double precision.
+template <class RNG>
+double
+PoissonT<RNG>::logFactorial(double k)
+{
+    static const double a[10] = {
+        8.333333333333333e-02, -2.777777777777778e-03,
+        7.936507936507937e-04, -5.952380952380952e-04,
+        8.417508417508418e-04, -1.917526917526918e-03,
+        6.410256410256410e-03, -2.955065359477124e-02,
+        1.796443723688307e-01, -1.392432216905900e+00
+    };
+
+    if (k <= 1) return(0.0);
+
+    double x = k+1;
+    int n = (x < 7) ? int(7-x) : 0;
+    double x0 = x+n;
+    double x2 = 1.0/(x0*x0);
+    double gl0 = a[9];
+    for (int i=8; i>=0; --i)
+    {
+        gl0 = gl0*x2 + a[i];
+    }
+    double gl = gl0/x0 + 0.5*log(2*M_PI) + (x0-0.5)*log(x0) - x0;
+    for (int i=1; i<=n; ++i)
+    {
+        x0 -= 1;
+        gl -= log(x0);
+    }
+    return(gl);
+}
+
+// fill an array with random values
+template <class RNG>
+void
+PoissonT<RNG>::fill(double *out, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = nextValue();
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+PoissonT<RNG>::pdf(double x) const
+{
+    if (x < 0.0 || x != floor(x)) return(0.0);
+    return(exp(logpdf(x)));
+}
+
+template <class RNG>
+double
+PoissonT<RNG>::logpdf(double x) const
+{
+    if (x < 0.0 || x != floor(x)) return(-HUGE_VAL);
+    double lambda = setup_.lambda_;
+    return(-lambda + xlogy(x, lambda) - logFactorial(x));
+}
+
+template <class RNG>
+double
+PoissonT<RNG>::cdf(double x) const
+{
+    if (x < 0.0) return(0.0);
+    return(gammaQ(floor(x)+1.0, setup_.lambda_));
+}
+
+template <class RNG>
+double
+PoissonT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    double lambda = setup_.lambda_;
+    if (p == 1.0) return((lambda > 0.0) ? HUGE_VAL : 0.0);
+    double k = floor(lambda+sqrt(lambda)*normalQuantile(p));
+    if (!(k >= 0.0)) k = 0.0;
+    if (k > HUGE_VAL) k = HUGE_VAL;
+    while (k < HUGE_VAL && cdf(k) < p) k += 1;
+    while (k > 0.0 && cdf(k-1) >= p) k -= 1;
+    return(k);
+}
+
+template <class RNG>
+void
+PoissonT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = pdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+PoissonT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = logpdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+PoissonT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = cdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+PoissonT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = quantile(p[i]);
+    }
+}
+
+}
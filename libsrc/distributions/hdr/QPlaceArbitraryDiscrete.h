@@ -10,6 +10,7 @@
 #include <stdio.h>
 #include <math.h>
 #include <vector>
+#include <algorithm>
 
 // local headers
 #include "system/Returns.h"
@@ -20,29 +21,51 @@
 namespace ombt {
 
 // arbitrary discrete distribution - single vector implementation
-class QPlaceArbitraryDiscrete: public BaseObject
+template <class RNG>
+class QPlaceArbitraryDiscreteT: public BaseObject
 {
 public:
     // ctors and dtor
-    QPlaceArbitraryDiscrete();
-    QPlaceArbitraryDiscrete(unsigned int qdigits, const std::vector<double> &mass, const Random &rng);
-    QPlaceArbitraryDiscrete(const QPlaceArbitraryDiscrete &src);
-    ~QPlaceArbitraryDiscrete();
+    QPlaceArbitraryDiscreteT();
+    QPlaceArbitraryDiscreteT(unsigned int qdigits, const std::vector<double> &mass, const RNG &rng);
+    QPlaceArbitraryDiscreteT(const QPlaceArbitraryDiscreteT &src);
+    ~QPlaceArbitraryDiscreteT();
 
     // assignment
-    QPlaceArbitraryDiscrete &operator=(const QPlaceArbitraryDiscrete &rhs);
+    QPlaceArbitraryDiscreteT &operator=(const QPlaceArbitraryDiscreteT &rhs);
 
     // get a random value
     double nextValue();
 
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
 protected:
     // data
     unsigned int qdigits_;
     unsigned int scale_;
     std::vector<double> dist_;
-    Random rng_;
+    RNG rng_;
 };
 
+// default instantiation, engine chosen at run-time
+typedef QPlaceArbitraryDiscreteT<Random> QPlaceArbitraryDiscrete;
+
 }
 
+#include "distributions/QPlaceArbitraryDiscrete.i"
+
 #endif
@@ -0,0 +1,186 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// arbitrary discrete distribution
+//
+// p(0), p(1), p(2), ..., p(n)
+// choose U in (0,1), then return X=I where:
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+QPlaceArbitraryDiscreteT<RNG>::QPlaceArbitraryDiscreteT(): 
+    BaseObject(false), 
+        qdigits_(0), scale_(0), dist_(), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+QPlaceArbitraryDiscreteT<RNG>::QPlaceArbitraryDiscreteT(
+    unsigned int qdigits, const std::vector<double> &mass, const RNG &rng): 
+        BaseObject(false), 
+            qdigits_(qdigits), scale_(0), dist_(), rng_(rng)
+{
+    scale_ = 1;
+    for (int i=1; i<=qdigits; ++i)
+    {
+        scale_ *= 10;
+    }
+    dist_.resize(scale_);
+
+    int I=0;
+    unsigned long masssize = mass.size();
+    unsigned long diststart = 0;
+    unsigned long distend = 0;
+    for (I=0; I<masssize; ++I)
+    {
+        unsigned long distsize = mass[I]*scale_;
+        distend = diststart + distsize;
+        if (distend > scale_) distend = scale_;
+        for (unsigned long disti=diststart; disti<distend; ++disti)
+        {
+            dist_[disti] = I;
+        }
+        diststart = distend;
+    }
+    for ( ; distend<scale_; ++distend)
+    {
+        dist_[distend] = (masssize > 0) ? masssize-1 : 0;
+    }
+
+    setOk(true);
+}
+
+template <class RNG>
+QPlaceArbitraryDiscreteT<RNG>::QPlaceArbitraryDiscreteT(
+    const QPlaceArbitraryDiscreteT<RNG> &src): 
+        BaseObject(src), 
+            qdigits_(src.qdigits_), scale_(src.scale_), 
+            dist_(src.dist_), rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+QPlaceArbitraryDiscreteT<RNG>::~QPlaceArbitraryDiscreteT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+QPlaceArbitraryDiscreteT<RNG> &
+QPlaceArbitraryDiscreteT<RNG>::operator=(const QPlaceArbitraryDiscreteT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        qdigits_ = rhs.qdigits_;
+        scale_ = rhs.scale_;
+        dist_ = rhs.dist_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+QPlaceArbitraryDiscreteT<RNG>::nextValue()
+{
+    unsigned long U = rng_.random()%scale_;
+    return(dist_[U]);
+}
+
+// fill an array with random values
+template <class RNG>
+void
+QPlaceArbitraryDiscreteT<RNG>::fill(double *out, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = nextValue();
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+QPlaceArbitraryDiscreteT<RNG>::pdf(double x) const
+{
+    if (x != floor(x)) return(0.0);
+    return(double(std::upper_bound(dist_.begin(), dist_.end(), x)-
+                  std::lower_bound(dist_.begin(), dist_.end(), x))/scale_);
+}
+
+template <class RNG>
+double
+QPlaceArbitraryDiscreteT<RNG>::logpdf(double x) const
+{
+    return(log(pdf(x)));
+}
+
+template <class RNG>
+double
+QPlaceArbitraryDiscreteT<RNG>::cdf(double x) const
+{
+    return(double(std::upper_bound(dist_.begin(), dist_.end(), floor(x))-
+                  dist_.begin())/scale_);
+}
+
+template <class RNG>
+double
+QPlaceArbitraryDiscreteT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    long I = long(ceil(p*scale_))-1;
+    if (I < 0) I = 0;
+    if (I >= long(scale_)) I = scale_-1;
+    return(dist_[I]);
+}
+
+template <class RNG>
+void
+QPlaceArbitraryDiscreteT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = pdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+QPlaceArbitraryDiscreteT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = logpdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+QPlaceArbitraryDiscreteT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = cdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+QPlaceArbitraryDiscreteT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = quantile(p[i]);
+    }
+}
+
+}
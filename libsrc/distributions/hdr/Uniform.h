@@ -6,6 +6,9 @@
 #ifndef __OMBT_UNIFORM_H
 #define __OMBT_UNIFORM_H
 
+// system headers
+#include <math.h>
+
 // local headers
 #include "system/Returns.h"
 #include "system/Debug.h"
@@ -15,28 +18,50 @@
 namespace ombt {
 
 // uniform distribution
-class Uniform: public BaseObject
+template <class RNG>
+class UniformT: public BaseObject
 {
 public:
     // ctors and dtor
-    Uniform();
-    Uniform(double a, double b, const Random &rng);
-    Uniform(const Uniform &src);
-    ~Uniform();
+    UniformT();
+    UniformT(double a, double b, const RNG &rng);
+    UniformT(const UniformT &src);
+    ~UniformT();
 
     // assignment
-    Uniform &operator=(const Uniform &rhs);
+    UniformT &operator=(const UniformT &rhs);
 
     // get a random value
     double nextValue();
 
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
 protected:
     // data
     double a_;
     double b_;
-    Random rng_;
+    RNG rng_;
 };
 
+// default instantiation, engine chosen at run-time
+typedef UniformT<Random> Uniform;
+
 }
 
+#include "distributions/Uniform.i"
+
 #endif
@@ -0,0 +1,161 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// uniform distribution
+//
+// F(x) = (x-a)/(b-a)
+// X = a+U*(b-a), U in (0,1).
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+UniformT<RNG>::UniformT(): 
+    BaseObject(false), a_(0), b_(0), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+UniformT<RNG>::UniformT(double a, double b, const RNG &rng): 
+    BaseObject(false), a_(a), b_(b), rng_(rng)
+{
+    setOk(true);
+}
+
+template <class RNG>
+UniformT<RNG>::UniformT(const UniformT<RNG> &src): 
+    BaseObject(src), a_(src.a_), b_(src.b_), rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+UniformT<RNG>::~UniformT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+UniformT<RNG> &
+UniformT<RNG>::operator=(const UniformT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        a_ = rhs.a_;
+        b_ = rhs.b_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+UniformT<RNG>::nextValue()
+{
+    double u = rng_.random0to1();
+    return(a_+u*(b_-a_));
+}
+
+// fill an array with random values
+template <class RNG>
+void
+UniformT<RNG>::fill(double *out, size_t n)
+{
+    // uniforms first, then a branch-free transform the
+    // compiler can vectorize.
+    rng_.fill(out, n);
+    double a = a_;
+    double ba = b_-a_;
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = a+out[i]*ba;
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+UniformT<RNG>::pdf(double x) const
+{
+    return((a_ <= x && x <= b_) ? 1.0/(b_-a_) : 0.0);
+}
+
+template <class RNG>
+double
+UniformT<RNG>::logpdf(double x) const
+{
+    return((a_ <= x && x <= b_) ? -log(b_-a_) : -HUGE_VAL);
+}
+
+template <class RNG>
+double
+UniformT<RNG>::cdf(double x) const
+{
+    if (x <= a_) return(0.0);
+    if (x >= b_) return(1.0);
+    return((x-a_)/(b_-a_));
+}
+
+template <class RNG>
+double
+UniformT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    return(a_+p*(b_-a_));
+}
+
+template <class RNG>
+void
+UniformT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    const double a = a_;
+    const double b = b_;
+    const double f = 1.0/(b-a);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = (a <= x[i] && x[i] <= b) ? f : 0.0;
+    }
+}
+
+template <class RNG>
+void
+UniformT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = logpdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+UniformT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    const double a = a_;
+    const double b = b_;
+    const double ibma = 1.0/(b-a);
+    for (size_t i=0; i<n; ++i)
+    {
+        double c = (x[i]-a)*ibma;
+        c = (c < 0.0) ? 0.0 : c;
+        out[i] = (c > 1.0) ? 1.0 : c;
+    }
+}
+
+template <class RNG>
+void
+UniformT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = quantile(p[i]);
+    }
+}
+
+}
@@ -15,32 +15,55 @@
 #include "system/Debug.h"
 #include "atomic/BaseObject.h"
 #include "random/Random.h"
+#include "specialfunctions/SpecialFunctions.h"
 
 namespace ombt {
 
 // weibull distribution
-class Weibull: public BaseObject
+template <class RNG>
+class WeibullT: public BaseObject
 {
 public:
     // ctors and dtor
-    Weibull();
-    Weibull(double alpha, double beta, const Random &rng);
-    Weibull(const Weibull &src);
-    ~Weibull();
+    WeibullT();
+    WeibullT(double alpha, double beta, const RNG &rng);
+    WeibullT(const WeibullT &src);
+    ~WeibullT();
 
     // assignment
-    Weibull &operator=(const Weibull &rhs);
+    WeibullT &operator=(const WeibullT &rhs);
 
     // get a random value
     double nextValue();
 
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
 protected:
     // data
     double alpha_;
     double beta_;
-    Random rng_;
+    RNG rng_;
 };
 
+// default instantiation, engine chosen at run-time
+typedef WeibullT<Random> Weibull;
+
 }
 
+#include "distributions/Weibull.i"
+
 #endif
@@ -0,0 +1,165 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// weibull distribution
+//
+// F(x) = alpha*(beta**-alpha)*(x**(n-1))*exp(-(x/beta)**alpha)
+// u ~ U(0,1)
+// x = beta*(-log(1-u))**(1/alpha)
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+WeibullT<RNG>::WeibullT(): 
+    BaseObject(false), alpha_(0), beta_(0), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+WeibullT<RNG>::WeibullT(double alpha, double beta, const RNG &rng): 
+    BaseObject(false), 
+    alpha_(alpha), beta_(beta), rng_(rng)
+{
+    setOk(true);
+}
+
+template <class RNG>
+WeibullT<RNG>::WeibullT(const WeibullT<RNG> &src): 
+    BaseObject(src), 
+    alpha_(src.alpha_), beta_(src.beta_), rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+WeibullT<RNG>::~WeibullT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+WeibullT<RNG> &
+WeibullT<RNG>::operator=(const WeibullT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        alpha_ = rhs.alpha_;
+        beta_ = rhs.beta_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+WeibullT<RNG>::nextValue()
+{
+    double u = rng_.random0to1();
+    return(beta_*pow(-log(u), 1/alpha_));
+}
+
+// fill an array with random values
+template <class RNG>
+void
+WeibullT<RNG>::fill(double *out, size_t n)
+{
+    // uniforms first, then a branch-free transform the
+    // compiler can vectorize. pow(y, 1/alpha) is written as
+    // exp(log(y)/alpha) so only vectorizable calls are used.
+    rng_.fill(out, n);
+    double beta = beta_;
+    double ialpha = 1/alpha_;
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = beta*exp(ialpha*log(-log(out[i])));
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+WeibullT<RNG>::pdf(double x) const
+{
+    return(exp(logpdf(x)));
+}
+
+template <class RNG>
+double
+WeibullT<RNG>::logpdf(double x) const
+{
+    if (x < 0.0) return(-HUGE_VAL);
+    double z = x/beta_;
+    return(log(alpha_/beta_) + xlogy(alpha_-1.0, z) - pow(z, alpha_));
+}
+
+template <class RNG>
+double
+WeibullT<RNG>::cdf(double x) const
+{
+    return((x <= 0.0) ? 0.0 : -expm1(-pow(x/beta_, alpha_)));
+}
+
+template <class RNG>
+double
+WeibullT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    return(beta_*pow(-log1p(-p), 1.0/alpha_));
+}
+
+template <class RNG>
+void
+WeibullT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = pdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+WeibullT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    const double ibeta = 1.0/beta_;
+    const double a = alpha_;
+    const double c = log(alpha_/beta_);
+    for (size_t i=0; i<n; ++i)
+    {
+        double lz = log(x[i]*ibeta);
+        double f = c + (a-1.0)*lz - exp(a*lz);
+        out[i] = (x[i] <= 0.0) ? logpdf(x[i]) : f;
+    }
+}
+
+template <class RNG>
+void
+WeibullT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    const double ibeta = 1.0/beta_;
+    const double a = alpha_;
+    for (size_t i=0; i<n; ++i)
+    {
+        double c = -expm1(-exp(a*log(x[i]*ibeta)));
+        out[i] = (x[i] <= 0.0) ? 0.0 : c;
+    }
+}
+
+template <class RNG>
+void
+WeibullT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = quantile(p[i]);
+    }
+}
+
+}
@@ -15,32 +15,57 @@
 #include "system/Debug.h"
 #include "atomic/BaseObject.h"
 #include "random/Random.h"
+#include "specialfunctions/SpecialFunctions.h"
+#include "distributions/Gamma.h"
 
 namespace ombt {
 
 // exponential distribution
-class mErlang: public BaseObject
+template <class RNG>
+class mErlangT: public BaseObject
 {
 public:
     // ctors and dtor
-    mErlang();
-    mErlang(double beta, unsigned long m, const Random &rng);
-    mErlang(const mErlang &src);
-    ~mErlang();
+    mErlangT();
+    mErlangT(double beta, unsigned long m, const RNG &rng);
+    mErlangT(const mErlangT &src);
+    ~mErlangT();
 
     // assignment
-    mErlang &operator=(const mErlang &rhs);
+    mErlangT &operator=(const mErlangT &rhs);
 
     // get a random value
     double nextValue();
 
+    // fill an array with random values
+    void fill(double *out, size_t n);
+
+    // density (mass for discrete values), its log, the 
+    // distribution function and its inverse
+    double pdf(double x) const;
+    double logpdf(double x) const;
+    double cdf(double x) const;
+    double quantile(double p) const;
+
+    // the same over arrays
+    void pdf(const double *x, double *out, size_t n) const;
+    void logpdf(const double *x, double *out, size_t n) const;
+    void cdf(const double *x, double *out, size_t n) const;
+    void quantile(const double *p, double *out, size_t n) const;
+
 protected:
     // data
     double beta_;
     unsigned long m_;
-    Random rng_;
+    typename GammaT<RNG>::Setup gamma_;
+    RNG rng_;
 };
 
+// default instantiation, engine chosen at run-time
+typedef mErlangT<Random> mErlang;
+
 }
 
+#include "distributions/mErlang.i"
+
 #endif
@@ -0,0 +1,164 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// m-erlang distribution
+//
+// X = (-beta/m)*log(u1*u2*...*um)
+// for m > mErlangProductM, the product costs too many uniforms 
+// (and underflows past m of about 700), so use the fact that
+// X ~ gamma(m, beta/m) instead.
+
+namespace ombt {
+
+// use the gamma sampler past this m
+static const unsigned long mErlangProductM = 8;
+
+// ctors and dtor
+template <class RNG>
+mErlangT<RNG>::mErlangT(): 
+    BaseObject(false), beta_(0), m_(0), gamma_(), rng_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+mErlangT<RNG>::mErlangT(double beta, unsigned long m, const RNG &rng): 
+    BaseObject(false), beta_(beta), m_(m), 
+    gamma_((m > 0) ? double(m) : 1.0), rng_(rng)
+{
+    setOk(true);
+}
+
+template <class RNG>
+mErlangT<RNG>::mErlangT(const mErlangT<RNG> &src): 
+    BaseObject(src), beta_(src.beta_), m_(src.m_), 
+    gamma_(src.gamma_), rng_(src.rng_)
+{
+    // nothing to do
+}
+
+template <class RNG>
+mErlangT<RNG>::~mErlangT()
+{
+    setOk(false);
+}
+
+// assignment
+template <class RNG>
+mErlangT<RNG> &
+mErlangT<RNG>::operator=(const mErlangT<RNG> &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        beta_ = rhs.beta_;
+        m_ = rhs.m_;
+        gamma_ = rhs.gamma_;
+        rng_ = rhs.rng_;
+    }
+    return(*this);
+}
+
+// get value
+template <class RNG>
+double
+mErlangT<RNG>::nextValue()
+{
+    if (m_ > mErlangProductM)
+        return(beta_*GammaT<RNG>::standard(rng_, gamma_)/m_);
+
+    double product = 1;
+    for (int i=1; i<=m_; ++i)
+    {
+        product *= rng_.random0to1();
+    }
+    return(-beta_*log(product)/m_);
+}
+
+// fill an array with random values
+template <class RNG>
+void
+mErlangT<RNG>::fill(double *out, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = nextValue();
+    }
+}
+
+// density and distribution functions
+template <class RNG>
+double
+mErlangT<RNG>::pdf(double x) const
+{
+    return((x < 0.0) ? 0.0 : exp(logpdf(x)));
+}
+
+template <class RNG>
+double
+mErlangT<RNG>::logpdf(double x) const
+{
+    if (x < 0.0) return(-HUGE_VAL);
+    double scale = beta_/m_;
+    double z = x/scale;
+    return(xlogy(m_-1.0, z) - z - logGamma(m_) - log(scale));
+}
+
+template <class RNG>
+double
+mErlangT<RNG>::cdf(double x) const
+{
+    return(gammaP(m_, x*m_/beta_));
+}
+
+template <class RNG>
+double
+mErlangT<RNG>::quantile(double p) const
+{
+    if (p < 0.0 || p > 1.0) return(NAN);
+    return(beta_/m_*gammaPInverse(m_, p));
+}
+
+template <class RNG>
+void
+mErlangT<RNG>::pdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = pdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+mErlangT<RNG>::logpdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = logpdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+mErlangT<RNG>::cdf(const double *x, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = cdf(x[i]);
+    }
+}
+
+template <class RNG>
+void
+mErlangT<RNG>::quantile(const double *p, double *out, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = quantile(p[i]);
+    }
+}
+
+}
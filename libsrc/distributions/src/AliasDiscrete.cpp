@@ -0,0 +1,15 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// alias discrete distribution, default instantiation
+
+// headers
+#include "hdr/AliasDiscrete.h"
+
+namespace ombt {
+
+template class AliasDiscreteT<Random>;
+
+}
@@ -3,95 +3,44 @@
 // All rights reserved.
 // Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
 //
-// gaussian distribution
-//
-// F(x) closed form does not exist.
-// given X ~ N(0,1), then X' ~ N(mu,sigma2) can
-// be obtained using this relation: X' = mu + sqrt(sigma2)*X
-// so we only need to generate N(0,1).
-//
-// 1) generate u1 and u2 as IID U(0,1) and calculate:
-// v1 = 2*u1-1, v2 = 2*u2-1
-// w = v1**2 + v2**2
-// 2) if W > 1, then go back to step 1, else let
-// y = sqrt(-2*log(w)/w), x1 = v1*y, x2 = v2*y.
-// 3) x1 and x2 are IID N(0,1). return x1 or x2 or alternate.
-// 4) x = mu + sqrt(sigma2)*x1 or use x2.
-// 
+// gaussian distribution, default instantiation
 
 // headers
 #include "hdr/Gaussian.h"
 
 namespace ombt {
 
-// ctors and dtor
-Gaussian::Gaussian(): 
-    BaseObject(false), 
-    xindex_(0), mu_(0), sigma_(0), sigma2_(0), rng_()
-{
-    setOk(false);
-}
-
-Gaussian::Gaussian(double mu, double sigma2, const Random &rng): 
-    BaseObject(false), 
-    xindex_(0), mu_(mu), sigma_(0), sigma2_(sigma2), rng_(rng)
-{
-    sigma_ = sqrt(sigma2);
-    setOk(true);
-}
-
-Gaussian::Gaussian(const Gaussian &src): 
-    BaseObject(src), 
-    xindex_(src.xindex_), mu_(src.mu_), 
-    sigma_(src.sigma_), sigma2_(src.sigma2_), rng_(src.rng_)
-{
-    // nothing to do
-}
+// ziggurat constants for 128 layers: R is the start of the tail,
+// V the area of each layer.
+const double GaussianZiggurat::R = 3.442619855899;
+const double GaussianZiggurat::V = 9.91256303526217e-3;
 
-Gaussian::~Gaussian()
+// ctors
+GaussianZiggurat::GaussianZiggurat()
 {
-    setOk(false);
-}
-
-// assignment
-Gaussian &
-Gaussian::operator=(const Gaussian &rhs)
-{
-    if (this != &rhs)
+    double f = exp(-0.5*R*R);
+    x_[0] = V/f;
+    x_[1] = R;
+    x_[Layers] = 0;
+    for (int i=2; i<Layers; ++i)
+    {
+        x_[i] = sqrt(-2*log(V/x_[i-1]+f));
+        f = exp(-0.5*x_[i]*x_[i]);
+    }
+    for (int i=0; i<Layers; ++i)
     {
-        BaseObject::operator=(rhs);
-        xindex_ = rhs.xindex_;
-        mu_ = rhs.mu_;
-        sigma_ = rhs.sigma_;
-        sigma2_ = rhs.sigma2_;
-        rng_ = rhs.rng_;
+        r_[i] = x_[i+1]/x_[i];
     }
-    return(*this);
 }
 
-// get value
-double
-Gaussian::nextValue()
+// the tables, built on first use
+const GaussianZiggurat &
+GaussianZiggurat::tables()
 {
-    double u1, u2, v1, v2, w;
-
-    do {
-        u1 = rng_.random0to1();
-        u2 = rng_.random0to1();
-        v1 = 2*u1 - 1;
-        v2 = 2*u2 - 1;
-        w = v1*v1 + v2*v2;
-    } while (w > 1);
-
-    double y = sqrt(-2*log(w)/w);
-    double x1 = v1*y;
-    double x2 = v2*y;
-
-    xindex_ = (xindex_+1)%2;
-    if (xindex_)
-        return(mu_+sigma_*x1);
-    else
-        return(mu_+sigma_*x2);
+    static const GaussianZiggurat zig;
+    return(zig);
 }
 
+template class GaussianT<Random>;
+
 }
@@ -0,0 +1,15 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// inverse cdf table distribution, default instantiation
+
+// headers
+#include "hdr/InverseCDFTable.h"
+
+namespace ombt {
+
+template class InverseCDFTableT<Random>;
+
+}
@@ -0,0 +1,15 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// multivariate gaussian distribution, default instantiation
+
+// headers
+#include "hdr/MultivariateGaussian.h"
+
+namespace ombt {
+
+template class MultivariateGaussianT<Random>;
+
+}
@@ -52,12 +52,21 @@ public:
     void interpolate(int npoints, const DT xs[], DT ys[]) const;
     void interpolate(const Coordinates &xs, Coordinates &ys) const;
 
+    // first derivative for a given value of x
+    DT derivative(DT x) const;
+
+    // knots
+    int size() const { return(npoints_); }
+    DT lower() const { return(xs_[0]); }
+    DT upper() const { return(xs_[npoints_-1]); }
+
     // output
     friend std::ostream &operator<<<>(std::ostream &, const CubicSpline<DT> &);
  
 private:
     // does actual calculations
     int calculate();
+    void locate(DT x, int &klo, int &khi) const;
 
     // data
     typedef std::vector<DT> Values;
@@ -18,10 +18,10 @@ CubicSpline<DT>::CubicSpline(int npoints,
     const DT x[], const DT y[], DT yp1, DT ypn):
     npoints_(npoints), yp1_(yp1), ypn_(ypn), xs_(), ys_(), ypps_()
 {
-    MustBeTrue(npoints_ > 0);
-    xs_.resize(npoints_+1);
-    ys_.resize(npoints_+1);
-    ypps_.resize(npoints_+1);
+    MustBeTrue(npoints_ > 1);
+    xs_.resize(npoints_);
+    ys_.resize(npoints_);
+    ypps_.resize(npoints_);
     for (int i=0; i<npoints_; ++i)
     {
         xs_[i] = x[i];
@@ -36,8 +36,8 @@ CubicSpline<DT>::CubicSpline(
     npoints_(0), yp1_(yp1), ypn_(ypn), xs_(xs), ys_(ys), ypps_()
 {
     MustBeTrue(xs_.size() == ys_.size());
-    MustBeTrue((npoints_= xs_.size()) > 0);
-    ypps_.resize(npoints_+1);
+    MustBeTrue((npoints_= xs_.size()) > 1);
+    ypps_.resize(npoints_);
     calculate();
 }
 
@@ -72,24 +72,27 @@ CubicSpline<DT>::operator=(const CubicSpline<DT> &cs)
     return(*this);
 }
 
-// calculates spline parameters
+// calculates spline parameters. knots are 0 to npoints-1, and a
+// zero end derivative means a natural end.
 template <class DT>
 int
 CubicSpline<DT>::calculate()
 {
+    int n = npoints_-1;
+    MustBeTrue(n > 0);
     Values u(npoints_);
     if (yp1_ == DT(0))
     {
-        ypps_[1] = DT(0);
-        u[1] = DT(0);
+        ypps_[0] = DT(0);
+        u[0] = DT(0);
     }
     else
     {
-        ypps_[1] = DT(-0.5);
-        u[1] = (DT(3.0)/(xs_[2]-xs_[1]))*((ys_[2]-ys_[1])/(xs_[2]-xs_[1])-yp1_);
+        ypps_[0] = DT(-0.5);
+        u[0] = (DT(3.0)/(xs_[1]-xs_[0]))*((ys_[1]-ys_[0])/(xs_[1]-xs_[0])-yp1_);
     }
 
-    for (int i=2; i<=(npoints_-1);++i)
+    for (int i=1; i<=(n-1);++i)
     {
         DT sig = (xs_[i]-xs_[i-1])/(xs_[i+1]-xs_[i-1]);
         DT p = sig*ypps_[i-1] + DT(2.0);
@@ -108,11 +111,11 @@ CubicSpline<DT>::calculate()
     else
     {
         qn = DT(0.5);
-        un = (DT(3.0)/(xs_[npoints_]-xs_[npoints_-1]))*(ypn_-(ys_[npoints_]-ys_[npoints_-1])/(xs_[npoints_]-xs_[npoints_-1]));
+        un = (DT(3.0)/(xs_[n]-xs_[n-1]))*(ypn_-(ys_[n]-ys_[n-1])/(xs_[n]-xs_[n-1]));
     }
 
-    ypps_[npoints_]=(un-qn*u[npoints_-1])/(qn*ypps_[npoints_-1]+DT(1.0));
-    for (int k=npoints_-1; k>=1; --k)
+    ypps_[n]=(un-qn*u[n-1])/(qn*ypps_[n-1]+DT(1.0));
+    for (int k=n-1; k>=0; --k)
     {
         ypps_[k] = ypps_[k]*ypps_[k+1]+u[k];
     }
@@ -125,10 +128,10 @@ int
 CubicSpline<DT>::calculate(int npoints, const DT x[], const DT y[],
                            DT yp1, DT ypn)
 {
-    MustBeTrue((npoints_ = npoints) > 0);
-    xs_.resize(npoints_+1);
-    ys_.resize(npoints_+1);
-    ypps_.resize(npoints_+1);
+    MustBeTrue((npoints_ = npoints) > 1);
+    xs_.resize(npoints_);
+    ys_.resize(npoints_);
+    ypps_.resize(npoints_);
     for (int i=0; i<npoints_; ++i)
     {
         xs_[i] = x[i];
@@ -146,12 +149,12 @@ CubicSpline<DT>::calculate(const Coordinates &xs, const Coordinates &ys,
                            DT yp1, DT ypn)
 {
     MustBeTrue(xs.size() == ys.size());
-    MustBeTrue((npoints_= xs.size()) > 0);
+    MustBeTrue((npoints_= xs.size()) > 1);
     xs_ = xs;
     ys_ = ys;
     yp1_ = yp1;
     ypn_ = ypn;
-    ypps_.resize(npoints_+1);
+    ypps_.resize(npoints_);
     calculate();
     return(0);
 }
@@ -166,8 +169,39 @@ CubicSpline<DT>::interpolate(DT x) const
     else if (x >= xs_[npoints_-1])
         return(ys_[npoints_-1]);
 
-    int klo = 1;
-    int khi = npoints_;
+    int klo, khi;
+    locate(x, klo, khi);
+    DT h = xs_[khi]-xs_[klo];
+    MustBeTrue (h != DT(0));
+    DT a = (xs_[khi]-x)/h;
+    DT b = (x-xs_[klo])/h;
+    return(a*ys_[klo]+b*ys_[khi]+((a*a*a-a)*ypps_[klo]+(b*b*b-b)*ypps_[khi])*(h*h)/DT(6.0));
+}
+
+// first derivative, zero outside the knots like the values
+template <class DT>
+DT
+CubicSpline<DT>::derivative(DT x) const
+{
+    if (x < xs_[0] || x > xs_[npoints_-1])
+        return(DT(0));
+
+    int klo, khi;
+    locate(x, klo, khi);
+    DT h = xs_[khi]-xs_[klo];
+    MustBeTrue (h != DT(0));
+    DT a = (xs_[khi]-x)/h;
+    DT b = (x-xs_[klo])/h;
+    return((ys_[khi]-ys_[klo])/h-((DT(3.0)*a*a-DT(1.0))*ypps_[klo]-(DT(3.0)*b*b-DT(1.0))*ypps_[khi])*h/DT(6.0));
+}
+
+// bisection for the knots around x
+template <class DT>
+void
+CubicSpline<DT>::locate(DT x, int &klo, int &khi) const
+{
+    klo = 0;
+    khi = npoints_-1;
     while ((khi-klo) > 1)
     {
         int k = (khi+klo) >> 1;
@@ -176,11 +210,6 @@ CubicSpline<DT>::interpolate(DT x) const
         else
             klo = k;
     }
-    DT h = xs_[khi]-xs_[klo];
-    MustBeTrue (h != DT(0));
-    DT a = (xs_[khi]-x)/h;
-    DT b = (x-xs_[klo])/h;
-    return(a*ys_[klo]+b*ys_[khi]+((a*a*a-a)*ypps_[klo]+(b*b*b-b)*ypps_[khi])*(h*h)/DT(6.0));
 }
 
 template <class DT>
@@ -207,6 +236,17 @@ CubicSpline<DT>::interpolate(int npoints, const DT x[], DT y[]) const
     }
 }
 
+template <class DT>
+void
+CubicSpline<DT>::interpolate(const Coordinates &xs, Coordinates &ys) const
+{
+    ys.resize(xs.size());
+    for (size_t i=0; i<xs.size(); ++i)
+    {
+        ys[i] = interpolate(xs[i]);
+    }
+}
+
 template <class DT>
 std::ostream &
 operator<<(std::ostream &os, const CubicSpline<DT> &c)
@@ -0,0 +1,115 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __UNIFORM_CUBIC_SPLINE_H
+#define __UNIFORM_CUBIC_SPLINE_H
+
+// cubic spline on a uniform grid of knots. the segment of x is found
+// by one multiply, (x-x0)/h, instead of a bisection, and each segment
+// is kept as the four coefficients of a cubic in the fraction of the
+// way across it, so a value costs a multiply, a truncation and three
+// multiply-adds, and the batch path is one loop with no branches.
+//
+// the segments come from a cubic spline through the knot values (the
+// same fit as CubicSpline), from the values and first derivatives at
+// the knots (hermite), or from an existing CubicSpline resampled on
+// the grid.
+
+// headers
+#include <vector>
+#include <ostream>
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "interpolation/CubicSpline.h"
+
+namespace ombt {
+
+// forward declarations
+template <class DT> class UniformCubicSpline;
+template <class DT> std::ostream &operator<<(std::ostream &, const UniformCubicSpline<DT> &);
+
+// uniform cubic spline class
+template <class DT>
+class UniformCubicSpline {
+public:
+    // types
+    typedef std::vector<DT> Values;
+
+    // ctors and dtor. the npoints knots are x0 to xn evenly spaced.
+    UniformCubicSpline();
+    UniformCubicSpline(DT x0, DT xn, int npoints, const DT y[],
+                       DT yp1 = DT(0), DT ypn = DT(0));
+    UniformCubicSpline(DT x0, DT xn, const Values &ys,
+                       DT yp1 = DT(0), DT ypn = DT(0));
+    UniformCubicSpline(DT x0, DT xn, int npoints, const DT y[],
+                       const DT yp[]);
+    UniformCubicSpline(const CubicSpline<DT> &cs, DT x0, DT xn, int npoints);
+    UniformCubicSpline(const UniformCubicSpline &ucs);
+    ~UniformCubicSpline();
+
+    // assignment
+    UniformCubicSpline &operator=(const UniformCubicSpline &ucs);
+
+    // calculate segments: spline through the values, with end
+    // derivatives (zero for a natural end) like CubicSpline
+    int calculate(DT x0, DT xn, int npoints, const DT y[],
+                  DT yp1 = DT(0), DT ypn = DT(0));
+    int calculate(DT x0, DT xn, const Values &ys,
+                  DT yp1 = DT(0), DT ypn = DT(0));
+
+    // calculate segments: hermite, values and first derivatives
+    int hermite(DT x0, DT xn, int npoints, const DT y[], const DT yp[]);
+
+    // interpolate for given value(s) of x, end values outside x0 to xn
+    DT operator()(DT x) const { return(interpolate(x)); }
+    inline DT interpolate(DT x) const {
+        int i;
+        DT t = locate(x, i);
+        const DT *c = &coefficients_[4*i];
+        return(((c[3]*t+c[2])*t+c[1])*t+c[0]);
+    }
+    void interpolate(DT x, DT &y) const { y = interpolate(x); }
+    void interpolate(int npoints, const DT xs[], DT ys[]) const;
+    void interpolate(const Values &xs, Values &ys) const;
+
+    // first derivative for a given value of x
+    DT derivative(DT x) const;
+
+    // grid
+    int size() const { return(segments_+1); }
+    int segments() const { return(segments_); }
+    DT lower() const { return(x0_); }
+    DT upper() const { return(xn_); }
+    DT knot(int i) const { return(knots_[i]); }
+
+    // output
+    friend std::ostream &operator<<<>(std::ostream &, const UniformCubicSpline<DT> &);
+
+private:
+    // segment of x and the fraction across it, clamped to the grid
+    inline DT locate(DT x, int &i) const {
+        DT s = (x-x0_)*inverse_;
+        s = (s > DT(0)) ? s : DT(0);
+        s = (s < DT(segments_)) ? s : DT(segments_);
+        i = int(s);
+        i = (i < segments_) ? i : segments_-1;
+        return(s-DT(i));
+    }
+    void grid(DT x0, DT xn, int npoints);
+
+    // data
+    int segments_;
+    DT x0_;
+    DT xn_;
+    DT h_;
+    DT inverse_;
+    Values knots_;
+    Values coefficients_;
+};
+
+#include "interpolation/UniformCubicSpline.i"
+
+}
+#endif
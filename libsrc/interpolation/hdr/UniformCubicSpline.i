@@ -0,0 +1,222 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// uniform cubic spline class
+//
+// a segment from knot i to i+1 is y(t) = c0 + c1*t + c2*t^2 + c3*t^3,
+// with t = (x-x(i))/h from 0 to 1. for values y0, y1 and first
+// derivatives d0, d1 at its ends (hermite form):
+//
+// c0 = y0, c1 = h*d0,
+// c2 = 3*(y1-y0) - h*(2*d0+d1),
+// c3 = 2*(y0-y1) + h*(d0+d1).
+//
+// a cubic spline is a hermite cubic with the spline's derivatives at
+// the knots, so every fit goes through hermite().
+
+// constructors and destructor
+template <class DT>
+UniformCubicSpline<DT>::UniformCubicSpline():
+    segments_(0), x0_(0), xn_(0), h_(0), inverse_(0),
+    knots_(), coefficients_()
+{
+    // do nothing
+}
+
+template <class DT>
+UniformCubicSpline<DT>::UniformCubicSpline(DT x0, DT xn, int npoints,
+    const DT y[], DT yp1, DT ypn):
+    segments_(0), x0_(0), xn_(0), h_(0), inverse_(0),
+    knots_(), coefficients_()
+{
+    calculate(x0, xn, npoints, y, yp1, ypn);
+}
+
+template <class DT>
+UniformCubicSpline<DT>::UniformCubicSpline(DT x0, DT xn, 
+    const Values &ys, DT yp1, DT ypn):
+    segments_(0), x0_(0), xn_(0), h_(0), inverse_(0),
+    knots_(), coefficients_()
+{
+    calculate(x0, xn, ys, yp1, ypn);
+}
+
+template <class DT>
+UniformCubicSpline<DT>::UniformCubicSpline(DT x0, DT xn, int npoints,
+    const DT y[], const DT yp[]):
+    segments_(0), x0_(0), xn_(0), h_(0), inverse_(0),
+    knots_(), coefficients_()
+{
+    hermite(x0, xn, npoints, y, yp);
+}
+
+template <class DT>
+UniformCubicSpline<DT>::UniformCubicSpline(const CubicSpline<DT> &cs,
+    DT x0, DT xn, int npoints):
+    segments_(0), x0_(0), xn_(0), h_(0), inverse_(0),
+    knots_(), coefficients_()
+{
+    grid(x0, xn, npoints);
+    Values y(npoints);
+    Values yp(npoints);
+    for (int i=0; i<npoints; ++i)
+    {
+        y[i] = cs.interpolate(knots_[i]);
+        yp[i] = cs.derivative(knots_[i]);
+    }
+    hermite(x0, xn, npoints, &y[0], &yp[0]);
+}
+
+template <class DT>
+UniformCubicSpline<DT>::UniformCubicSpline(const UniformCubicSpline<DT> &ucs):
+    segments_(ucs.segments_), x0_(ucs.x0_), xn_(ucs.xn_), h_(ucs.h_),
+    inverse_(ucs.inverse_), knots_(ucs.knots_),
+    coefficients_(ucs.coefficients_)
+{
+    // do nothing
+}
+
+template <class DT>
+UniformCubicSpline<DT>::~UniformCubicSpline()
+{
+    // do nothing
+}
+
+// assignments
+template <class DT>
+UniformCubicSpline<DT> &
+UniformCubicSpline<DT>::operator=(const UniformCubicSpline<DT> &ucs)
+{
+    if (this != &ucs)
+    {
+        segments_ = ucs.segments_;
+        x0_ = ucs.x0_;
+        xn_ = ucs.xn_;
+        h_ = ucs.h_;
+        inverse_ = ucs.inverse_;
+        knots_ = ucs.knots_;
+        coefficients_ = ucs.coefficients_;
+    }
+    return(*this);
+}
+
+// knots of the grid
+template <class DT>
+void
+UniformCubicSpline<DT>::grid(DT x0, DT xn, int npoints)
+{
+    MustBeTrue(npoints > 1);
+    MustBeTrue(xn > x0);
+    segments_ = npoints-1;
+    x0_ = x0;
+    xn_ = xn;
+    h_ = (xn-x0)/DT(segments_);
+    inverse_ = DT(segments_)/(xn-x0);
+    knots_.resize(npoints);
+    for (int i=0; i<segments_; ++i)
+    {
+        knots_[i] = x0+DT(i)*h_;
+    }
+    knots_[segments_] = xn;
+}
+
+// spline through the values
+template <class DT>
+int
+UniformCubicSpline<DT>::calculate(DT x0, DT xn, int npoints, const DT y[],
+                                  DT yp1, DT ypn)
+{
+    grid(x0, xn, npoints);
+    CubicSpline<DT> cs(npoints, &knots_[0], y, yp1, ypn);
+    Values yp(npoints);
+    for (int i=0; i<npoints; ++i)
+    {
+        yp[i] = cs.derivative(knots_[i]);
+    }
+    return(hermite(x0, xn, npoints, y, &yp[0]));
+}
+
+template <class DT>
+int
+UniformCubicSpline<DT>::calculate(DT x0, DT xn, const Values &ys,
+                                  DT yp1, DT ypn)
+{
+    MustBeTrue(ys.size() > 1);
+    return(calculate(x0, xn, int(ys.size()), &ys[0], yp1, ypn));
+}
+
+// hermite segments
+template <class DT>
+int
+UniformCubicSpline<DT>::hermite(DT x0, DT xn, int npoints, const DT y[],
+                                const DT yp[])
+{
+    grid(x0, xn, npoints);
+    coefficients_.resize(4*segments_);
+    for (int i=0; i<segments_; ++i)
+    {
+        DT dy = y[i+1]-y[i];
+        DT d0 = h_*yp[i];
+        DT d1 = h_*yp[i+1];
+        DT *c = &coefficients_[4*i];
+        c[0] = y[i];
+        c[1] = d0;
+        c[2] = DT(3.0)*dy-DT(2.0)*d0-d1;
+        c[3] = d0+d1-DT(2.0)*dy;
+    }
+    return(0);
+}
+
+// batch interpolation, no branches in the loop
+template <class DT>
+void
+UniformCubicSpline<DT>::interpolate(int npoints, const DT xs[], DT ys[]) const
+{
+    const DT *coefficients = &coefficients_[0];
+    for (int k=0; k<npoints; ++k)
+    {
+        int i;
+        DT t = locate(xs[k], i);
+        const DT *c = coefficients+4*i;
+        ys[k] = ((c[3]*t+c[2])*t+c[1])*t+c[0];
+    }
+}
+
+template <class DT>
+void
+UniformCubicSpline<DT>::interpolate(const Values &xs, Values &ys) const
+{
+    ys.resize(xs.size());
+    if (!xs.empty()) interpolate(int(xs.size()), &xs[0], &ys[0]);
+}
+
+// first derivative, zero outside the grid
+template <class DT>
+DT
+UniformCubicSpline<DT>::derivative(DT x) const
+{
+    if (x < x0_ || x > xn_)
+        return(DT(0));
+
+    int i;
+    DT t = locate(x, i);
+    const DT *c = &coefficients_[4*i];
+    return(((DT(3.0)*c[3]*t+DT(2.0)*c[2])*t+c[1])*inverse_);
+}
+
+template <class DT>
+std::ostream &
+operator<<(std::ostream &os, const UniformCubicSpline<DT> &c)
+{
+    os << "Uniform Cubic Spline Segments:" << std::endl;
+    for (int i=0; i<c.segments_; ++i)
+    {
+        os << "[" << i << "] x = " << c.knots_[i] << ", ("
+           << c.coefficients_[4*i] << ", " << c.coefficients_[4*i+1]
+           << ", " << c.coefficients_[4*i+2] << ", "
+           << c.coefficients_[4*i+3] << ")" << std::endl;
+    }
+    return(os);
+}
@@ -0,0 +1,46 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_CHOLESKY_H
+#define __OMBT_CHOLESKY_H
+
+// cholesky decomposition definitions
+
+// headers
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "matrix/Vector.h"
+#include "matrix/Matrix.h"
+#include "matrix/Epsilon.h"
+
+namespace ombt {
+
+// calculates cholesky decomposition, m = L*L', for a symmetric
+// positive definite matrix. L replaces m.
+template <class T>
+int
+Cholesky(Matrix<T> &, T);
+
+// solves set of linear equations using results of 
+// cholesky decomposition
+template <class T>
+int
+SolveUsingCholesky(Matrix<T> &, Vector<T> &, Vector<T> &);
+
+// calculate the determinant using cholesky results
+template <class T>
+int
+GetDeterminantUsingCholesky(Matrix<T> &, T &);
+
+}
+
+#include "matrix/Cholesky.i"
+
+#endif
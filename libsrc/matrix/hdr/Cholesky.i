@@ -0,0 +1,155 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+//
+// this file contain functions for factoring a symmetric positive
+// definite matrix M into M = L*L', where L is lower triangular
+// with a positive diagonal.
+//
+// the elements of L are found column by column:
+//
+//	l(j, j) = sqrt(m(j, j) - sum(k < j) l(j, k)^2)
+//	l(i, j) = (m(i, j) - sum(k < j) l(i, k)*l(j, k))/l(j, j), i > j
+//
+// only the lower triangle of M is read. the square root fails, or
+// the diagonal becomes too small, only if M is not positive definite,
+// so the factorization doubles as a test for it. no pivoting is
+// needed; the factorization is stable for any positive definite M.
+//
+// M*x = y is then solved as L*z = y by forward substitution and
+// L'*x = z by back substitution.
+//
+
+namespace ombt {
+
+//
+// given a symmetric positive definite matrix, replace it with its
+// cholesky factor L. the upper triangle is set to zero.
+//
+template <class T>
+int
+Cholesky(Matrix<T> &m, T ep)
+{
+	// must be a square matrix
+	MustBeTrue(m.getRows() == m.getCols() && m.getRows() > 0);
+
+	// check epsilon, set if invalid
+	T minep = calcEpsilon(T(0));
+	if ((ep = fabs(ep)) < minep)
+		ep = minep;
+
+	// get number of rows and columns
+	int max = m.getRows();
+
+	// factor column by column
+	for (int j = 0; j < max; j++)
+	{
+		// diagonal element. a pivot that is not positive, or is
+		// lost in the rounding of the original diagonal, means
+		// the matrix is not positive definite.
+		T d = m(j, j);
+		for (int k = 0; k < j; k++)
+		{
+			d -= m(j, k)*m(j, k);
+		}
+		if (!(d > ep*fabs(m(j, j))))
+			return(NOTOK);
+		T ljj = sqrt(d);
+		m(j, j) = ljj;
+
+		// rest of the column
+		for (int i = j+1; i < max; i++)
+		{
+			T s = m(i, j);
+			for (int k = 0; k < j; k++)
+			{
+				CheckForOverFlow(m(i, k), m(j, k));
+				s -= m(i, k)*m(j, k);
+			}
+			m(i, j) = s/ljj;
+		}
+
+		// clear upper triangle
+		for (int i = 0; i < j; i++)
+		{
+			m(i, j) = 0;
+		}
+	}
+
+	// all done
+	return(OK);
+}
+
+//
+// given a cholesky decomposition of a matrix, solve for x-vector 
+// using the given y-vector.
+//
+template <class T>
+int
+SolveUsingCholesky(Matrix<T> &m, Vector<T> &x, Vector<T> &y)
+{
+	// must be a square matrix
+	MustBeTrue(m.getRows() == m.getCols() && m.getRows() > 0);
+
+	// get number of rows and columns
+	int max = m.getRows();
+
+	// forward substitution, L*z = y
+	for (int i = 0; i < max; i++)
+	{
+		T s = y[i];
+		for (int k = 0; k < i; k++)
+		{
+			CheckForOverFlow(m(i, k), x[k]);
+			s -= m(i, k)*x[k];
+		}
+		x[i] = s/m(i, i);
+	}
+
+	// backward substitution, L'*x = z
+	for (int i = max-1; i >= 0; i--)
+	{
+		T s = x[i];
+		for (int k = i+1; k < max; k++)
+		{
+			CheckForOverFlow(m(k, i), x[k]);
+			s -= m(k, i)*x[k];
+		}
+		x[i] = s/m(i, i);
+	}
+
+	// all done
+	return(OK);
+}
+
+//
+// given a cholesky decomposition of a matrix,
+// calculate the determinant of the original matrix.
+//
+template <class T>
+int
+GetDeterminantUsingCholesky(Matrix<T> &m, T &d)
+{
+	// must be a square matrix
+	MustBeTrue(m.getRows() == m.getCols() && m.getRows() > 0);
+
+	// get number of rows and columns
+	int max = m.getRows();
+
+	// get determinant, the square of the product of the diagonal
+	d = 1;
+	for (int i = 0; i < max; i++)
+	{
+		CheckForOverFlow(d, m(i, i));
+		d = d*m(i, i);
+	}
+	CheckForOverFlow(d, d);
+	d = d*d;
+
+	// all done
+	return(OK);
+}
+
+}
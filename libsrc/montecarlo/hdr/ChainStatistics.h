@@ -0,0 +1,128 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_CHAIN_STATISTICS_H
+#define __OMBT_CHAIN_STATISTICS_H
+
+// streaming convergence diagnostics for markov chains.
+//
+// the draws of each parameter are kept as batches, as in batch
+// means: up to 2k batches with their means and sums of squared
+// deviations, and when they are full, neighbours are combined into
+// k batches of twice the size (chan's pairwise formulas). memory is
+// fixed however long the chain runs.
+//
+// draws go to the current chain. merging appends the chains of the
+// other accumulator, so each thread runs one chain into its own
+// accumulator and the results are merged afterwards, in chain order.
+//
+// over the full batches:
+//
+// rhat is the split potential scale reduction factor of gelman et
+// al., bayesian data analysis, 3rd ed., section 11.4: each chain is
+// cut into its first and second halves, and the variance between
+// the halves is compared with the variance within them. values near
+// 1 say the chains agree; above about 1.01 they have not mixed.
+//
+// ess is the effective sample size from the batch means estimate of
+// the long-run variance of each chain, n s^2 / (b var(batch means)),
+// summed over the chains. the batches must be long compared with the
+// autocorrelation time, so short chains overstate it.
+
+// system headers
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+
+namespace ombt {
+
+// per-parameter batch statistics of a set of chains
+class ChainStatistics: public BaseObject
+{
+public:
+    // sizes
+    enum { DefaultBatches = 32 };
+
+    // ctors and dtor
+    ChainStatistics();
+    ChainStatistics(size_t dimension, unsigned int batches = DefaultBatches);
+    ChainStatistics(const ChainStatistics &src);
+    ~ChainStatistics();
+
+    // assignment
+    ChainStatistics &operator=(const ChainStatistics &rhs);
+
+    // draws, dimension values each, go to the current chain
+    void clear();
+    inline void add(const double *x) {
+        Chain &chain = chains_.back();
+        double inverse = 1.0/double(++chain.partial);
+        double *mean = &chain.pmean[0];
+        double *m2 = &chain.pm2[0];
+        for (size_t i=0; i<dimension_; ++i)
+        {
+            double delta = x[i] - mean[i];
+            mean[i] += delta*inverse;
+            m2[i] += delta*(x[i] - mean[i]);
+        }
+        ++chain.count;
+        if (chain.partial == chain.size) flush(chain);
+    }
+    void startChain();
+    void merge(const ChainStatistics &other);
+
+    // sizes
+    size_t dimension() const { return(dimension_); }
+    size_t chains() const { return(chains_.size()); }
+    uint64_t count() const;
+    uint64_t count(size_t chain) const { return(chains_[chain].count); }
+
+    // parameter i over all the draws of all the chains
+    double mean(size_t i) const;
+    double variance(size_t i) const;
+
+    // diagnostics of parameter i over the full batches
+    double rhat(size_t i) const;
+    double ess(size_t i) const;
+    double standardError(size_t i) const;
+
+protected:
+    // one chain. the batches are parameter by parameter, 2k each.
+    struct Chain {
+        uint64_t count;
+        uint64_t size;
+        uint64_t partial;
+        size_t full;
+        std::vector<double> pmean;
+        std::vector<double> pm2;
+        std::vector<double> bmean;
+        std::vector<double> bm2;
+    };
+
+    // utilities
+    void reset(Chain &chain) const;
+    void flush(Chain &chain);
+    static void combine(double &n, double &mean, double &m2,
+                        double nb, double meanb, double m2b);
+    void batches(const Chain &chain, size_t i, size_t first, size_t last,
+                 double &n, double &mean, double &m2) const;
+    void totals(size_t i, double &n, double &mean, double &m2) const;
+
+protected:
+    // internal data
+    size_t dimension_;
+    unsigned int batches_;
+    std::vector<Chain> chains_;
+};
+
+}
+
+#endif
@@ -0,0 +1,164 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_GOODNESS_OF_FIT_H
+#define __OMBT_GOODNESS_OF_FIT_H
+
+// goodness-of-fit of a sampler against the exact distribution
+// function, with chi-square, kolmogorov-smirnov and anderson-darling
+// tests.
+//
+// every variate x is mapped to u = F(x), which is uniform on (0,1)
+// when the sampler is right. for discrete distributions u is drawn
+// uniformly from (F(x-1), F(x)], which is uniform as well (the
+// randomized probability integral transform), so one set of tests
+// serves both kinds. the u are counted in Bins equal bins, which
+// is all that is kept, so any number of variates streams through
+// in fixed memory, and the counts of the MonteCarlo chunks merge.
+//
+//     MonteCarloT<Xoshiro256> driver(Xoshiro256(key), 1<<22);
+//     GoodnessOfFit fit;
+//     fit.sample(pool, driver, factory, GaussianT<Xoshiro256>(...), n);
+//     if (!fit.passed(1.0e-3)) ...
+//
+// the tests work on the binned u:
+//
+// chi-square - the bins are combined into about 2 n^(2/5) equal
+// cells, at least 5 expected per cell.
+//
+// kolmogorov-smirnov - the largest distance between the empirical
+// and uniform distribution functions at the bin edges. the true
+// supremum is within 1/Bins of it. p-value from the asymptotic
+// distribution with stephens' correction.
+//
+// anderson-darling - the integral n int (Fn(u)-u)^2/(u(1-u)) du,
+// taking the u in a bin as spread evenly across it. p-value from
+// the asymptotic distribution (marsaglia and marsaglia, 2004).
+//
+// values of u outside [0,1] (nans from the sampler, or values
+// outside the support) are counted as invalid and fail the test.
+
+// system headers
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+#include <utility>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+#include "random/SplitMix64.h"
+#include "threads/ThreadPool.h"
+#include "montecarlo/MonteCarlo.h"
+
+namespace ombt {
+
+// binned probability integral transforms and the tests on them
+class GoodnessOfFit: public BaseObject
+{
+public:
+    // kind of distribution
+    enum Kind { Continuous, Discrete };
+
+    // bins for the transformed values
+    enum { DefaultBins = 1<<16 };
+
+    // ctors and dtor
+    GoodnessOfFit(Kind kind = Continuous, size_t bins = DefaultBins);
+    GoodnessOfFit(const GoodnessOfFit &src);
+    ~GoodnessOfFit();
+
+    // assignment
+    GoodnessOfFit &operator=(const GoodnessOfFit &rhs);
+
+    // draw n variates with the factory's samplers on the driver's
+    // streams, and test them against the reference distribution
+    template <class RNG, class Factory, class Dist>
+    void sample(ThreadPool &pool, const MonteCarloT<RNG> &driver,
+                const Factory &factory, const Dist &reference,
+                uint64_t n);
+    template <class RNG, class Factory, class Dist>
+    void sample(const MonteCarloT<RNG> &driver, const Factory &factory,
+                const Dist &reference, uint64_t n);
+
+    // reducer interface, the values are already transformed
+    void clear();
+    void add(const double *u, size_t n);
+    void merge(const GoodnessOfFit &other);
+
+    // counts
+    Kind kind() const { return(kind_); }
+    size_t bins() const { return(counts_.size()); }
+    uint64_t count() const { return(count_); }
+    uint64_t invalid() const { return(invalid_); }
+
+    // statistics and their p-values
+    double chiSquare() const;
+    unsigned long chiSquareCells() const;
+    double chiSquareP() const;
+    double kolmogorovSmirnov() const;
+    double kolmogorovSmirnovP() const;
+    double andersonDarling() const;
+    double andersonDarlingP() const;
+
+    // no invalid values, and all three p-values at least alpha
+    bool passed(double alpha) const;
+
+    // sampler adapter, turns variates into transformed values
+    template <class Sampler, class Dist>
+    class TransformSampler {
+    public:
+        TransformSampler(const Sampler &sampler, const Dist &reference,
+                         Kind kind, uint64_t seed):
+            sampler_(sampler), reference_(reference), kind_(kind),
+            jitter_(seed), below_() {
+        }
+
+        void fill(double *out, size_t n);
+
+    protected:
+        Sampler sampler_;
+        Dist reference_;
+        Kind kind_;
+        SplitMix64 jitter_;
+        std::vector<double> below_;
+    };
+
+    // factory adapter, one transform sampler per stream
+    template <class RNG, class Factory, class Dist>
+    class TransformFactory {
+    public:
+        // what the factory makes
+        typedef decltype(std::declval<const Factory &>()(
+            std::declval<const RNG &>())) Sampler;
+
+        TransformFactory(const Factory &factory, const Dist &reference,
+                         Kind kind):
+            factory_(factory), reference_(reference), kind_(kind) {
+        }
+
+        TransformSampler<Sampler, Dist> operator()(const RNG &stream) const;
+
+    protected:
+        const Factory &factory_;
+        const Dist &reference_;
+        Kind kind_;
+    };
+
+protected:
+    // internal data
+    Kind kind_;
+    std::vector<uint64_t> counts_;
+    uint64_t count_;
+    uint64_t invalid_;
+};
+
+}
+
+#include "montecarlo/GoodnessOfFit.i"
+
+#endif
@@ -0,0 +1,74 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// goodness-of-fit of a sampler
+
+namespace ombt {
+
+// draw, transform and count
+template <class RNG, class Factory, class Dist>
+void
+GoodnessOfFit::sample(ThreadPool &pool, const MonteCarloT<RNG> &driver,
+                      const Factory &factory, const Dist &reference,
+                      uint64_t n)
+{
+    MustBeTrue(isOk());
+    TransformFactory<RNG, Factory, Dist> transform(factory, reference, kind_);
+    driver.run(pool, transform, n, *this);
+}
+
+template <class RNG, class Factory, class Dist>
+void
+GoodnessOfFit::sample(const MonteCarloT<RNG> &driver, const Factory &factory,
+                      const Dist &reference, uint64_t n)
+{
+    MustBeTrue(isOk());
+    TransformFactory<RNG, Factory, Dist> transform(factory, reference, kind_);
+    driver.run(transform, n, *this);
+}
+
+// variates to uniform values. discrete values take a uniform
+// point between the distribution function just below and at
+// the value.
+template <class Sampler, class Dist>
+void
+GoodnessOfFit::TransformSampler<Sampler, Dist>::fill(double *out, size_t n)
+{
+    sampler_.fill(out, n);
+    if (kind_ == Continuous)
+    {
+        reference_.cdf(out, out, n);
+        return;
+    }
+
+    if (below_.size() < n) below_.resize(n);
+    for (size_t i=0; i<n; ++i)
+    {
+        below_[i] = out[i] - 1.0;
+    }
+    reference_.cdf(&below_[0], &below_[0], n);
+    reference_.cdf(out, out, n);
+    for (size_t i=0; i<n; ++i)
+    {
+        double v = (jitter_.next() >> 11)*(1.0/9007199254740992.0);
+        out[i] = below_[i] + v*(out[i] - below_[i]);
+    }
+}
+
+// a sampler for the stream, and a seed for the discrete jitter
+// drawn from it first
+template <class RNG, class Factory, class Dist>
+GoodnessOfFit::TransformSampler<
+    typename GoodnessOfFit::TransformFactory<RNG, Factory, Dist>::Sampler, Dist>
+GoodnessOfFit::TransformFactory<RNG, Factory, Dist>::operator()(
+    const RNG &stream) const
+{
+    RNG s(stream);
+    uint64_t seed = s.random();
+    return(TransformSampler<Sampler, Dist>(factory_(s), reference_,
+                                           kind_, seed));
+}
+
+}
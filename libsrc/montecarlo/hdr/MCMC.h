@@ -0,0 +1,167 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_MCMC_H
+#define __OMBT_MCMC_H
+
+// parallel markov chain monte carlo driver.
+//
+// k independent chains run as jobs on a pool, chain i with a
+// sampler built on substream i of the master engine, so its draws
+// are the same whichever thread runs it, or whether a pool is used
+// at all. each chain starts from its own point, burns in with
+// sampler.adapt(), then keeps every thin-th state of sampler.step()
+// until it has the draws asked for. the kept states go to the
+// chain's own diagnostics (ChainStatistics.h), and are stored too
+// if asked, and the chains' diagnostics are merged in chain order.
+//
+// the sampler is a template argument, see Samplers.h for targets
+// and samplers:
+//
+//     MCMCT<Xoshiro256> mcmc(Xoshiro256(1), 4);
+//     mcmc.run<MetropolisT<Xoshiro256, Model> >(pool, model, starts,
+//                                               100000, 10000, 10);
+//     double rhat = mcmc.statistics().rhat(0);
+//
+// the starts are chains*dimension values, chain by chain. starts
+// spread out over the target make rhat a real check.
+
+// system headers
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+#include "random/Random.h"
+#include "threads/Job.h"
+#include "threads/ThreadPool.h"
+#include "threads/CountDownLatch.h"
+#include "montecarlo/ChainStatistics.h"
+#include "montecarlo/Samplers.h"
+
+namespace ombt {
+
+// mcmc driver
+template <class RNG>
+class MCMCT: public BaseObject
+{
+public:
+    // sizes
+    enum { DefaultChains = 4 };
+
+    // ctors and dtor
+    MCMCT();
+    MCMCT(const RNG &master, size_t chains = DefaultChains,
+          bool keep = false);
+    MCMCT(const MCMCT &src);
+    ~MCMCT();
+
+    // assignment
+    MCMCT &operator=(const MCMCT &rhs);
+
+    // run the chains on the pool's threads, or in this thread.
+    // each chain does burnin + draws*thin iterations.
+    template <class Sampler, class Target>
+    void run(ThreadPool &pool, const Target &target, const double *starts,
+             uint64_t draws, uint64_t burnin = 0, uint64_t thin = 1);
+    template <class Sampler, class Target>
+    void run(const Target &target, const double *starts,
+             uint64_t draws, uint64_t burnin = 0, uint64_t thin = 1);
+
+    // diagnostics of the last run, all chains
+    size_t chains() const { return(chains_); }
+    const ChainStatistics &statistics() const { return(statistics_); }
+
+    // counts after burn-in, and the kept draws, dimension values
+    // each, of chain i of the last run
+    uint64_t proposals(size_t i) const { return(results_[i].proposals); }
+    uint64_t accepted(size_t i) const { return(results_[i].accepted); }
+    uint64_t evaluations(size_t i) const {
+        return(results_[i].evaluations);
+    }
+    double acceptance(size_t i) const;
+    const std::vector<double> &draws(size_t i) const {
+        return(results_[i].draws);
+    }
+
+protected:
+    // what a chain leaves behind
+    struct Result {
+        ChainStatistics statistics;
+        std::vector<double> draws;
+        uint64_t proposals;
+        uint64_t accepted;
+        uint64_t evaluations;
+    };
+
+    // run chain i into its result
+    template <class Sampler, class Target>
+    void runChain(const Target &target, const double *start, size_t i,
+                  uint64_t draws, uint64_t burnin, uint64_t thin,
+                  Result &result) const;
+
+    // merge the chains' diagnostics
+    void merge(size_t dimension);
+
+    // one chain as a pool job. the pool owns and deletes the job,
+    // the driver owns everything the job points to.
+    template <class Sampler, class Target>
+    class ChainJob: public Job {
+    public:
+        ChainJob(const MCMCT &driver, const Target &target,
+                 const double *start, size_t chain, uint64_t draws,
+                 uint64_t burnin, uint64_t thin, Result &result,
+                 CountDownLatch &latch):
+            Job(), driver_(driver), target_(target), start_(start),
+            chain_(chain), draws_(draws), burnin_(burnin), thin_(thin),
+            result_(result), latch_(latch) {
+        }
+        virtual ~ChainJob() {
+        }
+
+        virtual JobReturn run() {
+            driver_.template runChain<Sampler, Target>(
+                target_, start_, chain_, draws_, burnin_, thin_, result_);
+            latch_.countDown();
+            return Finished;
+        }
+
+    private:
+        ChainJob();
+        ChainJob(const ChainJob &);
+        ChainJob &operator=(const ChainJob &);
+
+    protected:
+        const MCMCT &driver_;
+        const Target &target_;
+        const double *start_;
+        size_t chain_;
+        uint64_t draws_;
+        uint64_t burnin_;
+        uint64_t thin_;
+        Result &result_;
+        CountDownLatch &latch_;
+    };
+
+protected:
+    // internal data
+    RNG master_;
+    size_t chains_;
+    bool keep_;
+    std::vector<Result> results_;
+    ChainStatistics statistics_;
+};
+
+// default instantiation, engine chosen at run-time
+typedef MCMCT<Random> MCMC;
+
+}
+
+#include "montecarlo/MCMC.i"
+
+#endif
@@ -0,0 +1,170 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// parallel markov chain monte carlo driver
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+MCMCT<RNG>::MCMCT():
+    BaseObject(false), master_(), chains_(DefaultChains), keep_(false),
+    results_(), statistics_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+MCMCT<RNG>::MCMCT(const RNG &master, size_t chains, bool keep):
+    BaseObject(true), master_(master), chains_(chains), keep_(keep),
+    results_(), statistics_()
+{
+    if (chains_ < 1) setOk(false);
+}
+
+template <class RNG>
+MCMCT<RNG>::MCMCT(const MCMCT &src):
+    BaseObject(src), master_(src.master_), chains_(src.chains_),
+    keep_(src.keep_), results_(src.results_),
+    statistics_(src.statistics_)
+{
+}
+
+template <class RNG>
+MCMCT<RNG>::~MCMCT()
+{
+}
+
+// assignment
+template <class RNG>
+MCMCT<RNG> &
+MCMCT<RNG>::operator=(const MCMCT &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        master_ = rhs.master_;
+        chains_ = rhs.chains_;
+        keep_ = rhs.keep_;
+        results_ = rhs.results_;
+        statistics_ = rhs.statistics_;
+    }
+    return(*this);
+}
+
+// acceptance rate of chain i after burn-in
+template <class RNG>
+double
+MCMCT<RNG>::acceptance(size_t i) const
+{
+    const Result &result = results_[i];
+    return((result.proposals > 0) ?
+           double(result.accepted)/result.proposals : NAN);
+}
+
+// run one chain. everything the chain needs is allocated before the
+// first iteration.
+template <class RNG>
+template <class Sampler, class Target>
+void
+MCMCT<RNG>::runChain(const Target &target, const double *start,
+                     size_t i, uint64_t draws, uint64_t burnin,
+                     uint64_t thin, Result &result) const
+{
+    size_t dimension = target.dimension();
+    Sampler sampler(target, master_.substream(i));
+    MustBeTrue(sampler.isOk());
+
+    result.statistics = ChainStatistics(dimension);
+    result.draws.clear();
+    double *out = NULL;
+    if (keep_ && draws > 0)
+    {
+        result.draws.resize(draws*dimension);
+        out = &result.draws[0];
+    }
+
+    sampler.start(start);
+    for (uint64_t n=0; n<burnin; ++n)
+    {
+        sampler.adapt();
+    }
+    sampler.resetCounts();
+
+    for (uint64_t n=0; n<draws; ++n)
+    {
+        for (uint64_t t=0; t<thin; ++t)
+        {
+            sampler.step();
+        }
+        const double *x = sampler.state();
+        result.statistics.add(x);
+        if (out != NULL)
+        {
+            for (size_t k=0; k<dimension; ++k) out[k] = x[k];
+            out += dimension;
+        }
+    }
+
+    result.proposals = sampler.proposals();
+    result.accepted = sampler.accepted();
+    result.evaluations = sampler.evaluations();
+}
+
+// merge the chains' diagnostics in chain order
+template <class RNG>
+void
+MCMCT<RNG>::merge(size_t dimension)
+{
+    statistics_ = ChainStatistics(dimension);
+    for (size_t i=0; i<chains_; ++i)
+    {
+        statistics_.merge(results_[i].statistics);
+    }
+}
+
+// run on the pool, one job per chain
+template <class RNG>
+template <class Sampler, class Target>
+void
+MCMCT<RNG>::run(ThreadPool &pool, const Target &target,
+                const double *starts, uint64_t draws, uint64_t burnin,
+                uint64_t thin)
+{
+    MustBeTrue(isOk() && thin > 0);
+
+    size_t dimension = target.dimension();
+    results_.assign(chains_, Result());
+    CountDownLatch latch(chains_);
+    for (size_t i=0; i<chains_; ++i)
+    {
+        pool.addJob(new ChainJob<Sampler, Target>(
+            *this, target, starts+i*dimension, i, draws, burnin, thin,
+            results_[i], latch));
+    }
+    latch.wait();
+    merge(dimension);
+}
+
+// run in the calling thread, same results as on a pool
+template <class RNG>
+template <class Sampler, class Target>
+void
+MCMCT<RNG>::run(const Target &target, const double *starts,
+                uint64_t draws, uint64_t burnin, uint64_t thin)
+{
+    MustBeTrue(isOk() && thin > 0);
+
+    size_t dimension = target.dimension();
+    results_.assign(chains_, Result());
+    for (size_t i=0; i<chains_; ++i)
+    {
+        runChain<Sampler, Target>(target, starts+i*dimension, i, draws,
+                                  burnin, thin, results_[i]);
+    }
+    merge(dimension);
+}
+
+}
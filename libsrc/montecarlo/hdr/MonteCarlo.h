@@ -0,0 +1,134 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_MONTE_CARLO_H
+#define __OMBT_MONTE_CARLO_H
+
+// parallel monte carlo driver.
+//
+// the n samples are cut into chunks of a fixed size. chunk i draws
+// its values from substream i of the master engine into a reducer
+// of its own, and the chunk reducers are merged in chunk order.
+// the result depends only on the master engine and the chunk size,
+// not on the number of threads, or whether a pool is used at all.
+//
+// a factory is anything callable as factory(const RNG &stream)
+// returning a sampler with fill(double *, size_t). any of the
+// distributions will do:
+//
+//     struct Normal {
+//         GaussianT<Xoshiro256> operator()(const Xoshiro256 &s) const {
+//             return(GaussianT<Xoshiro256>(0.0, 1.0, s));
+//         }
+//     };
+//
+// a reducer needs a copy ctor, clear(), add(const double *, size_t)
+// and merge(const Reducer &), see Reducers.h. the reducer given to
+// run() is the prototype for the chunk reducers, and the chunk
+// results are merged into it.
+//
+// chunk i uses master.substream(i), so independent runs need
+// masters with different keys, not substreams of one master.
+
+// system headers
+#include <stdint.h>
+#include <vector>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+#include "random/Random.h"
+#include "threads/Job.h"
+#include "threads/ThreadPool.h"
+#include "threads/CountDownLatch.h"
+
+namespace ombt {
+
+// monte carlo driver
+template <class RNG>
+class MonteCarloT: public BaseObject
+{
+public:
+    // sizes
+    enum {
+        DefaultChunkSize = 1<<20,
+        BufferSize = 1024
+    };
+
+    // ctors and dtor
+    MonteCarloT();
+    MonteCarloT(const RNG &master, uint64_t chunksize = DefaultChunkSize);
+    MonteCarloT(const MonteCarloT &src);
+    ~MonteCarloT();
+
+    // assignment
+    MonteCarloT &operator=(const MonteCarloT &rhs);
+
+    // draw n samples on the pool's threads, or in this thread
+    template <class Factory, class Reducer>
+    void run(ThreadPool &pool, const Factory &factory,
+             uint64_t n, Reducer &reducer) const;
+    template <class Factory, class Reducer>
+    void run(const Factory &factory, uint64_t n, Reducer &reducer) const;
+
+    // chunks needed for n samples
+    uint64_t chunks(uint64_t n) const;
+    uint64_t chunkSize() const { return(chunksize_); }
+
+protected:
+    // draw chunk i of n samples into an empty reducer
+    template <class Factory, class Reducer>
+    void runChunk(const Factory &factory, uint64_t n, uint64_t i,
+                  Reducer &reducer) const;
+
+    // one chunk as a pool job. the pool owns and deletes the job,
+    // the driver owns everything the job points to.
+    template <class Factory, class Reducer>
+    class ChunkJob: public Job {
+    public:
+        ChunkJob(const MonteCarloT &driver, const Factory &factory,
+                 uint64_t n, uint64_t chunk, Reducer &reducer,
+                 CountDownLatch &latch):
+            Job(), driver_(driver), factory_(factory), n_(n),
+            chunk_(chunk), reducer_(reducer), latch_(latch) {
+        }
+        virtual ~ChunkJob() {
+        }
+
+        virtual JobReturn run() {
+            driver_.runChunk(factory_, n_, chunk_, reducer_);
+            latch_.countDown();
+            return Finished;
+        }
+
+    private:
+        ChunkJob();
+        ChunkJob(const ChunkJob &);
+        ChunkJob &operator=(const ChunkJob &);
+
+    protected:
+        const MonteCarloT &driver_;
+        const Factory &factory_;
+        uint64_t n_;
+        uint64_t chunk_;
+        Reducer &reducer_;
+        CountDownLatch &latch_;
+    };
+
+protected:
+    // internal data
+    RNG master_;
+    uint64_t chunksize_;
+};
+
+// default instantiation, engine chosen at run-time
+typedef MonteCarloT<Random> MonteCarlo;
+
+}
+
+#include "montecarlo/MonteCarlo.i"
+
+#endif
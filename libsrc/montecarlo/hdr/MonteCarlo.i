@@ -0,0 +1,127 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// parallel monte carlo driver
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+MonteCarloT<RNG>::MonteCarloT():
+    BaseObject(false), master_(), chunksize_(DefaultChunkSize)
+{
+    setOk(false);
+}
+
+template <class RNG>
+MonteCarloT<RNG>::MonteCarloT(const RNG &master, uint64_t chunksize):
+    BaseObject(true), master_(master), chunksize_(chunksize)
+{
+    if (chunksize_ == 0) setOk(false);
+}
+
+template <class RNG>
+MonteCarloT<RNG>::MonteCarloT(const MonteCarloT &src):
+    BaseObject(src), master_(src.master_), chunksize_(src.chunksize_)
+{
+}
+
+template <class RNG>
+MonteCarloT<RNG>::~MonteCarloT()
+{
+}
+
+// assignment
+template <class RNG>
+MonteCarloT<RNG> &
+MonteCarloT<RNG>::operator=(const MonteCarloT &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        master_ = rhs.master_;
+        chunksize_ = rhs.chunksize_;
+    }
+    return(*this);
+}
+
+// chunks needed for n samples
+template <class RNG>
+uint64_t
+MonteCarloT<RNG>::chunks(uint64_t n) const
+{
+    return((n + chunksize_ - 1)/chunksize_);
+}
+
+// draw one chunk
+template <class RNG>
+template <class Factory, class Reducer>
+void
+MonteCarloT<RNG>::runChunk(const Factory &factory, uint64_t n,
+                           uint64_t i, Reducer &reducer) const
+{
+    uint64_t first = i*chunksize_;
+    uint64_t count = (n-first < chunksize_) ? n-first : chunksize_;
+
+    double buffer[BufferSize];
+    auto sampler = factory(master_.substream(i));
+    while (count > 0)
+    {
+        size_t m = (count < BufferSize) ? size_t(count) : size_t(BufferSize);
+        sampler.fill(buffer, m);
+        reducer.add(buffer, m);
+        count -= m;
+    }
+}
+
+// run on the pool. each chunk is a job with its own reducer, the
+// calling thread waits for all of them, then merges in order.
+template <class RNG>
+template <class Factory, class Reducer>
+void
+MonteCarloT<RNG>::run(ThreadPool &pool, const Factory &factory,
+                      uint64_t n, Reducer &reducer) const
+{
+    MustBeTrue(isOk());
+
+    uint64_t nchunks = chunks(n);
+    Reducer empty(reducer);
+    empty.clear();
+    std::vector<Reducer> results(nchunks, empty);
+
+    CountDownLatch latch(nchunks);
+    for (uint64_t i=0; i<nchunks; ++i)
+    {
+        pool.addJob(new ChunkJob<Factory, Reducer>(
+            *this, factory, n, i, results[i], latch));
+    }
+    latch.wait();
+
+    for (uint64_t i=0; i<nchunks; ++i)
+    {
+        reducer.merge(results[i]);
+    }
+}
+
+// run in the calling thread, same result as on a pool
+template <class RNG>
+template <class Factory, class Reducer>
+void
+MonteCarloT<RNG>::run(const Factory &factory, uint64_t n,
+                      Reducer &reducer) const
+{
+    MustBeTrue(isOk());
+
+    uint64_t nchunks = chunks(n);
+    Reducer result(reducer);
+    for (uint64_t i=0; i<nchunks; ++i)
+    {
+        result.clear();
+        runChunk(factory, n, i, result);
+        reducer.merge(result);
+    }
+}
+
+}
@@ -0,0 +1,103 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_REDUCERS_H
+#define __OMBT_REDUCERS_H
+
+// reducers for the monte carlo driver. each takes values in
+// blocks, can be emptied with clear(), and merges with another
+// of the same kind. merging is not exactly associative in
+// floating point, so the driver always merges in the same order.
+
+// system headers
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+#include "statistics/Moments.h"
+
+namespace ombt {
+
+// compensated (neumaier) sum of the values
+class SumReducer: public BaseObject
+{
+public:
+    // ctors and dtor
+    SumReducer();
+    SumReducer(const SumReducer &src);
+    ~SumReducer();
+
+    // assignment
+    SumReducer &operator=(const SumReducer &rhs);
+
+    // reducer interface
+    void clear();
+    void add(const double *x, size_t n);
+    void merge(const SumReducer &other);
+
+    // results
+    uint64_t count() const { return(count_); }
+    double sum() const { return(sum_+compensation_); }
+    double mean() const;
+
+protected:
+    // internal data
+    uint64_t count_;
+    double sum_;
+    double compensation_;
+};
+
+// count, mean, variance, skewness, kurtosis, minimum and maximum,
+// see statistics/Moments.h
+typedef Moments MomentsReducer;
+
+// fixed-width histogram over [lo,hi). values below lo (and nans)
+// are counted as underflow, values at or above hi as overflow.
+class HistogramReducer: public BaseObject
+{
+public:
+    // ctors and dtor
+    HistogramReducer();
+    HistogramReducer(double lo, double hi, size_t nbins);
+    HistogramReducer(const HistogramReducer &src);
+    ~HistogramReducer();
+
+    // assignment
+    HistogramReducer &operator=(const HistogramReducer &rhs);
+
+    // reducer interface
+    void clear();
+    void add(const double *x, size_t n);
+    void merge(const HistogramReducer &other);
+
+    // results
+    size_t bins() const { return(counts_.size()); }
+    uint64_t count(size_t bin) const { return(counts_[bin]); }
+    uint64_t underflow() const { return(underflow_); }
+    uint64_t overflow() const { return(overflow_); }
+    uint64_t total() const;
+    double lower(size_t bin) const { return(lo_+bin*width_); }
+    double upper(size_t bin) const { return(lo_+(bin+1)*width_); }
+    double width() const { return(width_); }
+
+protected:
+    // internal data
+    double lo_;
+    double hi_;
+    double width_;
+    double iwidth_;
+    std::vector<uint64_t> counts_;
+    uint64_t underflow_;
+    uint64_t overflow_;
+};
+
+}
+
+#endif
@@ -0,0 +1,251 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_RESAMPLING_H
+#define __OMBT_RESAMPLING_H
+
+// parallel bootstrap and permutation tests.
+//
+// a statistic is given as a reducer (see Reducers.h) that takes
+// the values of a sample, and a function computing the statistic
+// from the reducer:
+//
+//     ResamplingT<Xoshiro256> resampling(Xoshiro256(key));
+//     resampling.bootstrap(pool, data, n, MomentsReducer(),
+//         [](const Moments &m) { return(m.mean()); }, 10000);
+//     resampling.interval(0.95, Resampling::BCa, lower, upper);
+//
+// any reducer works, TDigest for quantiles included. resamples are
+// never copied: resample b draws its indices from substream b of the
+// master engine, a block at a time, and passes the values through a
+// small buffer to a fresh reducer. the result depends only on the
+// master engine, not on the number of threads.
+//
+// intervals are percentile or bca (efron, 1987). the bca
+// acceleration comes from a grouped jackknife, leaving out each of
+// JackknifeGroups blocks of the data in turn. the reducers of the
+// blocks are merged, not recomputed, so it costs one pass over the
+// data.
+//
+// the permutation test of two samples x and y draws random splits
+// of the pooled values into groups of the original sizes, by
+// selection sampling in one pass, and compares the statistic of the
+// two group reducers with its value on the original split. the
+// p-value is (1 + #{as extreme})/(1 + permutations).
+
+// system headers
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+#include <algorithm>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+#include "random/Random.h"
+#include "threads/Job.h"
+#include "threads/ThreadPool.h"
+#include "threads/CountDownLatch.h"
+#include "specialfunctions/SpecialFunctions.h"
+
+namespace ombt {
+
+// resampling engine
+template <class RNG>
+class ResamplingT: public BaseObject
+{
+public:
+    // sizes
+    enum {
+        BufferSize = 1024,
+        JackknifeGroups = 100,
+        ResamplesPerJob = 8
+    };
+
+    // kinds of intervals and tests
+    enum Interval { Percentile, BCa };
+    enum Alternative { TwoSided, Greater, Less };
+
+    // ctors and dtor
+    ResamplingT();
+    ResamplingT(const RNG &master);
+    ResamplingT(const ResamplingT &src);
+    ~ResamplingT();
+
+    // assignment
+    ResamplingT &operator=(const ResamplingT &rhs);
+
+    // bootstrap distribution of statistic(reducer of a sample) over
+    // the given number of resamples of the n values of data, on the
+    // pool's threads, or in this thread
+    template <class Reducer, class Statistic>
+    void bootstrap(ThreadPool &pool, const double *data, size_t n,
+                   const Reducer &prototype, const Statistic &statistic,
+                   size_t resamples);
+    template <class Reducer, class Statistic>
+    void bootstrap(const double *data, size_t n, const Reducer &prototype,
+                   const Statistic &statistic, size_t resamples);
+
+    // permutation test of statistic(reducer of x, reducer of y),
+    // returns the p-value
+    template <class Reducer, class Statistic>
+    double permutationTest(ThreadPool &pool, const double *x, size_t nx,
+                           const double *y, size_t ny,
+                           const Reducer &prototype,
+                           const Statistic &statistic,
+                           size_t permutations,
+                           Alternative alternative = TwoSided);
+    template <class Reducer, class Statistic>
+    double permutationTest(const double *x, size_t nx,
+                           const double *y, size_t ny,
+                           const Reducer &prototype,
+                           const Statistic &statistic,
+                           size_t permutations,
+                           Alternative alternative = TwoSided);
+
+    // results of the last run. estimate() is the statistic on the
+    // data as given, replicates() its values on the resamples, in
+    // resample order.
+    double estimate() const { return(estimate_); }
+    const std::vector<double> &replicates() const { return(replicates_); }
+    double bias() const;
+    double standardError() const;
+    double acceleration() const { return(acceleration_); }
+    double pValue() const { return(pvalue_); }
+
+    // two-sided interval at the given confidence, from the last
+    // bootstrap. false if there is none.
+    bool interval(double confidence, Interval method,
+                  double &lower, double &upper) const;
+
+protected:
+    // draw a range of resamples, or of permutations
+    template <class Reducer, class Statistic>
+    void bootstrapRange(const double *data, size_t n,
+                        const Reducer &prototype,
+                        const Statistic &statistic,
+                        size_t first, size_t last);
+    template <class Reducer, class Statistic>
+    void permutationRange(const double *x, size_t nx,
+                          const double *y, size_t ny,
+                          const Reducer &prototype,
+                          const Statistic &statistic,
+                          size_t first, size_t last);
+
+    // estimate and jackknife acceleration
+    template <class Reducer, class Statistic>
+    void jackknife(const double *data, size_t n, const Reducer &prototype,
+                   const Statistic &statistic);
+
+    // p-value from the replicates
+    double computePValue(Alternative alternative) const;
+
+    // value at fraction q of the sorted replicates
+    double replicateQuantile(const std::vector<double> &sorted,
+                             double q) const;
+
+    // a range of resamples as a pool job. the pool owns and deletes
+    // the job, the engine owns everything the job points to.
+    template <class Reducer, class Statistic>
+    class BootstrapJob: public Job {
+    public:
+        BootstrapJob(ResamplingT &engine, const double *data, size_t n,
+                     const Reducer &prototype, const Statistic &statistic,
+                     size_t first, size_t last, CountDownLatch &latch):
+            Job(), engine_(engine), data_(data), n_(n),
+            prototype_(prototype), statistic_(statistic),
+            first_(first), last_(last), latch_(latch) {
+        }
+        virtual ~BootstrapJob() {
+        }
+
+        virtual JobReturn run() {
+            engine_.bootstrapRange(data_, n_, prototype_, statistic_,
+                                   first_, last_);
+            latch_.countDown();
+            return Finished;
+        }
+
+    private:
+        BootstrapJob();
+        BootstrapJob(const BootstrapJob &);
+        BootstrapJob &operator=(const BootstrapJob &);
+
+    protected:
+        ResamplingT &engine_;
+        const double *data_;
+        size_t n_;
+        const Reducer &prototype_;
+        const Statistic &statistic_;
+        size_t first_;
+        size_t last_;
+        CountDownLatch &latch_;
+    };
+
+    // a range of permutations as a pool job
+    template <class Reducer, class Statistic>
+    class PermutationJob: public Job {
+    public:
+        PermutationJob(ResamplingT &engine, const double *x, size_t nx,
+                       const double *y, size_t ny,
+                       const Reducer &prototype, const Statistic &statistic,
+                       size_t first, size_t last, CountDownLatch &latch):
+            Job(), engine_(engine), x_(x), nx_(nx), y_(y), ny_(ny),
+            prototype_(prototype), statistic_(statistic),
+            first_(first), last_(last), latch_(latch) {
+        }
+        virtual ~PermutationJob() {
+        }
+
+        virtual JobReturn run() {
+            engine_.permutationRange(x_, nx_, y_, ny_, prototype_,
+                                     statistic_, first_, last_);
+            latch_.countDown();
+            return Finished;
+        }
+
+    private:
+        PermutationJob();
+        PermutationJob(const PermutationJob &);
+        PermutationJob &operator=(const PermutationJob &);
+
+    protected:
+        ResamplingT &engine_;
+        const double *x_;
+        size_t nx_;
+        const double *y_;
+        size_t ny_;
+        const Reducer &prototype_;
+        const Statistic &statistic_;
+        size_t first_;
+        size_t last_;
+        CountDownLatch &latch_;
+    };
+
+    // jobs needed for a number of resamples
+    size_t jobs(size_t resamples) const {
+        return((resamples + ResamplesPerJob - 1)/ResamplesPerJob);
+    }
+
+protected:
+    // internal data
+    RNG master_;
+    double estimate_;
+    double acceleration_;
+    double pvalue_;
+    bool bootstrapped_;
+    std::vector<double> replicates_;
+};
+
+// default instantiation, engine chosen at run-time
+typedef ResamplingT<Random> Resampling;
+
+}
+
+#include "montecarlo/Resampling.i"
+
+#endif
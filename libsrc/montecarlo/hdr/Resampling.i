@@ -0,0 +1,469 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// parallel bootstrap and permutation tests
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+ResamplingT<RNG>::ResamplingT():
+    BaseObject(false), master_(), estimate_(0.0), acceleration_(0.0),
+    pvalue_(1.0), bootstrapped_(false), replicates_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+ResamplingT<RNG>::ResamplingT(const RNG &master):
+    BaseObject(true), master_(master), estimate_(0.0), acceleration_(0.0),
+    pvalue_(1.0), bootstrapped_(false), replicates_()
+{
+}
+
+template <class RNG>
+ResamplingT<RNG>::ResamplingT(const ResamplingT &src):
+    BaseObject(src), master_(src.master_), estimate_(src.estimate_),
+    acceleration_(src.acceleration_), pvalue_(src.pvalue_),
+    bootstrapped_(src.bootstrapped_), replicates_(src.replicates_)
+{
+}
+
+template <class RNG>
+ResamplingT<RNG>::~ResamplingT()
+{
+}
+
+// assignment
+template <class RNG>
+ResamplingT<RNG> &
+ResamplingT<RNG>::operator=(const ResamplingT &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        master_ = rhs.master_;
+        estimate_ = rhs.estimate_;
+        acceleration_ = rhs.acceleration_;
+        pvalue_ = rhs.pvalue_;
+        bootstrapped_ = rhs.bootstrapped_;
+        replicates_ = rhs.replicates_;
+    }
+    return(*this);
+}
+
+// draw resamples first to last-1. the uniforms of a block are turned
+// into indices and replaced by the values they pick, in place.
+template <class RNG>
+template <class Reducer, class Statistic>
+void
+ResamplingT<RNG>::bootstrapRange(const double *data, size_t n,
+                                 const Reducer &prototype,
+                                 const Statistic &statistic,
+                                 size_t first, size_t last)
+{
+    double buffer[BufferSize];
+    Reducer reducer(prototype);
+    for (size_t b=first; b<last; ++b)
+    {
+        reducer.clear();
+        RNG stream(master_.substream(b));
+        for (size_t left=n; left>0; )
+        {
+            size_t m = (left < BufferSize) ? left : size_t(BufferSize);
+            stream.fill(buffer, m);
+            for (size_t i=0; i<m; ++i)
+            {
+                size_t index = size_t(buffer[i]*n);
+                if (index >= n) index = n-1;
+                buffer[i] = data[index];
+            }
+            reducer.add(buffer, m);
+            left -= m;
+        }
+        replicates_[b] = statistic(reducer);
+    }
+}
+
+// draw permutations first to last-1. x and y are read as one pooled
+// sample, and each value goes to the x group with probability
+// (x places left)/(values left), which picks nx of the nx+ny values
+// uniformly (knuth's algorithm s).
+template <class RNG>
+template <class Reducer, class Statistic>
+void
+ResamplingT<RNG>::permutationRange(const double *x, size_t nx,
+                                   const double *y, size_t ny,
+                                   const Reducer &prototype,
+                                   const Statistic &statistic,
+                                   size_t first, size_t last)
+{
+    double u[BufferSize];
+    double bx[BufferSize];
+    double by[BufferSize];
+    Reducer rx(prototype);
+    Reducer ry(prototype);
+
+    const double *segments[2] = { x, y };
+    size_t sizes[2] = { nx, ny };
+
+    for (size_t b=first; b<last; ++b)
+    {
+        rx.clear();
+        ry.clear();
+        RNG stream(master_.substream(b));
+
+        size_t need = nx;
+        size_t remaining = nx+ny;
+        size_t mx = 0;
+        size_t my = 0;
+        for (int s=0; s<2; ++s)
+        {
+            const double *values = segments[s];
+            for (size_t left=sizes[s]; left>0; )
+            {
+                size_t m = (left < BufferSize) ? left : size_t(BufferSize);
+                stream.fill(u, m);
+                for (size_t i=0; i<m; ++i, --remaining)
+                {
+                    if (u[i]*remaining < need)
+                    {
+                        bx[mx++] = values[i];
+                        --need;
+                        if (mx == BufferSize)
+                        {
+                            rx.add(bx, mx);
+                            mx = 0;
+                        }
+                    }
+                    else
+                    {
+                        by[my++] = values[i];
+                        if (my == BufferSize)
+                        {
+                            ry.add(by, my);
+                            my = 0;
+                        }
+                    }
+                }
+                values += m;
+                left -= m;
+            }
+        }
+        if (mx > 0) rx.add(bx, mx);
+        if (my > 0) ry.add(by, my);
+
+        replicates_[b] = statistic(rx, ry);
+    }
+}
+
+// statistic on the data, and the bca acceleration from the
+// leave-one-group-out values. the group reducers are merged into
+// prefixes, and each leave-out value is a prefix merged with the
+// groups after the one left out.
+template <class RNG>
+template <class Reducer, class Statistic>
+void
+ResamplingT<RNG>::jackknife(const double *data, size_t n,
+                            const Reducer &prototype,
+                            const Statistic &statistic)
+{
+    Reducer empty(prototype);
+    empty.clear();
+
+    size_t ngroups = (n < JackknifeGroups) ? n : size_t(JackknifeGroups);
+    std::vector<Reducer> groups(ngroups, empty);
+    for (size_t g=0; g<ngroups; ++g)
+    {
+        size_t begin = g*n/ngroups;
+        size_t end = (g+1)*n/ngroups;
+        groups[g].add(data+begin, end-begin);
+    }
+
+    std::vector<Reducer> prefixes(ngroups+1, empty);
+    for (size_t g=0; g<ngroups; ++g)
+    {
+        prefixes[g+1] = prefixes[g];
+        prefixes[g+1].merge(groups[g]);
+    }
+    estimate_ = statistic(prefixes[ngroups]);
+
+    acceleration_ = 0.0;
+    if (ngroups < 3) return;
+
+    std::vector<double> thetas(ngroups);
+    Reducer suffix(empty);
+    for (size_t g=ngroups; g-->0; )
+    {
+        Reducer leaveout(prefixes[g]);
+        leaveout.merge(suffix);
+        thetas[g] = statistic(leaveout);
+        suffix.merge(groups[g]);
+    }
+
+    double mean = 0.0;
+    for (size_t g=0; g<ngroups; ++g) mean += thetas[g];
+    mean /= ngroups;
+
+    double sum2 = 0.0;
+    double sum3 = 0.0;
+    for (size_t g=0; g<ngroups; ++g)
+    {
+        double d = mean - thetas[g];
+        sum2 += d*d;
+        sum3 += d*d*d;
+    }
+    if (sum2 > 0.0) acceleration_ = sum3/(6.0*sum2*sqrt(sum2));
+}
+
+// bootstrap on the pool. each job covers ResamplesPerJob resamples
+// and writes their replicates, the calling thread waits for all.
+template <class RNG>
+template <class Reducer, class Statistic>
+void
+ResamplingT<RNG>::bootstrap(ThreadPool &pool, const double *data,
+                            size_t n, const Reducer &prototype,
+                            const Statistic &statistic, size_t resamples)
+{
+    MustBeTrue(isOk());
+    MustBeTrue(data != NULL && n > 0 && resamples > 0);
+
+    bootstrapped_ = false;
+    replicates_.assign(resamples, 0.0);
+    jackknife(data, n, prototype, statistic);
+
+    size_t njobs = jobs(resamples);
+    CountDownLatch latch(njobs);
+    for (size_t j=0; j<njobs; ++j)
+    {
+        size_t first = j*ResamplesPerJob;
+        size_t last = (first+ResamplesPerJob < resamples) ?
+                      first+ResamplesPerJob : resamples;
+        pool.addJob(new BootstrapJob<Reducer, Statistic>(
+            *this, data, n, prototype, statistic, first, last, latch));
+    }
+    latch.wait();
+    bootstrapped_ = true;
+}
+
+// bootstrap in the calling thread, same result as on a pool
+template <class RNG>
+template <class Reducer, class Statistic>
+void
+ResamplingT<RNG>::bootstrap(const double *data, size_t n,
+                            const Reducer &prototype,
+                            const Statistic &statistic, size_t resamples)
+{
+    MustBeTrue(isOk());
+    MustBeTrue(data != NULL && n > 0 && resamples > 0);
+
+    bootstrapped_ = false;
+    replicates_.assign(resamples, 0.0);
+    jackknife(data, n, prototype, statistic);
+    bootstrapRange(data, n, prototype, statistic, 0, resamples);
+    bootstrapped_ = true;
+}
+
+// permutation test on the pool
+template <class RNG>
+template <class Reducer, class Statistic>
+double
+ResamplingT<RNG>::permutationTest(ThreadPool &pool,
+                                  const double *x, size_t nx,
+                                  const double *y, size_t ny,
+                                  const Reducer &prototype,
+                                  const Statistic &statistic,
+                                  size_t permutations,
+                                  Alternative alternative)
+{
+    MustBeTrue(isOk());
+    MustBeTrue(x != NULL && nx > 0 && y != NULL && ny > 0);
+    MustBeTrue(permutations > 0);
+
+    bootstrapped_ = false;
+    acceleration_ = 0.0;
+    replicates_.assign(permutations, 0.0);
+
+    Reducer rx(prototype);
+    Reducer ry(prototype);
+    rx.clear();
+    ry.clear();
+    rx.add(x, nx);
+    ry.add(y, ny);
+    estimate_ = statistic(rx, ry);
+
+    size_t njobs = jobs(permutations);
+    CountDownLatch latch(njobs);
+    for (size_t j=0; j<njobs; ++j)
+    {
+        size_t first = j*ResamplesPerJob;
+        size_t last = (first+ResamplesPerJob < permutations) ?
+                      first+ResamplesPerJob : permutations;
+        pool.addJob(new PermutationJob<Reducer, Statistic>(
+            *this, x, nx, y, ny, prototype, statistic, first, last, latch));
+    }
+    latch.wait();
+
+    pvalue_ = computePValue(alternative);
+    return(pvalue_);
+}
+
+// permutation test in the calling thread, same result as on a pool
+template <class RNG>
+template <class Reducer, class Statistic>
+double
+ResamplingT<RNG>::permutationTest(const double *x, size_t nx,
+                                  const double *y, size_t ny,
+                                  const Reducer &prototype,
+                                  const Statistic &statistic,
+                                  size_t permutations,
+                                  Alternative alternative)
+{
+    MustBeTrue(isOk());
+    MustBeTrue(x != NULL && nx > 0 && y != NULL && ny > 0);
+    MustBeTrue(permutations > 0);
+
+    bootstrapped_ = false;
+    acceleration_ = 0.0;
+    replicates_.assign(permutations, 0.0);
+
+    Reducer rx(prototype);
+    Reducer ry(prototype);
+    rx.clear();
+    ry.clear();
+    rx.add(x, nx);
+    ry.add(y, ny);
+    estimate_ = statistic(rx, ry);
+
+    permutationRange(x, nx, y, ny, prototype, statistic, 0, permutations);
+
+    pvalue_ = computePValue(alternative);
+    return(pvalue_);
+}
+
+// p-value of the observed statistic against the permutations. the
+// two-sided value is twice the smaller one-sided one.
+template <class RNG>
+double
+ResamplingT<RNG>::computePValue(Alternative alternative) const
+{
+    size_t greater = 0;
+    size_t less = 0;
+    for (size_t b=0; b<replicates_.size(); ++b)
+    {
+        if (replicates_[b] >= estimate_) ++greater;
+        if (replicates_[b] <= estimate_) ++less;
+    }
+
+    double permutations = replicates_.size();
+    double pgreater = (1.0 + greater)/(1.0 + permutations);
+    double pless = (1.0 + less)/(1.0 + permutations);
+    switch (alternative)
+    {
+    case Greater:
+        return(pgreater);
+    case Less:
+        return(pless);
+    default:
+    {
+        double p = 2.0*((pgreater < pless) ? pgreater : pless);
+        return((p < 1.0) ? p : 1.0);
+    }
+    }
+}
+
+// bias and standard error of the statistic from the replicates
+template <class RNG>
+double
+ResamplingT<RNG>::bias() const
+{
+    if (replicates_.empty()) return(0.0);
+    double sum = 0.0;
+    for (size_t b=0; b<replicates_.size(); ++b) sum += replicates_[b];
+    return(sum/replicates_.size() - estimate_);
+}
+
+template <class RNG>
+double
+ResamplingT<RNG>::standardError() const
+{
+    size_t count = replicates_.size();
+    if (count < 2) return(0.0);
+
+    double mean = 0.0;
+    for (size_t b=0; b<count; ++b) mean += replicates_[b];
+    mean /= count;
+
+    double sum2 = 0.0;
+    for (size_t b=0; b<count; ++b)
+    {
+        double d = replicates_[b] - mean;
+        sum2 += d*d;
+    }
+    return(sqrt(sum2/(count-1)));
+}
+
+// linear interpolation between order statistics
+template <class RNG>
+double
+ResamplingT<RNG>::replicateQuantile(const std::vector<double> &sorted,
+                                    double q) const
+{
+    double position = q*(sorted.size()-1);
+    if (position <= 0.0) return(sorted.front());
+    size_t i = size_t(position);
+    if (i+1 >= sorted.size()) return(sorted.back());
+    double fraction = position - i;
+    return(sorted[i] + fraction*(sorted[i+1]-sorted[i]));
+}
+
+// percentile or bca interval. bca moves the percentiles by the
+// bias correction z0, from the fraction of replicates below the
+// estimate, and by the acceleration a:
+//
+//     alpha' = Phi(z0 + (z0 + z(alpha))/(1 - a*(z0 + z(alpha))))
+//
+template <class RNG>
+bool
+ResamplingT<RNG>::interval(double confidence, Interval method,
+                           double &lower, double &upper) const
+{
+    if (!bootstrapped_ || replicates_.empty()) return(false);
+    if (!(confidence > 0.0 && confidence < 1.0)) return(false);
+
+    std::vector<double> sorted(replicates_);
+    std::sort(sorted.begin(), sorted.end());
+
+    double alpha = 0.5*(1.0-confidence);
+    double qlower = alpha;
+    double qupper = 1.0-alpha;
+    if (method == BCa)
+    {
+        size_t below = 0;
+        size_t ties = 0;
+        for (size_t b=0; b<sorted.size(); ++b)
+        {
+            if (sorted[b] < estimate_) ++below;
+            else if (sorted[b] == estimate_) ++ties;
+        }
+        double fraction = (below + 0.5*ties)/sorted.size();
+        if (!(fraction > 0.0 && fraction < 1.0)) return(false);
+        double z0 = normalQuantile(fraction);
+
+        double zlower = z0 + normalQuantile(qlower);
+        double zupper = z0 + normalQuantile(qupper);
+        double dlower = 1.0 - acceleration_*zlower;
+        double dupper = 1.0 - acceleration_*zupper;
+        if (!(dlower > 0.0 && dupper > 0.0)) return(false);
+        qlower = normalCdf(z0 + zlower/dlower);
+        qupper = normalCdf(z0 + zupper/dupper);
+    }
+
+    lower = replicateQuantile(sorted, qlower);
+    upper = replicateQuantile(sorted, qupper);
+    return(true);
+}
+
+}
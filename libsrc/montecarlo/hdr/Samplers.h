@@ -0,0 +1,207 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_SAMPLERS_H
+#define __OMBT_SAMPLERS_H
+
+// markov chain monte carlo samplers for the MCMC driver.
+//
+// a target is anything with
+//
+//     size_t dimension() const;
+//     double logDensity(const double *x) const;
+//
+// returning the log of an unnormalized density, -HUGE_VAL (or nan)
+// outside its support. the target is shared by all the chains, so
+// logDensity() must be safe to call from several threads at once.
+//
+// a sampler is built from a target and a stream, and has
+//
+//     void start(const double *x);    // initial state
+//     void step();                    // one iteration
+//     void adapt();                   // one iteration during burn-in
+//     void resetCounts();             // after burn-in
+//     const double *state() const;
+//     double logDensity() const;
+//     uint64_t proposals() const;
+//     uint64_t accepted() const;
+//     uint64_t evaluations() const;   // calls of logDensity()
+//
+// all the scratch space is allocated when the sampler is built, so
+// steps do not allocate.
+
+// system headers
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+#include "random/Random.h"
+#include "distributions/Gaussian.h"
+
+namespace ombt {
+
+// random walk metropolis-hastings, all coordinates at once, with
+// independent gaussian steps of scale lambda*s[i]. during burn-in,
+// every TuneInterval steps the s[i] are set to the standard
+// deviations of the burn-in states so far, and lambda is moved
+// toward the acceptance rate that is optimal for gaussian targets,
+// 0.44 in one dimension and 0.234 in more (roberts, gelman and
+// gilks, 1997). it starts at 2.38/sqrt(d).
+template <class RNG, class Target>
+class MetropolisT: public BaseObject
+{
+public:
+    // sizes
+    enum { TuneInterval = 100 };
+
+    // ctors and dtor
+    MetropolisT(const Target &target, const RNG &stream,
+                double scale = 1.0);
+    MetropolisT(const MetropolisT &src);
+    ~MetropolisT();
+
+    // sampler interface
+    void start(const double *x);
+    inline void step() {
+        normal_.fill(&z_[0], dimension_);
+        for (size_t i=0; i<dimension_; ++i)
+        {
+            y_[i] = x_[i] + lambda_*scale_[i]*z_[i];
+        }
+        double logp = target_.logDensity(&y_[0]);
+        ++proposals_;
+        ++evaluations_;
+        if (log(uniform_.random0to1()) < logp - logp_)
+        {
+            x_.swap(y_);
+            logp_ = logp;
+            ++accepted_;
+        }
+    }
+    void adapt();
+    void resetCounts();
+
+    // state and counts
+    size_t dimension() const { return(dimension_); }
+    const double *state() const { return(&x_[0]); }
+    double logDensity() const { return(logp_); }
+    uint64_t proposals() const { return(proposals_); }
+    uint64_t accepted() const { return(accepted_); }
+    uint64_t evaluations() const { return(evaluations_); }
+
+    // proposal scales, lambda*s[i]
+    double lambda() const { return(lambda_); }
+    double scale(size_t i) const { return(scale_[i]); }
+
+private:
+    // not allowed, the target is a reference
+    MetropolisT &operator=(const MetropolisT &rhs);
+
+protected:
+    // internal data
+    const Target &target_;
+    size_t dimension_;
+    GaussianT<RNG> normal_;
+    RNG uniform_;
+    std::vector<double> x_;
+    std::vector<double> y_;
+    std::vector<double> z_;
+    std::vector<double> scale_;
+    double lambda_;
+    double logp_;
+    uint64_t proposals_;
+    uint64_t accepted_;
+    uint64_t evaluations_;
+
+    // burn-in state moments, and steps and acceptances at the last
+    // tuning
+    uint64_t count_;
+    std::vector<double> mean_;
+    std::vector<double> m2_;
+    uint64_t window_;
+    uint64_t mark_;
+};
+
+// slice sampling, one coordinate at a time, by stepping out and
+// shrinkage (neal, "slice sampling", annals of statistics 2003).
+// a step is a sweep over all the coordinates. the interval starts
+// at width w[i] around the point and steps out at most MaxSteps
+// times. during burn-in, every TuneInterval sweeps w[i] is set to
+// twice the mean distance coordinate i has moved. every update is
+// accepted; the cost is in evaluations.
+template <class RNG, class Target>
+class SliceSamplerT: public BaseObject
+{
+public:
+    // sizes
+    enum {
+        TuneInterval = 100,
+        MaxSteps = 32
+    };
+
+    // ctors and dtor
+    SliceSamplerT(const Target &target, const RNG &stream,
+                  double width = 1.0);
+    SliceSamplerT(const SliceSamplerT &src);
+    ~SliceSamplerT();
+
+    // sampler interface
+    void start(const double *x);
+    void step();
+    void adapt();
+    void resetCounts();
+
+    // state and counts
+    size_t dimension() const { return(dimension_); }
+    const double *state() const { return(&x_[0]); }
+    double logDensity() const { return(logp_); }
+    uint64_t proposals() const { return(proposals_); }
+    uint64_t accepted() const { return(proposals_); }
+    uint64_t evaluations() const { return(evaluations_); }
+
+    // interval widths
+    double width(size_t i) const { return(width_[i]); }
+
+private:
+    // not allowed, the target is a reference
+    SliceSamplerT &operator=(const SliceSamplerT &rhs);
+
+protected:
+    // log density with coordinate i moved to v
+    inline double at(size_t i, double v) {
+        x_[i] = v;
+        ++evaluations_;
+        return(target_.logDensity(&x_[0]));
+    }
+
+    // update coordinate i, returns the distance moved
+    double update(size_t i);
+
+protected:
+    // internal data
+    const Target &target_;
+    size_t dimension_;
+    RNG uniform_;
+    std::vector<double> x_;
+    std::vector<double> width_;
+    double logp_;
+    uint64_t proposals_;
+    uint64_t evaluations_;
+
+    // burn-in distances moved since the last tuning
+    uint64_t window_;
+    std::vector<double> moved_;
+};
+
+}
+
+#include "montecarlo/Samplers.i"
+
+#endif
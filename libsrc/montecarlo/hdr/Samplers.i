@@ -0,0 +1,206 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// markov chain monte carlo samplers
+
+namespace ombt {
+
+// ctors and dtor. the normals come from the stream, the uniforms
+// from its second half.
+template <class RNG, class Target>
+MetropolisT<RNG, Target>::MetropolisT(const Target &target,
+                                      const RNG &stream, double scale):
+    BaseObject(true), target_(target), dimension_(target.dimension()),
+    normal_(0.0, 1.0, stream), uniform_(stream),
+    x_(dimension_, 0.0), y_(dimension_, 0.0), z_(dimension_, 0.0),
+    scale_(dimension_, scale), lambda_(2.38/sqrt(double(dimension_))),
+    logp_(-HUGE_VAL), proposals_(0), accepted_(0), evaluations_(0),
+    count_(0), mean_(dimension_, 0.0), m2_(dimension_, 0.0),
+    window_(0), mark_(0)
+{
+    uniform_.jump(uint64_t(1) << 63);
+    if (dimension_ < 1 || !(scale > 0.0)) setOk(false);
+}
+
+template <class RNG, class Target>
+MetropolisT<RNG, Target>::MetropolisT(const MetropolisT &src):
+    BaseObject(src), target_(src.target_), dimension_(src.dimension_),
+    normal_(src.normal_), uniform_(src.uniform_), x_(src.x_), y_(src.y_),
+    z_(src.z_), scale_(src.scale_), lambda_(src.lambda_),
+    logp_(src.logp_), proposals_(src.proposals_),
+    accepted_(src.accepted_), evaluations_(src.evaluations_),
+    count_(src.count_), mean_(src.mean_), m2_(src.m2_),
+    window_(src.window_), mark_(src.mark_)
+{
+}
+
+template <class RNG, class Target>
+MetropolisT<RNG, Target>::~MetropolisT()
+{
+}
+
+// sampler interface
+template <class RNG, class Target>
+void
+MetropolisT<RNG, Target>::start(const double *x)
+{
+    for (size_t i=0; i<dimension_; ++i) x_[i] = x[i];
+    logp_ = target_.logDensity(&x_[0]);
+    ++evaluations_;
+}
+
+template <class RNG, class Target>
+void
+MetropolisT<RNG, Target>::adapt()
+{
+    step();
+
+    double inverse = 1.0/double(++count_);
+    for (size_t i=0; i<dimension_; ++i)
+    {
+        double delta = x_[i] - mean_[i];
+        mean_[i] += delta*inverse;
+        m2_[i] += delta*(x_[i] - mean_[i]);
+    }
+    if (++window_ < TuneInterval) return;
+
+    double rate = double(accepted_ - mark_)/window_;
+    double optimal = (dimension_ == 1) ? 0.44 : 0.234;
+    lambda_ *= exp(2.0*(rate - optimal));
+    window_ = 0;
+    mark_ = accepted_;
+
+    if (count_ < 2*TuneInterval) return;
+    for (size_t i=0; i<dimension_; ++i)
+    {
+        double sd = sqrt(m2_[i]/(count_-1));
+        if (sd > 0.0) scale_[i] = sd;
+    }
+}
+
+template <class RNG, class Target>
+void
+MetropolisT<RNG, Target>::resetCounts()
+{
+    proposals_ = 0;
+    accepted_ = 0;
+    evaluations_ = 0;
+    window_ = 0;
+    mark_ = 0;
+}
+
+// ctors and dtor
+template <class RNG, class Target>
+SliceSamplerT<RNG, Target>::SliceSamplerT(const Target &target,
+                                          const RNG &stream, double width):
+    BaseObject(true), target_(target), dimension_(target.dimension()),
+    uniform_(stream), x_(dimension_, 0.0), width_(dimension_, width),
+    logp_(-HUGE_VAL), proposals_(0), evaluations_(0), window_(0),
+    moved_(dimension_, 0.0)
+{
+    if (dimension_ < 1 || !(width > 0.0)) setOk(false);
+}
+
+template <class RNG, class Target>
+SliceSamplerT<RNG, Target>::SliceSamplerT(const SliceSamplerT &src):
+    BaseObject(src), target_(src.target_), dimension_(src.dimension_),
+    uniform_(src.uniform_), x_(src.x_), width_(src.width_),
+    logp_(src.logp_), proposals_(src.proposals_),
+    evaluations_(src.evaluations_), window_(src.window_),
+    moved_(src.moved_)
+{
+}
+
+template <class RNG, class Target>
+SliceSamplerT<RNG, Target>::~SliceSamplerT()
+{
+}
+
+// sampler interface
+template <class RNG, class Target>
+void
+SliceSamplerT<RNG, Target>::start(const double *x)
+{
+    for (size_t i=0; i<dimension_; ++i) x_[i] = x[i];
+    logp_ = target_.logDensity(&x_[0]);
+    ++evaluations_;
+}
+
+template <class RNG, class Target>
+void
+SliceSamplerT<RNG, Target>::step()
+{
+    for (size_t i=0; i<dimension_; ++i) update(i);
+}
+
+template <class RNG, class Target>
+void
+SliceSamplerT<RNG, Target>::adapt()
+{
+    for (size_t i=0; i<dimension_; ++i) moved_[i] += update(i);
+    if (++window_ < TuneInterval) return;
+
+    for (size_t i=0; i<dimension_; ++i)
+    {
+        double w = 2.0*moved_[i]/window_;
+        if (w > 0.0) width_[i] = w;
+        moved_[i] = 0.0;
+    }
+    window_ = 0;
+}
+
+template <class RNG, class Target>
+void
+SliceSamplerT<RNG, Target>::resetCounts()
+{
+    proposals_ = 0;
+    evaluations_ = 0;
+    window_ = 0;
+    for (size_t i=0; i<dimension_; ++i) moved_[i] = 0.0;
+}
+
+// one coordinate. the slice is the set where the log density is
+// above logp_ + log(u); step out from a randomly placed interval,
+// then draw from it, shrinking it toward the current point after
+// each draw outside the slice. if the interval shrinks to nothing
+// in floating point, the point stays where it is.
+template <class RNG, class Target>
+double
+SliceSamplerT<RNG, Target>::update(size_t i)
+{
+    ++proposals_;
+    double level = logp_ + log(uniform_.random0to1());
+    double x0 = x_[i];
+    double w = width_[i];
+
+    double left = x0 - w*uniform_.random0to1();
+    double right = left + w;
+    int j = int(MaxSteps*uniform_.random0to1());
+    int k = MaxSteps - 1 - j;
+    while (j-- > 0 && at(i, left) > level) left -= w;
+    while (k-- > 0 && at(i, right) > level) right += w;
+
+    for (;;)
+    {
+        double x1 = left + (right-left)*uniform_.random0to1();
+        if (!(x1 > left && x1 < right))
+        {
+            x_[i] = x0;
+            return(0.0);
+        }
+        double logp = at(i, x1);
+        if (logp > level)
+        {
+            logp_ = logp;
+            return(fabs(x1 - x0));
+        }
+        if (x1 < x0)
+            left = x1;
+        else
+            right = x1;
+    }
+}
+
+}
@@ -0,0 +1,286 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// streaming markov chain diagnostics
+
+// headers
+#include "hdr/ChainStatistics.h"
+
+namespace ombt {
+
+// ctors and dtor
+ChainStatistics::ChainStatistics():
+    BaseObject(false), dimension_(0), batches_(DefaultBatches), chains_()
+{
+    setOk(false);
+}
+
+ChainStatistics::ChainStatistics(size_t dimension, unsigned int batches):
+    BaseObject(true), dimension_(dimension), batches_(batches),
+    chains_(1)
+{
+    if (dimension_ < 1 || batches_ < 2) setOk(false);
+    reset(chains_.back());
+}
+
+ChainStatistics::ChainStatistics(const ChainStatistics &src):
+    BaseObject(src), dimension_(src.dimension_), batches_(src.batches_),
+    chains_(src.chains_)
+{
+}
+
+ChainStatistics::~ChainStatistics()
+{
+}
+
+// assignment
+ChainStatistics &
+ChainStatistics::operator=(const ChainStatistics &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        dimension_ = rhs.dimension_;
+        batches_ = rhs.batches_;
+        chains_ = rhs.chains_;
+    }
+    return(*this);
+}
+
+// draws
+void
+ChainStatistics::clear()
+{
+    chains_.resize(1);
+    reset(chains_.back());
+}
+
+void
+ChainStatistics::startChain()
+{
+    chains_.push_back(Chain());
+    reset(chains_.back());
+}
+
+// append the chains of another accumulator. an empty current chain
+// is dropped first, so merging into a new accumulator copies.
+void
+ChainStatistics::merge(const ChainStatistics &other)
+{
+    MustBeTrue(dimension_ == other.dimension_ &&
+               batches_ == other.batches_);
+    if (chains_.size() == 1 && chains_.back().count == 0)
+        chains_.clear();
+    chains_.insert(chains_.end(), other.chains_.begin(),
+                   other.chains_.end());
+    if (chains_.empty()) startChain();
+}
+
+void
+ChainStatistics::reset(Chain &chain) const
+{
+    chain.count = 0;
+    chain.size = 1;
+    chain.partial = 0;
+    chain.full = 0;
+    chain.pmean.assign(dimension_, 0.0);
+    chain.pm2.assign(dimension_, 0.0);
+    chain.bmean.assign(2*batches_*dimension_, 0.0);
+    chain.bm2.assign(2*batches_*dimension_, 0.0);
+}
+
+// close the partial batch, combining batches when all are full.
+// two batches of b draws each combine as mean (a+c)/2 and
+// m2a + m2c + (c-a)^2 b/2.
+void
+ChainStatistics::flush(Chain &chain)
+{
+    const size_t stride = 2*batches_;
+    for (size_t i=0; i<dimension_; ++i)
+    {
+        chain.bmean[i*stride+chain.full] = chain.pmean[i];
+        chain.bm2[i*stride+chain.full] = chain.pm2[i];
+        chain.pmean[i] = 0.0;
+        chain.pm2[i] = 0.0;
+    }
+    chain.partial = 0;
+    if (++chain.full < stride) return;
+
+    double half = 0.5*chain.size;
+    for (size_t i=0; i<dimension_; ++i)
+    {
+        double *mean = &chain.bmean[i*stride];
+        double *m2 = &chain.bm2[i*stride];
+        for (size_t b=0; b<batches_; ++b)
+        {
+            double a = mean[2*b];
+            double c = mean[2*b+1];
+            mean[b] = 0.5*(a+c);
+            m2[b] = m2[2*b] + m2[2*b+1] + (c-a)*(c-a)*half;
+        }
+    }
+    chain.full = batches_;
+    chain.size *= 2;
+}
+
+// chan's update of (n, mean, m2) with another set
+void
+ChainStatistics::combine(double &n, double &mean, double &m2,
+                         double nb, double meanb, double m2b)
+{
+    if (nb <= 0.0) return;
+    double total = n + nb;
+    double delta = meanb - mean;
+    mean += delta*nb/total;
+    m2 += m2b + delta*delta*n*nb/total;
+    n = total;
+}
+
+// full batches [first,last) of parameter i of a chain
+void
+ChainStatistics::batches(const Chain &chain, size_t i, size_t first,
+                         size_t last, double &n, double &mean,
+                         double &m2) const
+{
+    const size_t stride = 2*batches_;
+    n = 0.0;
+    mean = 0.0;
+    m2 = 0.0;
+    for (size_t b=first; b<last; ++b)
+    {
+        combine(n, mean, m2, double(chain.size),
+                chain.bmean[i*stride+b], chain.bm2[i*stride+b]);
+    }
+}
+
+// sizes
+uint64_t
+ChainStatistics::count() const
+{
+    uint64_t total = 0;
+    for (size_t c=0; c<chains_.size(); ++c) total += chains_[c].count;
+    return(total);
+}
+
+// parameter i over everything, the partial batches included
+void
+ChainStatistics::totals(size_t i, double &n, double &mean,
+                        double &m2) const
+{
+    MustBeTrue(i < dimension_);
+    n = 0.0;
+    mean = 0.0;
+    m2 = 0.0;
+    for (size_t c=0; c<chains_.size(); ++c)
+    {
+        const Chain &chain = chains_[c];
+        double nc, meanc, m2c;
+        batches(chain, i, 0, chain.full, nc, meanc, m2c);
+        combine(nc, meanc, m2c, double(chain.partial),
+                chain.pmean[i], chain.pm2[i]);
+        combine(n, mean, m2, nc, meanc, m2c);
+    }
+}
+
+double
+ChainStatistics::mean(size_t i) const
+{
+    double n, mean, m2;
+    totals(i, n, mean, m2);
+    return((n > 0.0) ? mean : NAN);
+}
+
+double
+ChainStatistics::variance(size_t i) const
+{
+    double n, mean, m2;
+    totals(i, n, mean, m2);
+    return((n > 1.0) ? m2/(n-1.0) : NAN);
+}
+
+// split rhat. with an odd number of full batches the middle one is
+// left out, so the halves are the same length.
+double
+ChainStatistics::rhat(size_t i) const
+{
+    MustBeTrue(i < dimension_);
+    double halves = 0.0;
+    double length = 0.0;
+    double within = 0.0;
+    double between = 0.0;
+    double grand = 0.0;
+    for (size_t c=0; c<chains_.size(); ++c)
+    {
+        const Chain &chain = chains_[c];
+        size_t half = chain.full/2;
+        if (half < 1 || chain.size*half < 2) return(NAN);
+
+        for (int h=0; h<2; ++h)
+        {
+            size_t first = (h == 0) ? 0 : chain.full-half;
+            double n, mean, m2;
+            batches(chain, i, first, first+half, n, mean, m2);
+
+            // running mean and variance of the half means
+            halves += 1.0;
+            double delta = mean - grand;
+            grand += delta/halves;
+            between += delta*(mean - grand);
+            length += n;
+            within += m2/(n-1.0);
+        }
+    }
+    if (halves < 2.0) return(NAN);
+
+    double n = length/halves;
+    double w = within/halves;
+    double b = between/(halves-1.0);
+    if (!(w > 0.0)) return(NAN);
+    return(sqrt(((n-1.0)/n*w + b)/w));
+}
+
+// effective sample size, summed over the chains
+double
+ChainStatistics::ess(size_t i) const
+{
+    MustBeTrue(i < dimension_);
+    const size_t stride = 2*batches_;
+    double total = 0.0;
+    bool some = false;
+    for (size_t c=0; c<chains_.size(); ++c)
+    {
+        const Chain &chain = chains_[c];
+        if (chain.full < 2) continue;
+
+        double n, mean, m2;
+        batches(chain, i, 0, chain.full, n, mean, m2);
+
+        // variance of the batch means
+        const double *bmean = &chain.bmean[i*stride];
+        double sum2 = 0.0;
+        for (size_t b=0; b<chain.full; ++b)
+        {
+            double d = bmean[b] - mean;
+            sum2 += d*d;
+        }
+        double s2 = m2/(n-1.0);
+        double sb2 = sum2/(chain.full-1);
+        if (sb2 > 0.0)
+            total += chain.full*s2/sb2;
+        else
+            total += n;
+        some = true;
+    }
+    return(some ? total : NAN);
+}
+
+// of the mean, from the effective sample size
+double
+ChainStatistics::standardError(size_t i) const
+{
+    return(sqrt(variance(i)/ess(i)));
+}
+
+}
@@ -0,0 +1,267 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// goodness-of-fit of a sampler
+
+// headers
+#include "hdr/GoodnessOfFit.h"
+#include "specialfunctions/SpecialFunctions.h"
+
+namespace ombt {
+
+// ctors and dtor
+GoodnessOfFit::GoodnessOfFit(Kind kind, size_t bins):
+    BaseObject(true), kind_(kind), counts_(), count_(0), invalid_(0)
+{
+    // the chi-square cells are unions of bins
+    if (bins < 2 || (bins & (bins-1)) != 0)
+    {
+        setOk(false);
+        return;
+    }
+    counts_.resize(bins, 0);
+}
+
+GoodnessOfFit::GoodnessOfFit(const GoodnessOfFit &src):
+    BaseObject(src), kind_(src.kind_), counts_(src.counts_),
+    count_(src.count_), invalid_(src.invalid_)
+{
+}
+
+GoodnessOfFit::~GoodnessOfFit()
+{
+}
+
+// assignment
+GoodnessOfFit &
+GoodnessOfFit::operator=(const GoodnessOfFit &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        kind_ = rhs.kind_;
+        counts_ = rhs.counts_;
+        count_ = rhs.count_;
+        invalid_ = rhs.invalid_;
+    }
+    return(*this);
+}
+
+// reducer interface
+void
+GoodnessOfFit::clear()
+{
+    counts_.assign(counts_.size(), 0);
+    count_ = 0;
+    invalid_ = 0;
+}
+
+void
+GoodnessOfFit::add(const double *u, size_t n)
+{
+    MustBeTrue(isOk());
+    size_t nbins = counts_.size();
+    double scale = double(nbins);
+    for (size_t i=0; i<n; ++i)
+    {
+        if (u[i] >= 0.0 && u[i] <= 1.0)
+        {
+            size_t bin = size_t(u[i]*scale);
+            counts_[(bin < nbins) ? bin : nbins-1]++;
+        }
+        else
+        {
+            ++invalid_;
+        }
+    }
+    count_ += n;
+}
+
+void
+GoodnessOfFit::merge(const GoodnessOfFit &other)
+{
+    MustBeTrue(counts_.size() == other.counts_.size());
+    for (size_t i=0; i<counts_.size(); ++i)
+    {
+        counts_[i] += other.counts_[i];
+    }
+    count_ += other.count_;
+    invalid_ += other.invalid_;
+}
+
+// chi-square over about 2 n^(2/5) cells, a power of two dividing
+// the bins, with at least 5 expected in each
+unsigned long
+GoodnessOfFit::chiSquareCells() const
+{
+    double n = double(count_ - invalid_);
+    double target = 2.0*pow(n, 0.4);
+    unsigned long cells = 2;
+    while (cells*2 <= counts_.size() && cells*2 <= n/5.0 &&
+           fabs(log(cells*2.0/target)) < fabs(log(cells/target)))
+    {
+        cells *= 2;
+    }
+    return(cells);
+}
+
+double
+GoodnessOfFit::chiSquare() const
+{
+    MustBeTrue(isOk());
+    uint64_t valid = count_ - invalid_;
+    if (valid == 0) return(NAN);
+
+    unsigned long cells = chiSquareCells();
+    size_t width = counts_.size()/cells;
+    double expected = double(valid)/cells;
+    double chi2 = 0.0;
+    for (size_t c=0; c<cells; ++c)
+    {
+        uint64_t observed = 0;
+        for (size_t i=c*width; i<(c+1)*width; ++i)
+        {
+            observed += counts_[i];
+        }
+        double d = double(observed) - expected;
+        chi2 += d*d/expected;
+    }
+    return(chi2);
+}
+
+double
+GoodnessOfFit::chiSquareP() const
+{
+    double chi2 = chiSquare();
+    if (isnan(chi2)) return(NAN);
+    return(gammaQ(0.5*(chiSquareCells()-1), 0.5*chi2));
+}
+
+// kolmogorov-smirnov distance at the bin edges
+double
+GoodnessOfFit::kolmogorovSmirnov() const
+{
+    MustBeTrue(isOk());
+    uint64_t valid = count_ - invalid_;
+    if (valid == 0) return(NAN);
+
+    size_t nbins = counts_.size();
+    double d = 0.0;
+    uint64_t sofar = 0;
+    for (size_t i=0; i+1<nbins; ++i)
+    {
+        sofar += counts_[i];
+        double diff = fabs(double(sofar)/valid - double(i+1)/nbins);
+        if (diff > d) d = diff;
+    }
+    return(d);
+}
+
+// asymptotic kolmogorov distribution, with stephens' correction
+// for finite n. the theta-function form converges fast for small
+// arguments, the alternating series for large ones.
+double
+GoodnessOfFit::kolmogorovSmirnovP() const
+{
+    double d = kolmogorovSmirnov();
+    if (isnan(d)) return(NAN);
+    double rootn = sqrt(double(count_ - invalid_));
+    double lambda = (rootn + 0.12 + 0.11/rootn)*d;
+    if (lambda <= 0.0) return(1.0);
+
+    if (lambda < 1.18)
+    {
+        double y = M_PI*M_PI/(8.0*lambda*lambda);
+        double sum = 0.0;
+        for (int k=1; k<=7; k+=2)
+        {
+            sum += exp(-k*k*y);
+        }
+        return(1.0 - sqrt(2.0*M_PI)/lambda*sum);
+    }
+    else
+    {
+        double sum = 0.0;
+        double sign = 1.0;
+        for (int k=1; k<=20; ++k, sign=-sign)
+        {
+            sum += sign*exp(-2.0*k*k*lambda*lambda);
+        }
+        return(2.0*sum);
+    }
+}
+
+// anderson-darling. in a bin [a,b] the empirical distribution is
+// the straight line through its values at the edges, so that
+// Fn(u) - u = alpha + beta u and the integral of
+// (alpha + beta u)^2/(u(1-u)) is, in closed form,
+//
+//     alpha^2 log(b/a) + (alpha+beta)^2 log((1-a)/(1-b)) - beta^2 (b-a)
+//
+// alpha is zero in the first bin and alpha+beta in the last.
+double
+GoodnessOfFit::andersonDarling() const
+{
+    MustBeTrue(isOk());
+    uint64_t valid = count_ - invalid_;
+    if (valid == 0) return(NAN);
+
+    size_t nbins = counts_.size();
+    double width = 1.0/nbins;
+    double n = double(valid);
+    double sum = 0.0;
+    uint64_t sofar = 0;
+    for (size_t i=0; i<nbins; ++i)
+    {
+        double a = i*width;
+        double b = (i+1)*width;
+        double fa = double(sofar)/n;
+        double slope = double(counts_[i])/n/width;
+        double beta = slope - 1.0;
+        double alpha = fa - slope*a;
+        double term = -beta*beta*width;
+        if (i > 0)
+            term += alpha*alpha*log1p(width/a);
+        if (i+1 < nbins)
+            term += (alpha+beta)*(alpha+beta)*log1p(width/(1.0-b));
+        sum += term;
+        sofar += counts_[i];
+    }
+    return(n*sum);
+}
+
+// asymptotic anderson-darling distribution, marsaglia and
+// marsaglia, "evaluating the anderson-darling distribution", 2004
+double
+GoodnessOfFit::andersonDarlingP() const
+{
+    double z = andersonDarling();
+    if (isnan(z)) return(NAN);
+    if (z <= 0.0) return(1.0);
+
+    double p;
+    if (z < 2.0)
+    {
+        p = exp(-1.2337141/z)/sqrt(z)*
+            (2.00012 + (0.247105 - (0.0649821 - (0.0347962 -
+            (0.011672 - 0.00168691*z)*z)*z)*z)*z);
+    }
+    else
+    {
+        p = exp(-exp(1.0776 - (2.30695 - (0.43424 - (0.082433 -
+            (0.008056 - 0.0003146*z)*z)*z)*z)*z));
+    }
+    return(1.0 - p);
+}
+
+bool
+GoodnessOfFit::passed(double alpha) const
+{
+    if (count_ == 0 || invalid_ != 0) return(false);
+    return(chiSquareP() >= alpha && kolmogorovSmirnovP() >= alpha &&
+           andersonDarlingP() >= alpha);
+}
+
+}
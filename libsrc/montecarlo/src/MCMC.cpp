@@ -0,0 +1,15 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// parallel markov chain monte carlo driver, default instantiation
+
+// headers
+#include "hdr/MCMC.h"
+
+namespace ombt {
+
+template class MCMCT<Random>;
+
+}
@@ -0,0 +1,15 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// parallel monte carlo driver, default instantiation
+
+// headers
+#include "hdr/MonteCarlo.h"
+
+namespace ombt {
+
+template class MonteCarloT<Random>;
+
+}
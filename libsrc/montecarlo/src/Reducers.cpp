@@ -0,0 +1,198 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// reducers for the monte carlo driver
+
+// headers
+#include "hdr/Reducers.h"
+
+namespace ombt {
+
+// compensated sum. ctors and dtor
+SumReducer::SumReducer():
+    BaseObject(true), count_(0), sum_(0.0), compensation_(0.0)
+{
+}
+
+SumReducer::SumReducer(const SumReducer &src):
+    BaseObject(src), count_(src.count_), sum_(src.sum_),
+    compensation_(src.compensation_)
+{
+}
+
+SumReducer::~SumReducer()
+{
+}
+
+// assignment
+SumReducer &
+SumReducer::operator=(const SumReducer &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        count_ = rhs.count_;
+        sum_ = rhs.sum_;
+        compensation_ = rhs.compensation_;
+    }
+    return(*this);
+}
+
+// reducer interface
+void
+SumReducer::clear()
+{
+    count_ = 0;
+    sum_ = 0.0;
+    compensation_ = 0.0;
+}
+
+void
+SumReducer::add(const double *x, size_t n)
+{
+    double s = sum_;
+    double c = compensation_;
+    for (size_t i=0; i<n; ++i)
+    {
+        double t = s + x[i];
+        if (fabs(s) >= fabs(x[i]))
+            c += (s - t) + x[i];
+        else
+            c += (x[i] - t) + s;
+        s = t;
+    }
+    sum_ = s;
+    compensation_ = c;
+    count_ += n;
+}
+
+void
+SumReducer::merge(const SumReducer &other)
+{
+    double t = sum_ + other.sum_;
+    if (fabs(sum_) >= fabs(other.sum_))
+        compensation_ += (sum_ - t) + other.sum_;
+    else
+        compensation_ += (other.sum_ - t) + sum_;
+    sum_ = t;
+    compensation_ += other.compensation_;
+    count_ += other.count_;
+}
+
+double
+SumReducer::mean() const
+{
+    return((count_ > 0) ? sum()/count_ : NAN);
+}
+
+// histogram. ctors and dtor
+HistogramReducer::HistogramReducer():
+    BaseObject(false), lo_(0.0), hi_(0.0), width_(0.0), iwidth_(0.0),
+    counts_(), underflow_(0), overflow_(0)
+{
+    setOk(false);
+}
+
+HistogramReducer::HistogramReducer(double lo, double hi, size_t nbins):
+    BaseObject(true), lo_(lo), hi_(hi), width_(0.0), iwidth_(0.0),
+    counts_(), underflow_(0), overflow_(0)
+{
+    if (!(lo < hi) || nbins == 0)
+    {
+        setOk(false);
+        return;
+    }
+    width_ = (hi-lo)/nbins;
+    iwidth_ = nbins/(hi-lo);
+    counts_.resize(nbins, 0);
+}
+
+HistogramReducer::HistogramReducer(const HistogramReducer &src):
+    BaseObject(src), lo_(src.lo_), hi_(src.hi_), width_(src.width_),
+    iwidth_(src.iwidth_), counts_(src.counts_),
+    underflow_(src.underflow_), overflow_(src.overflow_)
+{
+}
+
+HistogramReducer::~HistogramReducer()
+{
+}
+
+// assignment
+HistogramReducer &
+HistogramReducer::operator=(const HistogramReducer &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        lo_ = rhs.lo_;
+        hi_ = rhs.hi_;
+        width_ = rhs.width_;
+        iwidth_ = rhs.iwidth_;
+        counts_ = rhs.counts_;
+        underflow_ = rhs.underflow_;
+        overflow_ = rhs.overflow_;
+    }
+    return(*this);
+}
+
+// reducer interface
+void
+HistogramReducer::clear()
+{
+    counts_.assign(counts_.size(), 0);
+    underflow_ = 0;
+    overflow_ = 0;
+}
+
+void
+HistogramReducer::add(const double *x, size_t n)
+{
+    MustBeTrue(isOk());
+    size_t nbins = counts_.size();
+    for (size_t i=0; i<n; ++i)
+    {
+        if (!(x[i] >= lo_))
+        {
+            ++underflow_;
+        }
+        else if (x[i] >= hi_)
+        {
+            ++overflow_;
+        }
+        else
+        {
+            // rounding can put a value just below hi in bin nbins
+            size_t bin = size_t((x[i]-lo_)*iwidth_);
+            counts_[(bin < nbins) ? bin : nbins-1]++;
+        }
+    }
+}
+
+void
+HistogramReducer::merge(const HistogramReducer &other)
+{
+    MustBeTrue(lo_ == other.lo_ && hi_ == other.hi_ &&
+               counts_.size() == other.counts_.size());
+    for (size_t i=0; i<counts_.size(); ++i)
+    {
+        counts_[i] += other.counts_[i];
+    }
+    underflow_ += other.underflow_;
+    overflow_ += other.overflow_;
+}
+
+uint64_t
+HistogramReducer::total() const
+{
+    uint64_t total = underflow_ + overflow_;
+    for (size_t i=0; i<counts_.size(); ++i)
+    {
+        total += counts_[i];
+    }
+    return(total);
+}
+
+}
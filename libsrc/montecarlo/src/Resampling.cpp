@@ -0,0 +1,15 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// parallel bootstrap and permutation tests, default instantiation
+
+// headers
+#include "hdr/Resampling.h"
+
+namespace ombt {
+
+template class ResamplingT<Random>;
+
+}
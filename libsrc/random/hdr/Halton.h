@@ -0,0 +1,93 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// halton low-discrepancy sequence, with owen scrambling.
+//
+// a quasi-random source with the same interface as the other
+// engines. as for Sobol, the values are the coordinates of the
+// points, point after point, and only samplers using one uniform
+// value per variate keep the points intact.
+#ifndef __OMBT_HALTON_H
+#define __OMBT_HALTON_H
+
+// headers
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace ombt {
+
+// halton generator
+class Halton {
+public:
+    // dimensions, one prime base each
+    enum { MaxDimensions = 1111 };
+
+    // ctors and dtor
+    Halton();
+    Halton(unsigned long newKey, unsigned int dimensions = 1,
+           bool scramble = true);
+    Halton(const Halton &src);
+    ~Halton();
+
+    // assignment
+    Halton &operator=(const Halton &rhs);
+
+    // operations. the key selects the scrambling, and the sequence
+    // restarts at point 0.
+    void setKey(unsigned long newKey);
+    inline unsigned long random() {
+        if (coord_ >= dimensions_)
+        {
+            ++index_;
+            coord_ = 0;
+        }
+        uint64_t x = value(index_, coord_);
+        ++coord_;
+        return(x);
+    }
+    // top 53 bits, centered so the result is in the open interval (0,1)
+    inline double random0to1() {
+        return(((random() >> 11) + 0.5)*(1.0/9007199254740992.0));
+    }
+    inline unsigned char randomchar() {
+        return('A'+random()%26);
+    }
+    inline void fill(double *out, size_t n) {
+        for (size_t i=0; i<n; ++i)
+        {
+            out[i] = random0to1();
+        }
+    }
+
+    // sequence in use
+    unsigned int getDimensions() const { return(dimensions_); }
+    uint64_t getPoint() const { return(index_); }
+
+    // skip ahead n values in O(1)
+    void jump(uint64_t n);
+
+    // substreams are 2**40 points apart. stream i starts where this
+    // generator would be after i*2**40 points.
+    void jumpSubstreams(uint64_t i);
+    Halton substream(uint64_t i) const;
+    std::vector<Halton> split(unsigned int k) const;
+
+protected:
+    // coordinate of a point, as a 64-bit fraction
+    uint64_t value(uint64_t point, unsigned int coord) const;
+
+protected:
+    // data
+    unsigned int dimensions_;
+    bool scramble_;
+    uint64_t index_;
+    unsigned int coord_;
+    std::vector<uint64_t> seeds_;
+};
+
+}
+
+#endif
@@ -0,0 +1,82 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// pcg64 pseudo-random number generator (o'neill), the 128-bit
+// lcg with the xsl-rr output permutation. the modulus is 2**128,
+// so the state update is a multiply and add, no division.
+#ifndef __OMBT_PCG64_H
+#define __OMBT_PCG64_H
+
+// headers
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace ombt {
+
+// pcg64 generator
+class PCG64 {
+public:
+    // types
+    typedef unsigned __int128 uint128;
+
+    // ctors and dtor
+    PCG64();
+    PCG64(unsigned long newKey, unsigned long stream = 0);
+    PCG64(const PCG64 &src);
+    ~PCG64();
+
+    // assignment
+    PCG64 &operator=(const PCG64 &rhs);
+
+    // operations
+    void setKey(unsigned long newKey);
+    void setKey(unsigned long newKey, unsigned long stream);
+    inline unsigned long random() {
+        state_ = state_*multiplier() + inc_;
+        uint64_t xsl = uint64_t(state_ >> 64) ^ uint64_t(state_);
+        unsigned int rot = (unsigned int)(state_ >> 122);
+        return((xsl >> rot) | (xsl << ((-rot) & 63)));
+    }
+    // top 53 bits, centered so the result is in the open interval (0,1)
+    inline double random0to1() {
+        return(((random() >> 11) + 0.5)*(1.0/9007199254740992.0));
+    }
+    inline unsigned char randomchar() {
+        return('A'+random()%26);
+    }
+    inline void fill(double *out, size_t n) {
+        for (size_t i=0; i<n; ++i)
+        {
+            out[i] = random0to1();
+        }
+    }
+
+    // skip ahead n values in O(log n)
+    void jump(uint64_t n);
+    void advance(uint128 delta);
+
+    // substreams are 2**64 values apart. stream i starts where
+    // this generator would be after i*2**64 values.
+    void jumpSubstreams(uint64_t i);
+    PCG64 substream(uint64_t i) const;
+    std::vector<PCG64> split(unsigned int k) const;
+
+protected:
+    // utilities
+    static inline uint128 multiplier() {
+        return((uint128(2549297995355413924ULL) << 64) + 
+                uint128(4865540595714422341ULL));
+    }
+
+protected:
+    // data
+    uint128 state_;
+    uint128 inc_;
+};
+
+}
+
+#endif
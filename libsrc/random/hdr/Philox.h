@@ -0,0 +1,90 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// philox4x64-10 counter-based random number generator (salmon,
+// moraes, dror and shaw). each 256-bit counter value is encrypted
+// with the 128-bit key, giving four 64-bit outputs per block.
+#ifndef __OMBT_PHILOX_H
+#define __OMBT_PHILOX_H
+
+// headers
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace ombt {
+
+// philox4x64-10 generator
+class Philox {
+public:
+    // types
+    typedef unsigned __int128 uint128;
+
+    // ctors and dtor
+    Philox();
+    Philox(unsigned long newKey, unsigned long stream = 0);
+    Philox(const Philox &src);
+    ~Philox();
+
+    // assignment
+    Philox &operator=(const Philox &rhs);
+
+    // operations
+    void setKey(unsigned long newKey);
+    void setKey(unsigned long newKey, unsigned long stream);
+    inline unsigned long random() {
+        if (index_ >= 4)
+        {
+            generate();
+            index_ = 0;
+        }
+        return(output_[index_++]);
+    }
+    // top 53 bits, centered so the result is in the open interval (0,1)
+    inline double random0to1() {
+        return(((random() >> 11) + 0.5)*(1.0/9007199254740992.0));
+    }
+    inline unsigned char randomchar() {
+        return('A'+random()%26);
+    }
+    inline void fill(double *out, size_t n) {
+        for (size_t i=0; i<n; ++i)
+        {
+            out[i] = random0to1();
+        }
+    }
+
+    // skip ahead n values in O(1), it is just counter arithmetic
+    void jump(uint64_t n);
+
+    // substreams are 2**66 values (2**64 blocks) apart. stream i 
+    // starts where this generator would be after i*2**66 values.
+    void jumpSubstreams(uint64_t i);
+    Philox substream(uint64_t i) const;
+    std::vector<Philox> split(unsigned int k) const;
+
+    // the block function itself: encrypt counter with key
+    static void block(const uint64_t counter[4], 
+                      const uint64_t key[2], uint64_t output[4]);
+
+protected:
+    // encrypt the current counter and bump it
+    void generate();
+
+    // move to value index of the block that is blocks past the
+    // current one
+    void seek(uint128 blocks, unsigned int index);
+
+protected:
+    // data
+    uint64_t key_[2];
+    uint64_t counter_[4];
+    uint64_t output_[4];
+    unsigned int index_;
+};
+
+}
+
+#endif
@@ -8,8 +8,15 @@
 #define __RANDOM_H
 
 // headers
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
 #include "atomic/BaseObject.h"
+#include "random/Xoshiro256.h"
+#include "random/PCG64.h"
+#include "random/Philox.h"
 
+// old interface, now using the calling thread's default generator
 extern void setKey(unsigned long);
 extern unsigned long myrandom();
 extern unsigned char myrandomchar();
@@ -19,26 +26,137 @@ namespace ombt {
 // random class
 class Random: public BaseObject {
 public:
+    // available engines. LCGEngine is the original generator
+    // and is the default, so old keys give the same sequences.
+    enum EngineType { 
+        LCGEngine, 
+        XoshiroEngine, 
+        PCGEngine, 
+        PhiloxEngine 
+    };
+
     // ctors and dtor
     Random();
     Random(unsigned long newKey, unsigned long m = (unsigned long)(-1),
            unsigned long a = 663608941, unsigned long c = 0);
+    Random(EngineType engine, unsigned long newKey);
+    Random(const Random &src);
     virtual ~Random();
 
+    // assignment
+    Random &operator=(const Random &rhs);
+
     // operations
     virtual void setKey(unsigned long);
     virtual unsigned long random();
     virtual double random0to1();
     virtual unsigned char randomchar();
 
+    // fill an array with values in (0,1), same as random0to1()
+    virtual void fill(double *out, size_t n);
+
+    // engine in use
+    EngineType getEngine() const { return(engine_); }
+
+    // skip ahead n values in O(log n)
+    void jump(uint64_t n);
+
+    // non-overlapping substreams for parallel use. stream i starts
+    // i*stride values ahead of this generator, where the stride is
+    // 2**40 for the lcg, 2**128 for xoshiro256**, 2**64 for pcg64 
+    // and 2**66 for philox. the streams are reproducible: stream i 
+    // is the same no matter how many streams are asked for.
+    void jumpSubstreams(uint64_t i);
+    Random substream(uint64_t i) const;
+    std::vector<Random> split(unsigned int k) const;
+
+protected:
+    // utilities
+    void jumpLCG(uint64_t n, uint64_t times = 1);
+
 protected:
     // data
+    EngineType engine_;
     unsigned long m_;
     unsigned long a_;
     unsigned long c_;
     unsigned long Ikey_;
+    Xoshiro256 xoshiro_;
+    PCG64 pcg_;
+    Philox philox_;
 };
 
+// per-thread default generator. it is the original lcg, used by 
+// setKey(), myrandom(), myrandomchar() and Random(), but each thread
+// has its own state, so there is no shared data between threads.
+// the key for a thread is derived from the master key and the 
+// thread's stream number. streams are numbered in order of first 
+// use, or set explicitly with setThreadStream() for reproducible
+// runs. stream 0 with the default master key gives the sequence of
+// the old global generator. set the master key before starting
+// threads; it only reseeds the calling thread.
+extern void setMasterKey(unsigned long newKey);
+extern unsigned long getMasterKey();
+extern void setThreadStream(unsigned long stream);
+extern unsigned long getThreadStream();
+extern Random &threadRandom();
+
+// the per-draw operations are inline so a distribution holding a
+// Random by value gets them devirtualized and inlined.
+inline unsigned long 
+Random::random() 
+{
+    switch (engine_)
+    {
+    case XoshiroEngine:
+        return(xoshiro_.random());
+    case PCGEngine:
+        return(pcg_.random());
+    case PhiloxEngine:
+        return(philox_.random());
+    case LCGEngine:
+    default:
+        Ikey_ = (a_*Ikey_+c_)%m_; 
+        return(Ikey_);
+    }
+}
+
+inline double 
+Random::random0to1() 
+{
+    switch (engine_)
+    {
+    case XoshiroEngine:
+        return(xoshiro_.random0to1());
+    case PCGEngine:
+        return(pcg_.random0to1());
+    case PhiloxEngine:
+        return(philox_.random0to1());
+    case LCGEngine:
+    default:
+        Ikey_ = (a_*Ikey_+c_)%m_; 
+        return(double(Ikey_)/double(m_));
+    }
+}
+
+inline unsigned char 
+Random::randomchar() 
+{
+    switch (engine_)
+    {
+    case XoshiroEngine:
+        return(xoshiro_.randomchar());
+    case PCGEngine:
+        return(pcg_.randomchar());
+    case PhiloxEngine:
+        return(philox_.randomchar());
+    case LCGEngine:
+    default:
+        Ikey_ = (a_*Ikey_+c_)%m_; 
+        return('A'+Ikey_%26);
+    }
+}
+
 }
 
 #endif
@@ -0,0 +1,129 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// sobol low-discrepancy sequence, with owen scrambling.
+//
+// a quasi-random source with the same interface as the other
+// engines, so any distribution can be instantiated with it. the
+// values are the coordinates of the points of a sobol sequence in
+// the given number of dimensions, point after point: with d
+// dimensions, values 0 to d-1 are point 0, values d to 2d-1 are
+// point 1, and so on. a consumer drawing exactly d values per
+// sample gets one sobol point per sample.
+//
+// only samplers using one uniform value per variate (the inverse
+// transform ones: Uniform, Exponential, Weibull, Geometric, ...)
+// keep the points intact. rejection samplers use a varying number
+// of values and scatter the coordinates.
+#ifndef __OMBT_SOBOL_H
+#define __OMBT_SOBOL_H
+
+// headers
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace ombt {
+
+// sobol generator
+class Sobol {
+public:
+    // dimensions with direction numbers, all primitive polynomials
+    // up to degree 13
+    enum { MaxDimensions = 1111 };
+
+    // ctors and dtor
+    Sobol();
+    Sobol(unsigned long newKey, unsigned int dimensions = 1,
+          bool scramble = true);
+    Sobol(const Sobol &src);
+    ~Sobol();
+
+    // assignment
+    Sobol &operator=(const Sobol &rhs);
+
+    // operations. the key selects the scrambling, and the sequence
+    // restarts at point 0.
+    void setKey(unsigned long newKey);
+    inline unsigned long random() {
+        if (coord_ >= dimensions_) next();
+        uint64_t x = x_[coord_];
+        if (scramble_) x = owen(x, seeds_[coord_]);
+        ++coord_;
+        return(x);
+    }
+    // top 53 bits, centered so the result is in the open interval (0,1)
+    inline double random0to1() {
+        return(((random() >> 11) + 0.5)*(1.0/9007199254740992.0));
+    }
+    inline unsigned char randomchar() {
+        return('A'+random()%26);
+    }
+    inline void fill(double *out, size_t n) {
+        for (size_t i=0; i<n; ++i)
+        {
+            out[i] = random0to1();
+        }
+    }
+
+    // sequence in use
+    unsigned int getDimensions() const { return(dimensions_); }
+    uint64_t getPoint() const { return(index_); }
+
+    // skip ahead n values in O(dimensions), the point is computed
+    // directly from its index
+    void jump(uint64_t n);
+
+    // substreams are 2**40 points apart. stream i starts where this
+    // generator would be after i*2**40 points. every run of 2**k
+    // points starting at a multiple of 2**k is a net by itself, so
+    // substreams used for a power-of-two number of points each
+    // keep the low discrepancy.
+    void jumpSubstreams(uint64_t i);
+    Sobol substream(uint64_t i) const;
+    std::vector<Sobol> split(unsigned int k) const;
+
+protected:
+    // utilities
+    void next();
+    void seek(uint64_t point, unsigned int coord);
+
+    // nested uniform (owen) scrambling with a hash, after laine and
+    // karras, and burley. with the bits reversed, bit k of the hash
+    // depends only on bits 0 to k, so in the original order every
+    // bit is flipped by a function of the bits above it, which is
+    // owen's scrambling tree.
+    static inline uint64_t reverse(uint64_t x) {
+        x = ((x >> 1) & 0x5555555555555555ULL) |
+            ((x & 0x5555555555555555ULL) << 1);
+        x = ((x >> 2) & 0x3333333333333333ULL) |
+            ((x & 0x3333333333333333ULL) << 2);
+        x = ((x >> 4) & 0x0f0f0f0f0f0f0f0fULL) |
+            ((x & 0x0f0f0f0f0f0f0f0fULL) << 4);
+        return(__builtin_bswap64(x));
+    }
+    static inline uint64_t owen(uint64_t x, uint64_t seed) {
+        x = reverse(x);
+        x ^= x*0x3d20adea9b3f6c4eULL;
+        x += seed;
+        x *= (seed >> 32) | 1;
+        x ^= x*0x05526c56e7a3b1d2ULL;
+        x ^= x*0x53a22864c2b5f7aaULL;
+        return(reverse(x));
+    }
+
+protected:
+    // data
+    unsigned int dimensions_;
+    bool scramble_;
+    uint64_t index_;
+    unsigned int coord_;
+    std::vector<uint64_t> x_;
+    std::vector<uint64_t> seeds_;
+};
+
+}
+
+#endif
@@ -0,0 +1,38 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// splitmix64 generator, used to expand a single key into the
+// state of the larger generators.
+#ifndef __OMBT_SPLITMIX64_H
+#define __OMBT_SPLITMIX64_H
+
+// headers
+#include <stdint.h>
+
+namespace ombt {
+
+// seed expander
+class SplitMix64 {
+public:
+    // ctors and dtor
+    SplitMix64(uint64_t seed = 0): state_(seed) { }
+    ~SplitMix64() { }
+
+    // operations
+    inline uint64_t next() {
+        uint64_t z = (state_ += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return(z ^ (z >> 31));
+    }
+
+protected:
+    // data
+    uint64_t state_;
+};
+
+}
+
+#endif
@@ -0,0 +1,80 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// xoshiro256** pseudo-random number generator (blackman and vigna).
+// period 2**256-1, 256 bits of state, no division per draw.
+#ifndef __OMBT_XOSHIRO256_H
+#define __OMBT_XOSHIRO256_H
+
+// headers
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace ombt {
+
+// xoshiro256** generator
+class Xoshiro256 {
+public:
+    // ctors and dtor
+    Xoshiro256();
+    Xoshiro256(unsigned long newKey);
+    Xoshiro256(const Xoshiro256 &src);
+    ~Xoshiro256();
+
+    // assignment
+    Xoshiro256 &operator=(const Xoshiro256 &rhs);
+
+    // operations
+    void setKey(unsigned long newKey);
+    inline unsigned long random() {
+        uint64_t result = rotl(s_[1]*5, 7)*9;
+        uint64_t t = s_[1] << 17;
+        s_[2] ^= s_[0];
+        s_[3] ^= s_[1];
+        s_[1] ^= s_[2];
+        s_[0] ^= s_[3];
+        s_[2] ^= t;
+        s_[3] = rotl(s_[3], 45);
+        return(result);
+    }
+    // top 53 bits, centered so the result is in the open interval (0,1)
+    inline double random0to1() {
+        return(((random() >> 11) + 0.5)*(1.0/9007199254740992.0));
+    }
+    inline unsigned char randomchar() {
+        return('A'+random()%26);
+    }
+    inline void fill(double *out, size_t n) {
+        for (size_t i=0; i<n; ++i)
+        {
+            out[i] = random0to1();
+        }
+    }
+
+    // skip ahead n values in O(log n)
+    void jump(uint64_t n);
+
+    // substreams are 2**128 values apart. stream i starts where
+    // this generator would be after i*2**128 values.
+    void jumpSubstreams(uint64_t i);
+    Xoshiro256 substream(uint64_t i) const;
+    std::vector<Xoshiro256> split(unsigned int k) const;
+
+protected:
+    // utilities
+    void applyPolynomial(const uint64_t poly[4]);
+    static inline uint64_t rotl(uint64_t x, int k) {
+        return((x << k) | (x >> (64 - k)));
+    }
+
+protected:
+    // data
+    uint64_t s_[4];
+};
+
+}
+
+#endif
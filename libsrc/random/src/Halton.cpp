@@ -0,0 +1,205 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// halton low-discrepancy sequence
+//
+// coordinate j of point n is the radical inverse of n in base p(j),
+// the j-th prime: with n = sum d(k) p**k, x = sum d(k) p**-(k+1).
+//
+// owen scrambling replaces digit k by pi(d(k)), where the
+// permutation pi depends on the node of the tree of digits, that is
+// on d(0),...,d(k-1). here pi is a random cyclic shift, taken from a
+// hash of the key, the depth k and the digits below it. the digits
+// past the last non-zero digit of n are scrambled as well; they are
+// independent and uniform, so they are replaced by one uniform
+// value hashed from the last node. a value costs one hash per digit
+// of n, about log(n)/log(p) of them.
+
+// headers
+#include "system/Debug.h"
+#include "hdr/Halton.h"
+#include "random/SplitMix64.h"
+
+namespace ombt {
+
+// points between substreams
+static const unsigned int HaltonSubstreamBits = 40;
+
+// the prime bases, built on first use
+class HaltonPrimes
+{
+public:
+    static const HaltonPrimes &tables() {
+        static const HaltonPrimes primes;
+        return(primes);
+    }
+
+    uint64_t operator[](unsigned int j) const {
+        return(p_[j]);
+    }
+
+protected:
+    HaltonPrimes();
+
+    // data
+    std::vector<uint64_t> p_;
+};
+
+HaltonPrimes::HaltonPrimes():
+    p_()
+{
+    // the 1111-th prime is 8933
+    const unsigned int limit = 9000;
+    std::vector<bool> composite(limit, false);
+    for (unsigned int n=2; n<limit && p_.size()<Halton::MaxDimensions; ++n)
+    {
+        if (composite[n]) continue;
+        p_.push_back(n);
+        for (unsigned int m=n*n; m<limit; m+=n) composite[m] = true;
+    }
+    MustBeTrue(p_.size() == Halton::MaxDimensions);
+}
+
+// splitmix64 finalizer
+static inline uint64_t
+haltonMix(uint64_t z)
+{
+    z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27))*0x94d049bb133111ebULL;
+    return(z ^ (z >> 31));
+}
+
+// ctors and dtor
+Halton::Halton():
+    dimensions_(1), scramble_(true), index_(0), coord_(0), seeds_(1, 0)
+{
+    setKey(0);
+}
+
+Halton::Halton(unsigned long newKey, unsigned int dimensions,
+               bool scramble):
+    dimensions_(dimensions), scramble_(scramble), index_(0), coord_(0),
+    seeds_()
+{
+    MustBeTrue(dimensions_ > 0 && dimensions_ <= MaxDimensions);
+    seeds_.resize(dimensions_, 0);
+    setKey(newKey);
+}
+
+Halton::Halton(const Halton &src):
+    dimensions_(src.dimensions_), scramble_(src.scramble_),
+    index_(src.index_), coord_(src.coord_), seeds_(src.seeds_)
+{
+}
+
+Halton::~Halton() { }
+
+// assignment
+Halton &
+Halton::operator=(const Halton &rhs)
+{
+    if (this != &rhs)
+    {
+        dimensions_ = rhs.dimensions_;
+        scramble_ = rhs.scramble_;
+        index_ = rhs.index_;
+        coord_ = rhs.coord_;
+        seeds_ = rhs.seeds_;
+    }
+    return(*this);
+}
+
+// operations
+void
+Halton::setKey(unsigned long newKey)
+{
+    HaltonPrimes::tables();
+    SplitMix64 sm(newKey);
+    for (unsigned int j=0; j<dimensions_; ++j)
+    {
+        seeds_[j] = sm.next();
+    }
+    index_ = 0;
+    coord_ = 0;
+}
+
+// scrambled radical inverse
+uint64_t
+Halton::value(uint64_t point, unsigned int coord) const
+{
+    const uint64_t base = HaltonPrimes::tables()[coord];
+    const uint64_t seed = seeds_[coord];
+    const double inverse = 1.0/base;
+
+    double x = 0.0;
+    double weight = inverse;
+    uint64_t prefix = 0;
+    uint64_t scale = 1;
+    uint64_t depth = 0;
+    for ( ; point>0; ++depth)
+    {
+        uint64_t digit = point%base;
+        point /= base;
+        uint64_t scrambled = digit;
+        if (scramble_)
+        {
+            uint64_t shift = haltonMix(haltonMix(seed+depth) ^ prefix);
+            scrambled = (digit + shift%base)%base;
+        }
+        x += scrambled*weight;
+        weight *= inverse;
+        prefix += digit*scale;
+        scale *= base;
+    }
+    if (scramble_)
+    {
+        // the rest of the digits, one node deeper
+        uint64_t tail = haltonMix(haltonMix(seed+depth) ^ prefix);
+        x += weight*base*((tail >> 11)*(1.0/9007199254740992.0));
+    }
+
+    // to a 64-bit fraction, 53 bits of it significant
+    uint64_t top = uint64_t(x*9007199254740992.0);
+    if (top > 9007199254740991ULL) top = 9007199254740991ULL;
+    return(top << 11);
+}
+
+// jumps
+void
+Halton::jump(uint64_t n)
+{
+    unsigned __int128 value =
+        (unsigned __int128)index_*dimensions_ + coord_ + n;
+    index_ = uint64_t(value/dimensions_);
+    coord_ = unsigned(value%dimensions_);
+}
+
+void
+Halton::jumpSubstreams(uint64_t i)
+{
+    index_ += i << HaltonSubstreamBits;
+}
+
+Halton
+Halton::substream(uint64_t i) const
+{
+    Halton stream(*this);
+    stream.jumpSubstreams(i);
+    return(stream);
+}
+
+std::vector<Halton>
+Halton::split(unsigned int k) const
+{
+    std::vector<Halton> streams;
+    streams.reserve(k);
+    for (unsigned int i=0; i<k; ++i)
+    {
+        streams.push_back(substream(i));
+    }
+    return(streams);
+}
+
+}
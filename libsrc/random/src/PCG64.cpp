@@ -0,0 +1,124 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// pcg64 pseudo-random number generator
+//
+// seeding follows pcg_setseq_128_srandom_r(): the stream selects
+// the (odd) increment, the key is added to the state between two
+// steps, so a (key, stream) pair gives the same sequence as the
+// reference implementation.
+//
+// jumping ahead uses the usual lcg trick (brown, 1994). n steps of
+// x -> a*x+c is again an affine map x -> A*x+C, and (A,C) for n is
+// built from the squares of (a,c) in O(log n) multiplies.
+
+// headers
+#include "hdr/PCG64.h"
+
+namespace ombt {
+
+// ctors and dtor
+PCG64::PCG64()
+{
+    setKey(0, 0);
+}
+
+PCG64::PCG64(unsigned long newKey, unsigned long stream)
+{
+    setKey(newKey, stream);
+}
+
+PCG64::PCG64(const PCG64 &src):
+    state_(src.state_), inc_(src.inc_)
+{
+    // nothing to do
+}
+
+PCG64::~PCG64() { }
+
+// assignment
+PCG64 &
+PCG64::operator=(const PCG64 &rhs)
+{
+    if (this != &rhs)
+    {
+        state_ = rhs.state_;
+        inc_ = rhs.inc_;
+    }
+    return(*this);
+}
+
+// operations
+void
+PCG64::setKey(unsigned long newKey)
+{
+    setKey(newKey, 0);
+}
+
+void
+PCG64::setKey(unsigned long newKey, unsigned long stream)
+{
+    state_ = 0;
+    inc_ = (uint128(stream) << 1) | 1;
+    random();
+    state_ += newKey;
+    random();
+}
+
+// jumps
+void
+PCG64::advance(uint128 delta)
+{
+    uint128 curmult = multiplier();
+    uint128 curplus = inc_;
+    uint128 accmult = 1;
+    uint128 accplus = 0;
+    while (delta > 0)
+    {
+        if (delta & 1)
+        {
+            accmult *= curmult;
+            accplus = accplus*curmult + curplus;
+        }
+        curplus = (curmult + 1)*curplus;
+        curmult *= curmult;
+        delta >>= 1;
+    }
+    state_ = accmult*state_ + accplus;
+}
+
+void
+PCG64::jump(uint64_t n)
+{
+    advance(uint128(n));
+}
+
+void
+PCG64::jumpSubstreams(uint64_t i)
+{
+    advance(uint128(i) << 64);
+}
+
+PCG64
+PCG64::substream(uint64_t i) const
+{
+    PCG64 stream(*this);
+    stream.jumpSubstreams(i);
+    return(stream);
+}
+
+std::vector<PCG64>
+PCG64::split(unsigned int k) const
+{
+    std::vector<PCG64> streams;
+    streams.reserve(k);
+    for (unsigned int i=0; i<k; ++i)
+    {
+        streams.push_back(substream(i));
+    }
+    return(streams);
+}
+
+}
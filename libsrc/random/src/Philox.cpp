@@ -0,0 +1,198 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// philox4x64-10 counter-based random number generator
+//
+// round function, with (hi,lo) = 128-bit product:
+//
+// (hi0,lo0) = M0*c0, (hi1,lo1) = M1*c2
+// c = (hi1^c1^k0, lo1, hi0^c3^k1, lo0)
+//
+// the key is bumped by the weyl constants W0, W1 between rounds.
+// the key is taken from the user key, the stream goes into the
+// top word of the counter, so different streams never overlap.
+//
+// the generator is at value 4*(counter-1)+index of its stream, so
+// jumping ahead is an add on the 192-bit counter in the low three
+// words, and the block holding the new position is regenerated.
+
+// headers
+#include "hdr/Philox.h"
+
+namespace ombt {
+
+// philox constants
+static const uint64_t PhiloxM0 = 0xD2E7470EE14C6C93ULL;
+static const uint64_t PhiloxM1 = 0xCA5A826395121157ULL;
+static const uint64_t PhiloxW0 = 0x9E3779B97F4A7C15ULL;
+static const uint64_t PhiloxW1 = 0xBB67AE8584CAA73BULL;
+static const int PhiloxRounds = 10;
+
+// ctors and dtor
+Philox::Philox()
+{
+    setKey(0, 0);
+}
+
+Philox::Philox(unsigned long newKey, unsigned long stream)
+{
+    setKey(newKey, stream);
+}
+
+Philox::Philox(const Philox &src):
+    index_(src.index_)
+{
+    key_[0] = src.key_[0];
+    key_[1] = src.key_[1];
+    for (int i=0; i<4; ++i)
+    {
+        counter_[i] = src.counter_[i];
+        output_[i] = src.output_[i];
+    }
+}
+
+Philox::~Philox() { }
+
+// assignment
+Philox &
+Philox::operator=(const Philox &rhs)
+{
+    if (this != &rhs)
+    {
+        key_[0] = rhs.key_[0];
+        key_[1] = rhs.key_[1];
+        for (int i=0; i<4; ++i)
+        {
+            counter_[i] = rhs.counter_[i];
+            output_[i] = rhs.output_[i];
+        }
+        index_ = rhs.index_;
+    }
+    return(*this);
+}
+
+// operations
+void
+Philox::setKey(unsigned long newKey)
+{
+    setKey(newKey, 0);
+}
+
+void
+Philox::setKey(unsigned long newKey, unsigned long stream)
+{
+    key_[0] = newKey;
+    key_[1] = 0;
+    counter_[0] = counter_[1] = counter_[2] = 0;
+    counter_[3] = stream;
+    output_[0] = output_[1] = output_[2] = output_[3] = 0;
+    index_ = 4;
+}
+
+void
+Philox::block(const uint64_t counter[4], 
+              const uint64_t key[2], uint64_t output[4])
+{
+    uint64_t c0 = counter[0];
+    uint64_t c1 = counter[1];
+    uint64_t c2 = counter[2];
+    uint64_t c3 = counter[3];
+    uint64_t k0 = key[0];
+    uint64_t k1 = key[1];
+
+    for (int round=0; round<PhiloxRounds; ++round)
+    {
+        if (round > 0)
+        {
+            k0 += PhiloxW0;
+            k1 += PhiloxW1;
+        }
+        unsigned __int128 p0 = (unsigned __int128)PhiloxM0*c0;
+        unsigned __int128 p1 = (unsigned __int128)PhiloxM1*c2;
+        uint64_t hi0 = uint64_t(p0 >> 64);
+        uint64_t lo0 = uint64_t(p0);
+        uint64_t hi1 = uint64_t(p1 >> 64);
+        uint64_t lo1 = uint64_t(p1);
+        c0 = hi1^c1^k0;
+        c1 = lo1;
+        c2 = hi0^c3^k1;
+        c3 = lo0;
+    }
+
+    output[0] = c0;
+    output[1] = c1;
+    output[2] = c2;
+    output[3] = c3;
+}
+
+void
+Philox::generate()
+{
+    block(counter_, key_, output_);
+    if (++counter_[0] == 0)
+        if (++counter_[1] == 0)
+            ++counter_[2];
+}
+
+// jumps
+void
+Philox::seek(uint128 blocks, unsigned int index)
+{
+    // the current block is counter-1 if the outputs are current
+    uint128 lo = (uint128(counter_[1]) << 64) | counter_[0];
+    uint64_t hi = counter_[2];
+    if (index_ < 4)
+    {
+        if (lo-- == 0) --hi;
+    }
+
+    uint128 newlo = lo + blocks;
+    if (newlo < lo) ++hi;
+
+    counter_[0] = uint64_t(newlo);
+    counter_[1] = uint64_t(newlo >> 64);
+    counter_[2] = hi;
+    index_ = 4;
+    if (index > 0)
+    {
+        generate();
+        index_ = index;
+    }
+}
+
+void
+Philox::jump(uint64_t n)
+{
+    uint128 pos = uint128(index_ < 4 ? index_ : 0) + n;
+    seek(pos >> 2, (unsigned int)(pos & 3));
+}
+
+void
+Philox::jumpSubstreams(uint64_t i)
+{
+    seek(uint128(i) << 64, index_ < 4 ? index_ : 0);
+}
+
+Philox
+Philox::substream(uint64_t i) const
+{
+    Philox stream(*this);
+    stream.jumpSubstreams(i);
+    return(stream);
+}
+
+std::vector<Philox>
+Philox::split(unsigned int k) const
+{
+    std::vector<Philox> streams;
+    streams.reserve(k);
+    for (unsigned int i=0; i<k; ++i)
+    {
+        streams.push_back(substream(i));
+    }
+    return(streams);
+}
+
+}
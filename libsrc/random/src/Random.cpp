@@ -4,58 +4,339 @@
 // Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
 //
 // simple pseudo-random number generator
+//
+// the default engine is the original lcg, Ikey = (a*Ikey+c)%m.
+// the other engines (xoshiro256**, pcg64, philox4x64-10) avoid the
+// division and have much better statistical quality. the engine
+// is chosen when the object is built, so each distribution gets
+// whichever engine is in the Random it is given.
+//
+// jumping the lcg. n steps of x -> a*x+c is the affine map 
+// x -> A*x+C, with (A,C) built from squares of (a,c) in O(log n)
+// multiplies. the step is computed in 64 bits before the %m, so
+// it is an exact lcg mod m only if a*(m-1)+c does not overflow.
+// the default m = 2**64-1 does overflow, but then the step is the
+// lcg mod 2**64 followed by %m, which only differs from it when
+// a*x+c is exactly 2**64-1 mod 2**64. any other overflowing m is 
+// stepped one value at a time.
+//
+// the old free functions and the default ctor used file-static
+// globals, a data race once several threads draw values. they now
+// use a thread_local generator, keyed from a master key and the
+// thread's stream number.
 
 // headers
 #include "hdr/Random.h"
+#include "random/SplitMix64.h"
+
+// lcg stride between substreams
+static const uint64_t LCGSubstreamStride = 1ULL << 40;
+
+// old version, parameters of the default generator
+static const unsigned long oldm = 121500;
+static const unsigned long olda = 2041;
+static const unsigned long oldc = 25673;
+static const unsigned long oldIkey = 71551;
+
+// per-thread state
+static unsigned long masterKey = oldIkey;
+static unsigned long nextStream = 0;
+
+static unsigned long
+streamKey(unsigned long master, unsigned long stream)
+{
+    if (stream == 0) return(master);
+    ombt::SplitMix64 sm(master+stream);
+    return(sm.next()%oldm);
+}
+
+struct ThreadRandom {
+    ThreadRandom(): 
+        stream_(__sync_fetch_and_add(&nextStream, 1)),
+        random_(streamKey(masterKey, stream_), oldm, olda, oldc) { }
 
-// old version 
-static unsigned long oldm = 121500;
-static unsigned long olda = 2041;
-static unsigned long oldc = 25673;
-static unsigned long oldIkey = 71551;
+    unsigned long stream_;
+    ombt::Random random_;
+};
+
+static thread_local ThreadRandom threadRandom_;
 
 void
 setKey(unsigned long newKey)
 {
-	oldIkey = newKey;
+	threadRandom_.random_.setKey(newKey);
 	return;
 }
 
 unsigned long
 myrandom()
 {
-	oldIkey = (olda*oldIkey+oldc)%oldm;
-	return(oldIkey);
+	return(threadRandom_.random_.random());
 }
 
 unsigned char
 myrandomchar()
 {
-	oldIkey = (olda*oldIkey+oldc)%oldm;
-	return('A'+oldIkey%26);
+	return(threadRandom_.random_.randomchar());
 }
 
 namespace ombt {
 
+// per-thread default generator
+void
+setMasterKey(unsigned long newKey)
+{
+    masterKey = newKey;
+    threadRandom_.random_.setKey(streamKey(masterKey, threadRandom_.stream_));
+}
+
+unsigned long
+getMasterKey()
+{
+    return(masterKey);
+}
+
+void
+setThreadStream(unsigned long stream)
+{
+    threadRandom_.stream_ = stream;
+    threadRandom_.random_.setKey(streamKey(masterKey, stream));
+}
+
+unsigned long
+getThreadStream()
+{
+    return(threadRandom_.stream_);
+}
+
+Random &
+threadRandom()
+{
+    return(threadRandom_.random_);
+}
+
+// affine map arithmetic mod m, m = 0 means mod 2**64
+static inline uint64_t
+lcgMul(uint64_t x, uint64_t y, uint64_t m)
+{
+    if (m == 0) return(x*y);
+    return(uint64_t((unsigned __int128)x*y % m));
+}
+
+static inline uint64_t
+lcgAdd(uint64_t x, uint64_t y, uint64_t m)
+{
+    if (m == 0) return(x+y);
+    return(uint64_t(((unsigned __int128)x+y) % m));
+}
+
+// (A,C) = (a,c)**n
+static void
+lcgPower(uint64_t a, uint64_t c, uint64_t m, uint64_t n, 
+         uint64_t &A, uint64_t &C)
+{
+    A = 1;
+    C = 0;
+    while (n > 0)
+    {
+        if (n & 1)
+        {
+            A = lcgMul(a, A, m);
+            C = lcgAdd(lcgMul(a, C, m), c, m);
+        }
+        c = lcgAdd(lcgMul(a, c, m), c, m);
+        a = lcgMul(a, a, m);
+        n >>= 1;
+    }
+}
+
 // ctors and dtor
 Random::Random(): 
-    BaseObject(true), 
-    m_(::oldm), a_(::olda), c_(::oldc), Ikey_(::oldIkey) { }
+    BaseObject(true), engine_(LCGEngine),
+    m_(::oldm), a_(::olda), c_(::oldc), 
+    Ikey_(threadRandom_.random_.Ikey_),
+    xoshiro_(), pcg_(), philox_() { }
 Random::Random(unsigned long newKey, 
     unsigned long m, unsigned long a, unsigned long c):
-    BaseObject(true), 
-    m_(m), a_(a), c_(c), Ikey_(newKey) { }
+    BaseObject(true), engine_(LCGEngine),
+    m_(m), a_(a), c_(c), Ikey_(newKey),
+    xoshiro_(), pcg_(), philox_() { }
+Random::Random(EngineType engine, unsigned long newKey):
+    BaseObject(true), engine_(engine),
+    m_((unsigned long)(-1)), a_(663608941), c_(0), Ikey_(newKey),
+    xoshiro_(), pcg_(), philox_()
+{
+    setKey(newKey);
+}
+Random::Random(const Random &src):
+    BaseObject(src), engine_(src.engine_),
+    m_(src.m_), a_(src.a_), c_(src.c_), Ikey_(src.Ikey_),
+    xoshiro_(src.xoshiro_), pcg_(src.pcg_), philox_(src.philox_) { }
 Random::~Random() { }
 
+// assignment
+Random &
+Random::operator=(const Random &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        engine_ = rhs.engine_;
+        m_ = rhs.m_;
+        a_ = rhs.a_;
+        c_ = rhs.c_;
+        Ikey_ = rhs.Ikey_;
+        xoshiro_ = rhs.xoshiro_;
+        pcg_ = rhs.pcg_;
+        philox_ = rhs.philox_;
+    }
+    return(*this);
+}
+
 // operations
 void Random::setKey(unsigned long newKey)
-	{ Ikey_ = newKey; }
-unsigned long Random::random() 
-	{ Ikey_ = (a_*Ikey_+c_)%m_; return(Ikey_); }
-double Random::random0to1() 
-	{ Ikey_ = (a_*Ikey_+c_)%m_; return(double(Ikey_)/double(m_)); }
-unsigned char Random::randomchar() 
-	{ Ikey_ = (a_*Ikey_+c_)%m_; return('A'+Ikey_%26); }
+{
+    switch (engine_)
+    {
+    case XoshiroEngine:
+        xoshiro_.setKey(newKey);
+        break;
+    case PCGEngine:
+        pcg_.setKey(newKey);
+        break;
+    case PhiloxEngine:
+        philox_.setKey(newKey);
+        break;
+    case LCGEngine:
+    default:
+        Ikey_ = newKey;
+        break;
+    }
+}
+
+// the engine is chosen once per call, not once per value
+void Random::fill(double *out, size_t n)
+{
+    switch (engine_)
+    {
+    case XoshiroEngine:
+        xoshiro_.fill(out, n);
+        break;
+    case PCGEngine:
+        pcg_.fill(out, n);
+        break;
+    case PhiloxEngine:
+        philox_.fill(out, n);
+        break;
+    case LCGEngine:
+    default:
+        for (size_t i=0; i<n; ++i)
+        {
+            Ikey_ = (a_*Ikey_+c_)%m_; 
+            out[i] = double(Ikey_)/double(m_);
+        }
+        break;
+    }
+}
+
+// jumps. the lcg is moved ahead n values, times times over.
+void Random::jumpLCG(uint64_t n, uint64_t times)
+{
+    if (n == 0 || times == 0) return;
+
+    uint64_t m = m_;
+    uint64_t A, C;
+    if (m > 1 && a_ <= (uint64_t(-1)-c_)/(m-1))
+    {
+        // exact lcg mod m once the key is below m
+        if (Ikey_ >= m_)
+        {
+            Ikey_ = (a_*Ikey_+c_)%m_; 
+            if (times > 1) jumpLCG(n, times-1);
+            jumpLCG(n-1);
+            return;
+        }
+        lcgPower(a_%m, c_%m, m, n, A, C);
+        lcgPower(A, C, m, times, A, C);
+        Ikey_ = lcgAdd(lcgMul(A, Ikey_, m), C, m);
+    }
+    else if (m == uint64_t(-1))
+    {
+        // lcg mod 2**64, then the final %m
+        lcgPower(a_, c_, 0, n, A, C);
+        lcgPower(A, C, 0, times, A, C);
+        Ikey_ = (A*Ikey_+C)%m_;
+    }
+    else
+    {
+        for ( ; times>0; --times)
+        {
+            for (uint64_t i=0; i<n; ++i)
+            {
+                Ikey_ = (a_*Ikey_+c_)%m_; 
+            }
+        }
+    }
+}
+
+void Random::jump(uint64_t n)
+{
+    switch (engine_)
+    {
+    case XoshiroEngine:
+        xoshiro_.jump(n);
+        break;
+    case PCGEngine:
+        pcg_.jump(n);
+        break;
+    case PhiloxEngine:
+        philox_.jump(n);
+        break;
+    case LCGEngine:
+    default:
+        jumpLCG(n);
+        break;
+    }
+}
 
+void Random::jumpSubstreams(uint64_t i)
+{
+    switch (engine_)
+    {
+    case XoshiroEngine:
+        xoshiro_.jumpSubstreams(i);
+        break;
+    case PCGEngine:
+        pcg_.jumpSubstreams(i);
+        break;
+    case PhiloxEngine:
+        philox_.jumpSubstreams(i);
+        break;
+    case LCGEngine:
+    default:
+        jumpLCG(LCGSubstreamStride, i);
+        break;
+    }
+}
+
+Random
+Random::substream(uint64_t i) const
+{
+    Random stream(*this);
+    stream.jumpSubstreams(i);
+    return(stream);
 }
 
+std::vector<Random>
+Random::split(unsigned int k) const
+{
+    std::vector<Random> streams;
+    streams.reserve(k);
+    for (unsigned int i=0; i<k; ++i)
+    {
+        streams.push_back(substream(i));
+    }
+    return(streams);
+}
+
+}
@@ -0,0 +1,1412 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// sobol low-discrepancy sequence
+//
+// coordinate j of point n is the xor of the direction numbers
+// v(j,k) for the bits k set in n, with 64-bit direction numbers
+// so 2**64 points are available. in gray code order, g(n) = n^(n>>1),
+// consecutive points differ in one bit of g(n), so each point is
+// one xor per coordinate from the last. gray code order permutes
+// the points inside every run of 2**k, so the net property of the
+// runs is the same.
+//
+// dimension 0 is the van der corput sequence. dimension j > 0 uses
+// the j-th primitive polynomial over GF(2),
+//
+//	x**s + a(1) x**(s-1) + ... + a(s-1) x + 1,
+//
+// ordered by degree s, then by a = a(1)...a(s-1) as a binary
+// number, found by testing that x has order 2**s-1. with
+// m(1),...,m(s) the initial odd direction integers, m(i) < 2**i,
+//
+//	v(k) = m(k)/2**k                                       k <= s
+//	v(k) = a(1) v(k-1) ^ ... ^ a(s-1) v(k-s+1) ^ v(k-s) ^
+//	       v(k-s)/2**s                                     k > s
+//
+// the initial direction integers of dimensions 1 to 20 are from
+// joe and kuo, "constructing sobol sequences with better
+// two-dimensional projections", 2008. those of the higher dimensions
+// were found the same way, with a cruder search: dimension by
+// dimension, the best of 24 random candidates, by the largest, then
+// the total, t-value of the two-dimensional projections on every
+// lower dimension for the first 2**6, 2**9 and 2**12 points. the
+// largest t-value of any pair at 2**12 points is 5 below dimension
+// 21, 7 below 101, 8 below 201 and 10 below 1111.
+
+// headers
+#include "system/Debug.h"
+#include "hdr/Sobol.h"
+#include "random/SplitMix64.h"
+
+namespace ombt {
+
+// points between substreams
+static const unsigned int SobolSubstreamBits = 40;
+
+// initial direction integers m(1),...,m(s) of dimensions 1 and up,
+// one line per dimension
+static const unsigned short SobolInitial[] = {
+    1,
+    1, 3,
+    1, 3, 1,
+    1, 1, 1,
+    1, 1, 3, 3,
+    1, 3, 5, 13,
+    1, 1, 5, 5, 17,
+    1, 1, 5, 5, 5,
+    1, 1, 7, 11, 19,
+    1, 1, 5, 1, 1,
+    1, 1, 1, 3, 11,
+    1, 3, 5, 5, 31,
+    1, 3, 3, 9, 7, 49,
+    1, 1, 1, 15, 21, 21,
+    1, 3, 1, 13, 27, 49,
+    1, 1, 1, 15, 7, 5,
+    1, 3, 1, 15, 13, 25,
+    1, 1, 5, 5, 19, 61,
+    1, 3, 7, 11, 23, 15, 103,
+    1, 3, 7, 13, 13, 15, 69,
+    1, 3, 3, 15, 7, 23, 107,
+    1, 1, 3, 13, 27, 17, 11,
+    1, 1, 7, 15, 9, 33, 57,
+    1, 1, 3, 15, 15, 63, 103,
+    1, 3, 7, 1, 25, 63, 29,
+    1, 3, 3, 13, 17, 21, 103,
+    1, 1, 1, 9, 21, 57, 41,
+    1, 3, 3, 11, 9, 43, 123,
+    1, 3, 1, 3, 21, 17, 17,
+    1, 1, 1, 13, 5, 23, 107,
+    1, 3, 5, 1, 7, 45, 39,
+    1, 1, 3, 15, 23, 43, 111,
+    1, 3, 1, 15, 29, 33, 71,
+    1, 3, 5, 9, 31, 61, 27,
+    1, 1, 5, 9, 21, 63, 49,
+    1, 1, 3, 15, 11, 29, 15,
+    1, 3, 7, 15, 29, 43, 115, 135,
+    1, 1, 1, 11, 5, 55, 7, 191,
+    1, 1, 7, 5, 17, 63, 23, 241,
+    1, 1, 3, 15, 23, 1, 83, 133,
+    1, 1, 5, 9, 31, 45, 7, 141,
+    1, 3, 5, 13, 13, 11, 105, 209,
+    1, 1, 3, 5, 13, 13, 9, 117,
+    1, 1, 7, 1, 7, 7, 35, 23,
+    1, 3, 5, 3, 15, 25, 49, 93,
+    1, 1, 5, 3, 3, 13, 57, 7,
+    1, 3, 7, 5, 21, 1, 35, 221,
+    1, 3, 3, 7, 9, 7, 11, 141,
+    1, 1, 1, 9, 13, 49, 1, 77,
+    1, 1, 7, 3, 9, 27, 37, 209,
+    1, 1, 1, 7, 23, 7, 69, 49,
+    1, 1, 7, 9, 1, 59, 97, 61,
+    1, 1, 5, 15, 23, 63, 1, 107, 75,
+    1, 1, 7, 13, 21, 61, 95, 161, 389,
+    1, 3, 3, 1, 7, 45, 91, 159, 71,
+    1, 3, 7, 7, 15, 35, 119, 187, 315,
+    1, 3, 5, 15, 9, 39, 65, 201, 267,
+    1, 3, 5, 5, 15, 61, 19, 19, 317,
+    1, 1, 7, 11, 21, 31, 69, 1, 409,
+    1, 3, 5, 11, 27, 57, 47, 101, 49,
+    1, 3, 7, 15, 13, 45, 53, 81, 279,
+    1, 1, 5, 3, 13, 29, 127, 195, 195,
+    1, 3, 5, 7, 9, 3, 15, 41, 253,
+    1, 3, 5, 1, 7, 1, 73, 253, 179,
+    1, 1, 5, 11, 9, 1, 95, 103, 479,
+    1, 1, 3, 5, 29, 53, 103, 221, 41,
+    1, 1, 5, 13, 15, 31, 63, 217, 169,
+    1, 1, 7, 15, 25, 31, 75, 191, 511,
+    1, 1, 3, 1, 17, 57, 77, 117, 253,
+    1, 1, 1, 15, 9, 37, 67, 183, 381,
+    1, 3, 5, 9, 31, 61, 47, 73, 485,
+    1, 1, 3, 1, 15, 51, 13, 199, 161,
+    1, 3, 1, 9, 13, 1, 127, 73, 415,
+    1, 1, 7, 7, 13, 61, 107, 15, 119,
+    1, 3, 7, 3, 3, 61, 107, 171, 227,
+    1, 1, 3, 13, 17, 49, 55, 57, 137,
+    1, 3, 7, 11, 13, 55, 123, 115, 477,
+    1, 1, 7, 1, 31, 59, 101, 127, 83,
+    1, 3, 5, 15, 25, 15, 57, 139, 213,
+    1, 1, 7, 3, 23, 1, 93, 145, 235,
+    1, 3, 3, 1, 27, 45, 13, 117, 395,
+    1, 3, 3, 13, 1, 13, 127, 77, 179,
+    1, 1, 7, 1, 15, 41, 43, 53, 487,
+    1, 1, 1, 15, 29, 37, 123, 77, 421,
+    1, 3, 1, 15, 21, 7, 55, 105, 399,
+    1, 3, 7, 15, 17, 43, 101, 41, 323,
+    1, 3, 7, 5, 7, 51, 3, 155, 493,
+    1, 3, 5, 13, 31, 57, 31, 145, 61,
+    1, 1, 3, 7, 9, 33, 51, 103, 215,
+    1, 3, 7, 11, 23, 15, 7, 145, 425,
+    1, 3, 3, 13, 25, 33, 105, 105, 365,
+    1, 3, 3, 11, 29, 51, 37, 51, 299,
+    1, 1, 1, 1, 5, 41, 65, 227, 3,
+    1, 1, 7, 1, 23, 23, 123, 77, 361,
+    1, 3, 5, 5, 9, 1, 97, 29, 1,
+    1, 1, 5, 15, 7, 63, 77, 253, 139,
+    1, 3, 7, 7, 5, 29, 5, 135, 1,
+    1, 3, 1, 9, 5, 49, 55, 89, 59,
+    1, 3, 5, 11, 11, 13, 19, 51, 407,
+    1, 1, 7, 5, 7, 43, 91, 151, 243,
+    1, 3, 3, 1, 19, 11, 39, 235, 83, 381,
+    1, 1, 5, 15, 1, 47, 39, 73, 117, 299,
+    1, 3, 5, 11, 15, 13, 75, 195, 175, 315,
+    1, 3, 5, 13, 9, 53, 7, 209, 111, 787,
+    1, 3, 3, 7, 15, 5, 65, 237, 499, 845,
+    1, 1, 1, 5, 7, 37, 45, 227, 297, 117,
+    1, 3, 7, 3, 25, 33, 35, 35, 71, 419,
+    1, 1, 1, 9, 19, 11, 41, 21, 385, 893,
+    1, 1, 7, 1, 21, 13, 127, 179, 411, 467,
+    1, 1, 1, 3, 17, 49, 59, 153, 311, 127,
+    1, 1, 5, 15, 13, 3, 89, 233, 479, 895,
+    1, 1, 7, 7, 17, 63, 105, 3, 267, 903,
+    1, 1, 7, 1, 7, 5, 119, 187, 467, 917,
+    1, 1, 3, 3, 3, 11, 61, 163, 221, 691,
+    1, 1, 3, 13, 5, 55, 21, 183, 235, 663,
+    1, 1, 7, 15, 9, 49, 103, 29, 507, 663,
+    1, 1, 1, 13, 9, 27, 33, 215, 245, 915,
+    1, 3, 7, 1, 21, 63, 47, 15, 335, 261,
+    1, 1, 3, 13, 9, 51, 127, 219, 101, 135,
+    1, 3, 1, 1, 7, 55, 79, 167, 309, 667,
+    1, 1, 3, 5, 5, 15, 109, 1, 151, 887,
+    1, 3, 3, 3, 15, 19, 33, 21, 57, 707,
+    1, 1, 1, 7, 11, 29, 49, 159, 421, 45,
+    1, 1, 7, 1, 23, 15, 53, 237, 255, 933,
+    1, 1, 7, 13, 21, 1, 15, 209, 167, 397,
+    1, 1, 3, 7, 9, 3, 125, 95, 473, 621,
+    1, 3, 5, 13, 7, 3, 37, 41, 115, 755,
+    1, 3, 1, 13, 1, 43, 45, 173, 147, 689,
+    1, 3, 7, 5, 29, 49, 115, 147, 115, 719,
+    1, 3, 1, 9, 25, 57, 53, 25, 273, 103,
+    1, 3, 1, 11, 17, 55, 93, 255, 455, 457,
+    1, 1, 5, 11, 3, 31, 85, 193, 311, 513,
+    1, 1, 7, 15, 25, 55, 79, 171, 389, 561,
+    1, 1, 3, 11, 25, 29, 75, 29, 209, 821,
+    1, 1, 3, 13, 5, 13, 51, 237, 337, 475,
+    1, 3, 1, 15, 23, 53, 51, 219, 13, 759,
+    1, 1, 1, 5, 19, 47, 57, 77, 181, 929,
+    1, 1, 3, 13, 31, 35, 57, 183, 405, 1023,
+    1, 3, 7, 7, 29, 33, 89, 75, 391, 199,
+    1, 3, 7, 5, 31, 3, 79, 93, 351, 745,
+    1, 1, 5, 15, 5, 39, 71, 201, 481, 747,
+    1, 1, 5, 15, 31, 53, 113, 241, 253, 987,
+    1, 1, 3, 1, 5, 13, 69, 59, 65, 657,
+    1, 1, 7, 11, 31, 33, 5, 133, 465, 1019,
+    1, 1, 1, 1, 21, 1, 39, 175, 97, 593,
+    1, 3, 5, 11, 9, 17, 67, 51, 179, 73,
+    1, 1, 3, 11, 3, 61, 105, 49, 449, 781,
+    1, 3, 1, 15, 9, 7, 127, 71, 337, 721,
+    1, 3, 7, 3, 31, 11, 77, 229, 323, 909,
+    1, 1, 3, 9, 29, 45, 121, 15, 455, 725,
+    1, 3, 1, 13, 3, 41, 119, 195, 133, 301,
+    1, 1, 5, 1, 19, 49, 29, 19, 251, 23,
+    1, 1, 1, 9, 15, 3, 67, 233, 83, 141,
+    1, 3, 5, 7, 3, 1, 95, 213, 47, 89,
+    1, 3, 3, 5, 15, 39, 75, 121, 317, 703,
+    1, 3, 7, 1, 23, 29, 13, 5, 179, 861,
+    1, 3, 1, 1, 15, 23, 127, 53, 311, 615,
+    1, 3, 7, 5, 5, 55, 69, 105, 51, 441,
+    1, 1, 7, 9, 13, 63, 61, 191, 443, 173,
+    1, 3, 1, 9, 3, 29, 45, 239, 389, 317,
+    1, 1, 5, 13, 5, 39, 87, 29, 165, 421, 1337,
+    1, 1, 1, 9, 15, 25, 55, 43, 183, 967, 47,
+    1, 3, 1, 15, 19, 35, 21, 111, 89, 961, 307,
+    1, 3, 5, 11, 31, 25, 113, 243, 273, 919, 91,
+    1, 1, 1, 9, 7, 59, 49, 91, 185, 785, 1607,
+    1, 1, 3, 5, 25, 53, 49, 45, 331, 817, 3,
+    1, 3, 3, 3, 27, 37, 85, 103, 377, 321, 1077,
+    1, 3, 1, 13, 25, 5, 3, 43, 3, 107, 41,
+    1, 3, 7, 5, 3, 5, 63, 183, 227, 329, 1687,
+    1, 3, 1, 1, 3, 31, 91, 95, 115, 957, 101,
+    1, 1, 5, 9, 27, 45, 91, 85, 463, 113, 1861,
+    1, 3, 3, 3, 3, 47, 123, 21, 79, 657, 843,
+    1, 3, 3, 9, 5, 49, 87, 55, 17, 581, 497,
+    1, 3, 5, 13, 23, 21, 115, 73, 205, 51, 735,
+    1, 1, 1, 9, 29, 19, 113, 197, 323, 353, 1605,
+    1, 3, 1, 13, 9, 49, 77, 201, 319, 1003, 631,
+    1, 1, 7, 15, 1, 17, 119, 71, 91, 621, 1873,
+    1, 3, 1, 5, 1, 61, 49, 39, 49, 869, 1601,
+    1, 1, 5, 5, 25, 39, 9, 75, 503, 603, 899,
+    1, 1, 5, 11, 27, 51, 67, 9, 387, 365, 669,
+    1, 3, 3, 7, 25, 51, 45, 215, 487, 501, 1631,
+    1, 3, 3, 11, 5, 19, 109, 135, 337, 827, 721,
+    1, 3, 1, 15, 23, 63, 123, 247, 159, 985, 759,
+    1, 3, 3, 3, 15, 25, 21, 203, 243, 981, 451,
+    1, 1, 5, 5, 5, 53, 21, 137, 329, 509, 139,
+    1, 1, 7, 7, 17, 59, 119, 141, 99, 243, 1165,
+    1, 3, 3, 1, 1, 21, 83, 47, 505, 309, 97,
+    1, 1, 5, 9, 9, 25, 65, 245, 283, 487, 1123,
+    1, 3, 3, 7, 27, 15, 117, 105, 45, 781, 1125,
+    1, 3, 1, 13, 19, 19, 33, 247, 259, 683, 827,
+    1, 1, 5, 15, 5, 23, 121, 213, 307, 237, 257,
+    1, 3, 5, 15, 21, 17, 55, 105, 127, 981, 1449,
+    1, 1, 1, 9, 27, 7, 17, 201, 279, 245, 415,
+    1, 1, 5, 1, 13, 35, 5, 115, 305, 491, 981,
+    1, 3, 3, 5, 3, 55, 99, 161, 97, 909, 823,
+    1, 3, 1, 7, 17, 45, 11, 37, 415, 109, 1689,
+    1, 1, 7, 13, 21, 31, 53, 205, 487, 463, 63,
+    1, 1, 5, 1, 29, 1, 115, 53, 19, 293, 505,
+    1, 3, 7, 13, 15, 21, 41, 233, 241, 191, 1557,
+    1, 1, 1, 3, 5, 57, 47, 27, 381, 633, 1755,
+    1, 1, 1, 13, 31, 29, 15, 107, 141, 649, 43,
+    1, 3, 5, 3, 7, 45, 111, 135, 205, 891, 1125,
+    1, 3, 1, 1, 23, 61, 45, 235, 209, 577, 473,
+    1, 1, 7, 13, 31, 29, 119, 165, 321, 401, 985,
+    1, 1, 7, 5, 1, 17, 119, 43, 63, 763, 671,
+    1, 1, 1, 9, 13, 37, 61, 163, 505, 271, 625,
+    1, 3, 5, 3, 31, 35, 75, 253, 149, 295, 125,
+    1, 1, 1, 3, 27, 45, 39, 85, 151, 459, 321,
+    1, 3, 7, 11, 25, 55, 93, 241, 429, 435, 967,
+    1, 1, 1, 1, 21, 7, 101, 161, 217, 621, 1679,
+    1, 1, 1, 11, 7, 45, 23, 151, 183, 347, 1245,
+    1, 1, 5, 11, 11, 23, 93, 61, 317, 829, 1287,
+    1, 3, 5, 1, 17, 57, 117, 179, 243, 95, 33,
+    1, 3, 5, 13, 11, 47, 125, 163, 397, 487, 943,
+    1, 1, 3, 7, 21, 5, 25, 111, 371, 745, 2027,
+    1, 3, 7, 13, 31, 53, 91, 201, 359, 603, 1761,
+    1, 3, 5, 11, 3, 9, 109, 21, 319, 433, 1501,
+    1, 3, 5, 13, 25, 61, 49, 183, 441, 583, 2009,
+    1, 1, 3, 7, 13, 61, 101, 163, 307, 983, 1813,
+    1, 3, 3, 13, 13, 61, 99, 175, 221, 165, 1343,
+    1, 3, 1, 7, 25, 1, 111, 37, 383, 819, 279,
+    1, 3, 5, 11, 27, 27, 111, 101, 3, 989, 531,
+    1, 1, 3, 9, 21, 59, 81, 193, 343, 707, 2039,
+    1, 3, 5, 15, 11, 41, 73, 203, 225, 467, 673,
+    1, 3, 5, 1, 27, 59, 45, 193, 133, 207, 1109,
+    1, 3, 3, 15, 13, 61, 53, 167, 447, 17, 1203,
+    1, 3, 5, 5, 25, 15, 127, 97, 109, 507, 1929,
+    1, 1, 3, 11, 31, 43, 87, 119, 161, 81, 607,
+    1, 1, 1, 13, 9, 5, 107, 171, 339, 141, 223,
+    1, 1, 3, 7, 27, 9, 83, 83, 379, 201, 89,
+    1, 1, 5, 9, 5, 49, 23, 21, 413, 971, 1063,
+    1, 1, 5, 1, 19, 45, 125, 93, 167, 147, 1419,
+    1, 3, 7, 15, 5, 45, 63, 219, 437, 725, 579,
+    1, 1, 7, 15, 9, 49, 79, 141, 9, 467, 1277,
+    1, 1, 3, 13, 3, 19, 39, 205, 97, 321, 1559,
+    1, 3, 3, 1, 17, 11, 59, 131, 427, 901, 2015,
+    1, 3, 1, 13, 9, 11, 75, 43, 243, 647, 349,
+    1, 3, 3, 9, 31, 47, 63, 131, 423, 551, 63,
+    1, 3, 7, 9, 11, 27, 33, 7, 245, 845, 1787,
+    1, 3, 3, 11, 15, 31, 83, 59, 403, 561, 1763,
+    1, 3, 3, 13, 7, 3, 15, 3, 441, 263, 1035,
+    1, 3, 1, 7, 1, 3, 99, 145, 237, 157, 769,
+    1, 3, 1, 9, 13, 21, 117, 163, 199, 289, 1589,
+    1, 3, 5, 13, 23, 19, 43, 141, 143, 687, 943,
+    1, 1, 7, 1, 3, 19, 33, 187, 289, 57, 1113,
+    1, 1, 5, 15, 5, 35, 33, 119, 465, 641, 875,
+    1, 1, 7, 11, 5, 63, 73, 79, 417, 1015, 1661,
+    1, 3, 7, 9, 13, 55, 9, 183, 355, 825, 441,
+    1, 3, 1, 11, 19, 53, 47, 213, 289, 267, 703,
+    1, 3, 7, 11, 23, 29, 107, 43, 455, 433, 9,
+    1, 1, 5, 15, 31, 61, 115, 179, 343, 571, 895,
+    1, 1, 3, 3, 3, 31, 89, 135, 295, 539, 687,
+    1, 3, 5, 1, 25, 19, 107, 251, 121, 551, 851,
+    1, 1, 1, 7, 15, 31, 55, 205, 345, 89, 1779,
+    1, 3, 5, 11, 17, 29, 107, 179, 357, 363, 1483,
+    1, 1, 5, 15, 11, 47, 3, 115, 113, 675, 125,
+    1, 1, 1, 15, 11, 27, 3, 227, 35, 179, 711,
+    1, 1, 5, 1, 27, 13, 119, 193, 325, 883, 973,
+    1, 3, 1, 9, 27, 51, 47, 29, 357, 347, 693,
+    1, 1, 3, 11, 31, 43, 1, 185, 279, 117, 1849,
+    1, 1, 1, 11, 11, 47, 45, 161, 449, 767, 1075,
+    1, 3, 1, 1, 13, 17, 79, 157, 95, 307, 85,
+    1, 3, 3, 3, 27, 9, 97, 41, 57, 333, 671,
+    1, 3, 3, 15, 9, 39, 83, 17, 393, 723, 1187,
+    1, 1, 3, 1, 15, 23, 121, 53, 457, 967, 1995,
+    1, 3, 7, 1, 13, 37, 33, 129, 109, 31, 1163,
+    1, 1, 7, 9, 19, 51, 31, 81, 473, 765, 1843,
+    1, 1, 7, 13, 23, 23, 97, 139, 175, 271, 521,
+    1, 3, 7, 3, 15, 3, 97, 121, 31, 661, 39,
+    1, 3, 1, 7, 5, 5, 19, 253, 289, 569, 1951,
+    1, 3, 7, 9, 3, 37, 103, 109, 47, 185, 1123,
+    1, 1, 5, 3, 31, 5, 75, 145, 119, 775, 1249,
+    1, 1, 7, 5, 29, 59, 95, 191, 37, 7, 863,
+    1, 3, 5, 7, 13, 61, 73, 121, 305, 409, 249,
+    1, 1, 1, 5, 23, 47, 127, 147, 189, 675, 1227,
+    1, 1, 5, 7, 7, 39, 117, 55, 23, 853, 1427,
+    1, 1, 1, 9, 1, 41, 107, 171, 87, 985, 1031,
+    1, 1, 3, 1, 3, 23, 109, 131, 97, 595, 1695,
+    1, 1, 1, 7, 13, 21, 113, 207, 115, 223, 1513,
+    1, 1, 3, 5, 27, 49, 91, 153, 447, 179, 451,
+    1, 3, 1, 1, 5, 11, 21, 23, 473, 95, 1117,
+    1, 3, 7, 15, 1, 37, 19, 179, 101, 177, 1499,
+    1, 1, 1, 15, 29, 15, 77, 9, 389, 163, 337,
+    1, 1, 1, 1, 11, 23, 1, 195, 411, 595, 61,
+    1, 1, 5, 15, 31, 33, 57, 221, 165, 721, 1579,
+    1, 3, 1, 3, 17, 29, 39, 21, 447, 961, 1711,
+    1, 1, 7, 1, 25, 41, 47, 63, 439, 925, 1489,
+    1, 3, 7, 5, 17, 43, 105, 199, 245, 891, 2025,
+    1, 3, 3, 3, 13, 57, 19, 41, 199, 939, 179,
+    1, 1, 7, 15, 15, 59, 61, 33, 459, 623, 1951,
+    1, 3, 3, 11, 7, 63, 127, 247, 501, 905, 1067,
+    1, 1, 3, 1, 5, 29, 3, 15, 509, 895, 1973,
+    1, 1, 7, 11, 29, 43, 35, 43, 391, 383, 173,
+    1, 1, 5, 5, 21, 53, 63, 155, 53, 247, 1497,
+    1, 3, 5, 15, 7, 7, 5, 211, 495, 487, 1877,
+    1, 3, 5, 13, 19, 61, 5, 163, 329, 325, 241,
+    1, 1, 1, 15, 27, 19, 53, 205, 423, 569, 1249,
+    1, 3, 7, 13, 15, 59, 107, 71, 57, 481, 1497,
+    1, 3, 5, 5, 19, 51, 73, 67, 203, 903, 895,
+    1, 1, 5, 9, 3, 35, 83, 87, 71, 423, 1211,
+    1, 1, 7, 9, 21, 61, 37, 241, 35, 23, 475,
+    1, 1, 5, 5, 5, 47, 1, 63, 77, 725, 643,
+    1, 1, 1, 3, 7, 57, 53, 209, 211, 443, 459,
+    1, 1, 3, 3, 17, 21, 67, 31, 211, 179, 1505,
+    1, 3, 1, 9, 23, 35, 57, 39, 77, 753, 529,
+    1, 1, 7, 3, 7, 37, 15, 185, 213, 83, 187,
+    1, 3, 7, 11, 27, 9, 25, 3, 113, 959, 495,
+    1, 3, 3, 3, 17, 7, 53, 99, 191, 607, 1229,
+    1, 3, 5, 9, 5, 33, 67, 127, 447, 541, 1273,
+    1, 3, 3, 13, 15, 51, 87, 83, 323, 939, 1251,
+    1, 3, 5, 9, 17, 9, 63, 93, 225, 481, 1649,
+    1, 1, 7, 1, 7, 3, 85, 189, 501, 493, 2017,
+    1, 1, 5, 5, 5, 61, 17, 7, 333, 515, 1621,
+    1, 3, 1, 5, 19, 19, 11, 215, 225, 481, 409,
+    1, 1, 5, 1, 29, 3, 99, 105, 3, 631, 1525,
+    1, 3, 7, 9, 31, 49, 65, 63, 331, 679, 1515,
+    1, 3, 5, 13, 19, 9, 73, 5, 477, 185, 659,
+    1, 3, 1, 11, 7, 51, 47, 125, 337, 877, 1687,
+    1, 1, 7, 13, 13, 15, 101, 113, 187, 19, 1301,
+    1, 1, 1, 13, 13, 47, 67, 33, 283, 113, 1793,
+    1, 1, 3, 15, 19, 3, 71, 141, 413, 189, 359,
+    1, 3, 3, 9, 11, 63, 103, 95, 195, 725, 1289,
+    1, 3, 5, 15, 29, 35, 61, 49, 283, 911, 345,
+    1, 3, 5, 9, 29, 39, 47, 109, 155, 311, 1269,
+    1, 3, 1, 7, 17, 37, 101, 81, 165, 7, 59,
+    1, 3, 3, 15, 3, 9, 3, 157, 261, 913, 1999,
+    1, 3, 5, 3, 19, 47, 127, 147, 491, 851, 291,
+    1, 1, 7, 13, 1, 41, 123, 209, 265, 7, 3,
+    1, 1, 5, 5, 3, 15, 109, 43, 43, 485, 1725,
+    1, 3, 1, 3, 27, 49, 59, 191, 121, 277, 1587,
+    1, 3, 7, 7, 3, 15, 117, 177, 305, 577, 77,
+    1, 3, 7, 5, 19, 51, 79, 31, 253, 1013, 1429,
+    1, 1, 7, 15, 5, 29, 35, 15, 277, 333, 1167,
+    1, 3, 5, 1, 21, 51, 15, 149, 325, 215, 1487,
+    1, 1, 1, 3, 1, 19, 7, 79, 365, 647, 1887,
+    1, 3, 7, 3, 7, 31, 89, 73, 357, 123, 1967,
+    1, 3, 5, 9, 17, 7, 73, 49, 47, 283, 1043, 3427,
+    1, 1, 3, 15, 31, 33, 29, 61, 29, 981, 1963, 2427,
+    1, 3, 3, 1, 29, 7, 61, 69, 37, 29, 621, 2301,
+    1, 3, 3, 11, 5, 17, 103, 215, 99, 787, 1719, 1167,
+    1, 1, 3, 11, 13, 9, 15, 105, 91, 945, 123, 693,
+    1, 1, 3, 15, 11, 7, 51, 27, 489, 361, 907, 2087,
+    1, 3, 5, 1, 29, 1, 37, 147, 327, 695, 739, 261,
+    1, 1, 1, 7, 9, 55, 49, 247, 3, 777, 495, 3197,
+    1, 1, 5, 3, 19, 3, 17, 11, 485, 415, 705, 3233,
+    1, 3, 3, 13, 1, 51, 123, 219, 373, 265, 1205, 1725,
+    1, 1, 1, 11, 19, 57, 111, 171, 43, 317, 947, 301,
+    1, 3, 1, 13, 21, 17, 31, 225, 297, 805, 1979, 3429,
+    1, 1, 7, 13, 17, 41, 11, 249, 341, 951, 171, 1839,
+    1, 1, 7, 3, 23, 37, 117, 21, 315, 491, 797, 3599,
+    1, 1, 1, 5, 25, 35, 33, 105, 413, 277, 1467, 1515,
+    1, 3, 1, 11, 17, 23, 51, 69, 441, 865, 1239, 671,
+    1, 1, 3, 9, 31, 5, 17, 41, 333, 809, 1899, 1233,
+    1, 1, 5, 5, 29, 25, 41, 243, 237, 513, 845, 3265,
+    1, 1, 3, 1, 23, 31, 123, 195, 103, 589, 81, 2799,
+    1, 3, 3, 9, 29, 63, 123, 137, 115, 397, 411, 775,
+    1, 3, 1, 9, 29, 43, 85, 47, 59, 155, 169, 1295,
+    1, 3, 1, 7, 3, 7, 49, 19, 401, 791, 2041, 2321,
+    1, 3, 7, 11, 13, 37, 91, 41, 445, 349, 1721, 1683,
+    1, 3, 7, 13, 9, 31, 127, 97, 269, 511, 1559, 235,
+    1, 1, 3, 3, 7, 55, 35, 61, 293, 649, 581, 3463,
+    1, 1, 3, 15, 3, 59, 37, 75, 321, 367, 1927, 3631,
+    1, 1, 7, 1, 27, 31, 69, 159, 473, 79, 865, 2767,
+    1, 3, 3, 5, 31, 35, 9, 47, 271, 61, 1195, 2289,
+    1, 1, 1, 5, 13, 7, 125, 29, 447, 325, 349, 3069,
+    1, 3, 5, 1, 9, 13, 121, 187, 41, 959, 2043, 1455,
+    1, 3, 7, 11, 7, 41, 55, 39, 327, 115, 1819, 3087,
+    1, 1, 1, 5, 11, 19, 23, 181, 59, 193, 1401, 1307,
+    1, 1, 1, 9, 23, 3, 75, 131, 113, 885, 1367, 41,
+    1, 1, 7, 15, 31, 37, 31, 179, 313, 203, 1953, 2981,
+    1, 3, 3, 9, 15, 21, 117, 113, 25, 359, 1667, 131,
+    1, 1, 1, 5, 29, 15, 21, 53, 325, 475, 1149, 3973,
+    1, 3, 5, 13, 7, 45, 31, 161, 429, 95, 1195, 779,
+    1, 1, 3, 1, 3, 23, 63, 9, 403, 263, 463, 83,
+    1, 1, 3, 13, 7, 51, 93, 165, 469, 505, 2009, 461,
+    1, 1, 3, 7, 25, 33, 75, 245, 439, 227, 1851, 1731,
+    1, 3, 3, 3, 15, 21, 33, 97, 79, 659, 59, 627,
+    1, 1, 5, 1, 11, 9, 19, 31, 271, 925, 263, 2351,
+    1, 1, 1, 1, 9, 43, 33, 173, 379, 461, 1421, 625,
+    1, 1, 5, 11, 27, 55, 81, 127, 45, 123, 503, 3313,
+    1, 1, 5, 9, 7, 59, 19, 107, 113, 105, 1483, 1319,
+    1, 3, 1, 15, 25, 47, 95, 5, 415, 349, 1921, 727,
+    1, 1, 1, 3, 29, 27, 127, 203, 347, 595, 961, 829,
+    1, 1, 1, 3, 17, 37, 89, 55, 375, 21, 1145, 3365,
+    1, 3, 1, 13, 15, 41, 83, 185, 281, 23, 1065, 2135,
+    1, 3, 1, 15, 9, 45, 101, 139, 399, 231, 529, 2827,
+    1, 1, 7, 1, 11, 7, 103, 89, 17, 359, 991, 3371,
+    1, 3, 3, 15, 29, 61, 1, 159, 107, 951, 1185, 367,
+    1, 3, 3, 5, 7, 59, 71, 221, 499, 425, 769, 2287,
+    1, 1, 5, 13, 19, 27, 65, 47, 467, 229, 1985, 1061,
+    1, 1, 5, 9, 11, 29, 49, 209, 311, 437, 427, 2235,
+    1, 1, 3, 11, 7, 23, 47, 69, 119, 615, 1891, 1393,
+    1, 1, 5, 13, 3, 15, 3, 67, 363, 357, 1979, 1633,
+    1, 1, 1, 3, 9, 61, 65, 119, 199, 269, 1255, 3481,
+    1, 3, 7, 3, 9, 47, 5, 125, 273, 683, 1345, 415,
+    1, 3, 5, 15, 11, 37, 119, 117, 135, 323, 835, 615,
+    1, 3, 7, 9, 9, 55, 65, 3, 17, 879, 1297, 3635,
+    1, 3, 1, 13, 5, 55, 31, 13, 477, 279, 1243, 843,
+    1, 1, 7, 5, 3, 59, 11, 241, 355, 975, 1519, 2503,
+    1, 3, 1, 3, 17, 41, 95, 221, 183, 231, 1819, 3131,
+    1, 1, 5, 13, 29, 41, 47, 123, 461, 7, 1201, 1529,
+    1, 1, 1, 11, 13, 37, 33, 77, 319, 13, 247, 9,
+    1, 1, 7, 3, 19, 9, 23, 5, 151, 499, 539, 553,
+    1, 3, 3, 13, 9, 23, 1, 219, 401, 199, 1881, 2185,
+    1, 1, 7, 1, 21, 37, 99, 217, 25, 881, 1951, 4001,
+    1, 3, 1, 11, 1, 37, 113, 201, 255, 707, 747, 557,
+    1, 1, 1, 11, 17, 21, 21, 63, 153, 901, 2045, 2625,
+    1, 3, 3, 7, 17, 31, 73, 249, 435, 53, 1161, 159,
+    1, 1, 5, 7, 5, 45, 115, 177, 323, 403, 547, 3933,
+    1, 1, 5, 5, 1, 49, 41, 159, 267, 297, 541, 165,
+    1, 1, 5, 9, 3, 3, 39, 157, 463, 433, 1889, 211,
+    1, 1, 7, 5, 31, 27, 43, 39, 205, 991, 1313, 4029,
+    1, 3, 7, 13, 11, 27, 61, 209, 503, 889, 1261, 265,
+    1, 3, 1, 9, 19, 7, 35, 7, 315, 599, 175, 359,
+    1, 1, 3, 11, 7, 55, 69, 197, 207, 391, 1009, 1725,
+    1, 3, 7, 9, 13, 47, 121, 95, 477, 159, 213, 439,
+    1, 1, 3, 13, 3, 51, 61, 125, 337, 111, 1523, 535,
+    1, 3, 3, 3, 21, 47, 65, 113, 143, 633, 2001, 833,
+    1, 1, 3, 7, 9, 45, 63, 183, 83, 679, 839, 1603,
+    1, 1, 5, 15, 17, 19, 43, 225, 131, 719, 1877, 2089,
+    1, 1, 7, 11, 7, 49, 9, 255, 477, 843, 1185, 577,
+    1, 1, 7, 5, 13, 63, 99, 131, 335, 197, 471, 115,
+    1, 1, 3, 3, 3, 41, 53, 111, 293, 125, 993, 3323,
+    1, 3, 7, 15, 21, 19, 27, 117, 47, 433, 1713, 3239,
+    1, 3, 1, 15, 9, 15, 33, 9, 357, 499, 691, 3903,
+    1, 3, 7, 7, 5, 25, 83, 69, 495, 267, 1993, 3411,
+    1, 3, 7, 9, 9, 43, 35, 179, 145, 73, 901, 1323,
+    1, 3, 1, 9, 19, 53, 1, 75, 87, 211, 481, 257,
+    1, 3, 1, 11, 21, 5, 117, 81, 107, 689, 1113, 1883,
+    1, 1, 1, 1, 27, 23, 15, 253, 337, 363, 1367, 3281,
+    1, 1, 5, 1, 27, 3, 7, 219, 505, 1013, 1953, 2691,
+    1, 1, 7, 9, 29, 53, 59, 249, 169, 17, 235, 3649,
+    1, 3, 3, 3, 25, 41, 117, 187, 389, 367, 801, 1657,
+    1, 3, 5, 9, 11, 9, 113, 5, 7, 659, 475, 2519,
+    1, 3, 1, 1, 25, 57, 3, 47, 57, 709, 1871, 2405,
+    1, 1, 3, 1, 1, 17, 93, 107, 147, 527, 57, 3115,
+    1, 3, 1, 13, 7, 17, 81, 217, 339, 485, 1779, 2247,
+    1, 1, 1, 1, 23, 61, 39, 193, 359, 863, 191, 2741,
+    1, 3, 3, 1, 15, 25, 101, 49, 181, 531, 1303, 3073,
+    1, 1, 1, 13, 11, 29, 113, 17, 415, 921, 653, 185,
+    1, 3, 3, 7, 9, 13, 81, 95, 425, 195, 579, 157,
+    1, 3, 3, 11, 13, 59, 5, 97, 49, 885, 1409, 1749,
+    1, 1, 1, 13, 1, 61, 95, 71, 425, 853, 781, 2497,
+    1, 3, 3, 1, 21, 47, 125, 171, 267, 967, 43, 2877,
+    1, 3, 1, 3, 9, 43, 71, 193, 257, 437, 801, 1521,
+    1, 3, 5, 1, 29, 11, 93, 61, 399, 89, 183, 3287,
+    1, 1, 7, 9, 27, 47, 79, 147, 319, 473, 613, 77,
+    1, 1, 5, 15, 21, 25, 69, 141, 173, 889, 831, 1949,
+    1, 3, 3, 13, 5, 21, 7, 93, 253, 321, 43, 2535,
+    1, 1, 3, 5, 9, 25, 83, 45, 409, 883, 707, 2883,
+    1, 1, 1, 7, 25, 31, 101, 111, 145, 793, 1173, 3643,
+    1, 1, 1, 7, 23, 7, 5, 115, 321, 53, 63, 1541,
+    1, 1, 1, 11, 29, 31, 83, 175, 87, 521, 1015, 1635,
+    1, 1, 7, 3, 17, 33, 25, 189, 225, 189, 131, 1715,
+    1, 1, 1, 9, 13, 7, 99, 121, 235, 805, 555, 3085,
+    1, 1, 1, 11, 1, 29, 37, 209, 477, 3, 1641, 2483,
+    1, 1, 7, 15, 17, 33, 71, 133, 75, 457, 729, 551,
+    1, 1, 1, 15, 11, 45, 37, 35, 345, 605, 957, 1099,
+    1, 1, 5, 15, 25, 21, 53, 199, 39, 841, 321, 55,
+    1, 3, 3, 3, 1, 3, 31, 29, 453, 31, 705, 3645,
+    1, 3, 7, 1, 17, 41, 75, 247, 427, 711, 1555, 3855,
+    1, 3, 1, 1, 5, 63, 77, 119, 353, 393, 1163, 1167,
+    1, 3, 3, 5, 1, 29, 75, 131, 485, 333, 959, 123,
+    1, 3, 7, 1, 1, 47, 1, 105, 217, 821, 719, 3043,
+    1, 1, 7, 5, 9, 47, 15, 17, 173, 461, 657, 637,
+    1, 3, 7, 7, 29, 9, 69, 175, 13, 13, 957, 3523,
+    1, 1, 3, 13, 9, 13, 11, 89, 79, 493, 133, 3143,
+    1, 1, 5, 13, 1, 15, 65, 83, 355, 211, 335, 2241,
+    1, 1, 5, 9, 9, 33, 91, 245, 273, 897, 2003, 2535,
+    1, 1, 5, 9, 13, 33, 95, 95, 239, 343, 477, 2055,
+    1, 1, 5, 7, 23, 51, 39, 243, 135, 735, 743, 3535,
+    1, 3, 3, 5, 3, 39, 43, 239, 135, 971, 341, 397,
+    1, 1, 3, 9, 9, 33, 19, 165, 391, 289, 1249, 3989,
+    1, 1, 1, 1, 5, 29, 27, 125, 427, 897, 123, 97,
+    1, 3, 3, 3, 5, 7, 107, 123, 419, 821, 2027, 937,
+    1, 1, 3, 15, 7, 51, 57, 183, 103, 439, 471, 2501,
+    1, 1, 7, 7, 11, 33, 27, 109, 53, 39, 271, 3063,
+    1, 3, 5, 1, 7, 51, 55, 171, 253, 19, 189, 2123,
+    1, 1, 7, 1, 13, 1, 125, 231, 83, 883, 1599, 811,
+    1, 3, 1, 3, 17, 63, 89, 21, 419, 1011, 1075, 1085,
+    1, 3, 7, 5, 1, 63, 3, 57, 243, 837, 1873, 3943, 7237,
+    1, 1, 7, 9, 31, 25, 115, 79, 467, 59, 879, 1907, 7583,
+    1, 1, 1, 13, 19, 7, 19, 105, 233, 427, 433, 1387, 3103,
+    1, 1, 1, 15, 9, 17, 37, 79, 363, 743, 1163, 947, 2683,
+    1, 1, 1, 15, 21, 5, 105, 169, 217, 899, 1159, 2555, 2495,
+    1, 1, 7, 7, 29, 47, 17, 25, 429, 1, 1767, 2323, 4847,
+    1, 1, 3, 3, 9, 61, 29, 11, 163, 979, 749, 4009, 6743,
+    1, 1, 3, 11, 15, 9, 33, 47, 359, 305, 1091, 2363, 1803,
+    1, 1, 3, 9, 25, 7, 43, 125, 365, 339, 333, 3199, 1679,
+    1, 1, 5, 15, 5, 45, 1, 221, 509, 319, 711, 3929, 7871,
+    1, 3, 5, 1, 21, 17, 119, 137, 213, 95, 1995, 797, 6717,
+    1, 3, 5, 1, 23, 13, 7, 247, 23, 585, 1197, 3075, 4307,
+    1, 3, 1, 7, 15, 5, 21, 139, 381, 443, 783, 15, 2243,
+    1, 3, 1, 15, 15, 29, 67, 125, 319, 547, 417, 345, 671,
+    1, 3, 3, 3, 7, 61, 117, 135, 383, 317, 2035, 2551, 1933,
+    1, 1, 3, 13, 29, 41, 71, 21, 265, 517, 11, 1215, 433,
+    1, 1, 7, 3, 19, 19, 13, 159, 7, 913, 1197, 1015, 8033,
+    1, 3, 1, 15, 27, 63, 33, 147, 323, 161, 1011, 1101, 2785,
+    1, 1, 5, 3, 29, 19, 21, 123, 145, 473, 1465, 209, 7343,
+    1, 3, 1, 11, 23, 5, 29, 113, 117, 371, 1677, 787, 3767,
+    1, 3, 5, 15, 7, 55, 61, 251, 369, 507, 1801, 3125, 2225,
+    1, 1, 3, 7, 19, 1, 111, 253, 237, 371, 131, 1633, 6769,
+    1, 1, 1, 5, 29, 39, 119, 107, 47, 401, 1485, 2301, 2019,
+    1, 1, 3, 11, 29, 25, 9, 243, 343, 153, 1673, 183, 957,
+    1, 1, 3, 5, 31, 17, 9, 35, 321, 51, 975, 3717, 6867,
+    1, 3, 7, 7, 5, 33, 109, 65, 163, 563, 1067, 2259, 1735,
+    1, 1, 1, 11, 29, 45, 101, 77, 389, 251, 373, 1837, 1989,
+    1, 3, 7, 5, 23, 47, 45, 33, 393, 577, 949, 2793, 4959,
+    1, 3, 5, 11, 21, 39, 63, 25, 3, 615, 1251, 3735, 5883,
+    1, 3, 3, 3, 5, 13, 53, 183, 135, 765, 1549, 1983, 7505,
+    1, 1, 5, 5, 19, 25, 45, 39, 453, 753, 1079, 3743, 4553,
+    1, 3, 1, 9, 7, 51, 125, 149, 141, 283, 623, 2249, 4211,
+    1, 3, 3, 1, 27, 23, 51, 231, 275, 991, 1149, 3765, 627,
+    1, 1, 3, 3, 11, 41, 23, 31, 311, 989, 147, 95, 879,
+    1, 3, 3, 7, 27, 57, 1, 227, 89, 569, 1921, 1751, 4015,
+    1, 3, 5, 11, 17, 41, 55, 181, 451, 539, 101, 661, 4059,
+    1, 3, 1, 1, 7, 55, 31, 203, 453, 693, 1691, 375, 6029,
+    1, 1, 1, 7, 9, 1, 71, 129, 201, 325, 475, 3435, 2089,
+    1, 1, 1, 5, 1, 43, 69, 11, 383, 977, 1589, 3873, 5721,
+    1, 3, 1, 1, 5, 17, 83, 107, 127, 993, 149, 1781, 2975,
+    1, 3, 7, 11, 1, 37, 65, 201, 455, 435, 1665, 3297, 6233,
+    1, 3, 1, 1, 11, 9, 63, 215, 421, 49, 1969, 3513, 8045,
+    1, 1, 3, 9, 23, 59, 83, 185, 327, 383, 933, 2089, 1169,
+    1, 1, 1, 5, 21, 27, 45, 57, 207, 673, 565, 2115, 5443,
+    1, 3, 3, 11, 3, 41, 73, 79, 103, 995, 1893, 1779, 2257,
+    1, 3, 7, 7, 25, 57, 43, 79, 417, 177, 3, 2985, 7197,
+    1, 3, 1, 9, 1, 23, 89, 155, 373, 903, 611, 1439, 1741,
+    1, 3, 1, 15, 5, 55, 81, 53, 413, 827, 963, 2381, 6777,
+    1, 3, 7, 3, 21, 13, 9, 97, 377, 685, 583, 2441, 1901,
+    1, 3, 5, 5, 25, 5, 7, 97, 245, 475, 1617, 2891, 2261,
+    1, 3, 5, 11, 21, 3, 71, 93, 15, 355, 1877, 1773, 7155,
+    1, 1, 1, 11, 23, 59, 59, 207, 233, 707, 897, 2467, 6245,
+    1, 1, 3, 13, 29, 43, 39, 255, 81, 589, 213, 1169, 2811,
+    1, 3, 1, 1, 9, 7, 23, 19, 501, 141, 1775, 2823, 4969,
+    1, 3, 5, 15, 19, 59, 53, 197, 509, 91, 1241, 975, 939,
+    1, 3, 1, 9, 9, 7, 13, 55, 263, 571, 1975, 2629, 2995,
+    1, 3, 5, 11, 15, 23, 59, 31, 169, 85, 823, 3631, 1105,
+    1, 1, 5, 11, 3, 19, 21, 109, 447, 943, 1433, 1427, 4527,
+    1, 1, 3, 15, 21, 51, 101, 35, 69, 163, 1379, 483, 6019,
+    1, 3, 1, 9, 5, 29, 33, 41, 131, 185, 11, 1167, 2333,
+    1, 3, 3, 5, 7, 15, 43, 215, 159, 51, 979, 3327, 2895,
+    1, 1, 3, 15, 9, 5, 19, 203, 237, 13, 2009, 685, 3673,
+    1, 3, 1, 15, 3, 9, 23, 181, 127, 991, 663, 2873, 5731,
+    1, 3, 3, 1, 3, 23, 59, 29, 179, 497, 1879, 4073, 6331,
+    1, 3, 5, 1, 7, 19, 11, 5, 247, 573, 1493, 2093, 2825,
+    1, 1, 7, 15, 13, 39, 19, 243, 23, 747, 21, 4061, 6345,
+    1, 1, 1, 15, 27, 11, 79, 227, 129, 347, 183, 1577, 2671,
+    1, 3, 1, 5, 23, 17, 19, 197, 157, 1011, 827, 4023, 7241,
+    1, 1, 1, 9, 29, 11, 123, 157, 383, 931, 1903, 367, 2091,
+    1, 1, 1, 11, 17, 15, 109, 177, 215, 413, 1949, 3663, 7297,
+    1, 3, 7, 15, 5, 33, 73, 153, 11, 893, 1173, 1579, 5099,
+    1, 3, 1, 9, 23, 33, 17, 29, 501, 1011, 767, 1801, 3741,
+    1, 1, 3, 15, 11, 7, 5, 53, 151, 385, 1083, 1169, 2945,
+    1, 1, 7, 15, 27, 61, 111, 133, 265, 279, 1087, 3907, 6217,
+    1, 1, 3, 13, 29, 39, 33, 249, 45, 657, 1135, 521, 3753,
+    1, 3, 7, 5, 3, 21, 39, 115, 469, 923, 1307, 3137, 3445,
+    1, 1, 3, 3, 25, 5, 93, 143, 9, 59, 2029, 3211, 1415,
+    1, 1, 5, 1, 5, 13, 37, 13, 3, 107, 1085, 3573, 3509,
+    1, 1, 7, 11, 19, 41, 11, 89, 45, 1003, 403, 677, 5583,
+    1, 3, 7, 15, 17, 11, 61, 113, 375, 409, 741, 357, 4349,
+    1, 3, 7, 15, 13, 55, 121, 93, 283, 345, 535, 2429, 4977,
+    1, 3, 3, 11, 25, 29, 113, 233, 171, 1019, 991, 145, 7639,
+    1, 1, 1, 9, 9, 37, 37, 91, 411, 541, 881, 2949, 3647,
+    1, 1, 3, 1, 5, 59, 125, 137, 413, 375, 863, 713, 133,
+    1, 3, 5, 5, 17, 25, 53, 189, 377, 103, 1197, 669, 59,
+    1, 1, 3, 3, 31, 23, 105, 153, 87, 149, 753, 2931, 4065,
+    1, 3, 3, 11, 15, 9, 61, 219, 47, 273, 389, 3977, 5673,
+    1, 1, 5, 5, 11, 55, 97, 169, 457, 663, 1229, 2985, 7459,
+    1, 3, 3, 7, 23, 1, 55, 129, 359, 207, 985, 2953, 6997,
+    1, 3, 5, 7, 13, 27, 67, 83, 407, 741, 629, 3063, 731,
+    1, 3, 1, 3, 5, 53, 55, 205, 27, 95, 1949, 1517, 4951,
+    1, 3, 3, 3, 5, 3, 117, 189, 173, 781, 111, 3271, 5541,
+    1, 1, 1, 13, 29, 11, 41, 201, 259, 915, 851, 1399, 3975,
+    1, 1, 7, 13, 23, 1, 69, 17, 51, 359, 1933, 2991, 5523,
+    1, 1, 5, 7, 21, 53, 13, 157, 87, 417, 1431, 3419, 6995,
+    1, 1, 3, 1, 27, 59, 31, 121, 129, 623, 1719, 2533, 3989,
+    1, 1, 3, 1, 9, 29, 51, 51, 501, 855, 511, 2721, 6807,
+    1, 1, 5, 11, 19, 53, 51, 111, 35, 345, 567, 3345, 337,
+    1, 3, 7, 1, 13, 3, 19, 69, 397, 505, 1519, 1819, 2885,
+    1, 1, 3, 13, 29, 47, 123, 215, 315, 117, 1035, 317, 1601,
+    1, 3, 7, 5, 17, 55, 113, 227, 163, 67, 1505, 1651, 7749,
+    1, 3, 3, 5, 5, 15, 99, 173, 31, 809, 1881, 767, 4505,
+    1, 1, 1, 7, 19, 29, 79, 227, 493, 635, 1199, 3557, 7777,
+    1, 1, 3, 5, 29, 3, 89, 171, 385, 5, 649, 1231, 1813,
+    1, 3, 1, 1, 13, 63, 115, 213, 447, 941, 1545, 1983, 877,
+    1, 1, 7, 5, 25, 13, 75, 237, 109, 861, 863, 1387, 2647,
+    1, 1, 3, 3, 3, 37, 119, 111, 155, 71, 455, 613, 1353,
+    1, 3, 3, 1, 11, 19, 75, 191, 379, 515, 1113, 925, 4427,
+    1, 3, 1, 11, 9, 11, 53, 47, 251, 799, 53, 2603, 35,
+    1, 1, 1, 7, 11, 19, 89, 155, 43, 345, 559, 191, 2925,
+    1, 1, 5, 15, 9, 55, 21, 61, 51, 813, 233, 1857, 5093,
+    1, 1, 7, 7, 11, 23, 93, 203, 221, 437, 1573, 13, 7813,
+    1, 1, 3, 15, 25, 43, 61, 21, 147, 573, 155, 3033, 299,
+    1, 3, 7, 7, 31, 33, 111, 61, 189, 185, 401, 1183, 4529,
+    1, 3, 1, 13, 1, 7, 31, 115, 89, 595, 1947, 467, 8073,
+    1, 3, 1, 9, 23, 7, 35, 59, 367, 805, 459, 2213, 5747,
+    1, 3, 1, 11, 29, 27, 47, 73, 159, 161, 1431, 2713, 7555,
+    1, 3, 5, 3, 31, 19, 53, 187, 451, 47, 3, 1133, 1909,
+    1, 3, 7, 13, 11, 11, 45, 251, 21, 1019, 1731, 1997, 2605,
+    1, 3, 5, 11, 17, 55, 51, 237, 61, 1001, 373, 3295, 1779,
+    1, 3, 1, 7, 7, 47, 19, 227, 511, 365, 1523, 787, 6449,
+    1, 1, 7, 1, 25, 19, 79, 13, 411, 679, 1931, 2445, 4237,
+    1, 3, 5, 11, 5, 5, 61, 139, 19, 505, 165, 2247, 5211,
+    1, 1, 1, 7, 13, 5, 5, 213, 169, 927, 237, 2699, 1809,
+    1, 3, 1, 13, 13, 35, 19, 101, 279, 327, 969, 2367, 4839,
+    1, 1, 1, 1, 19, 11, 11, 99, 123, 279, 1069, 1481, 741,
+    1, 1, 7, 11, 13, 11, 59, 181, 193, 633, 1211, 579, 4081,
+    1, 3, 1, 5, 23, 41, 55, 129, 349, 767, 1157, 2749, 2259,
+    1, 3, 5, 5, 21, 57, 41, 195, 209, 741, 1707, 3895, 1161,
+    1, 1, 7, 1, 29, 41, 67, 123, 311, 683, 713, 2923, 1741,
+    1, 3, 1, 9, 31, 27, 99, 145, 323, 443, 503, 767, 129,
+    1, 3, 5, 3, 19, 35, 15, 213, 107, 363, 311, 3389, 6233,
+    1, 3, 7, 11, 31, 59, 17, 81, 495, 475, 1465, 759, 4113,
+    1, 3, 7, 13, 23, 53, 41, 215, 25, 3, 1679, 201, 1559,
+    1, 1, 1, 7, 21, 9, 17, 37, 347, 557, 811, 1979, 5885,
+    1, 3, 5, 11, 29, 11, 61, 249, 455, 339, 1061, 2057, 4271,
+    1, 3, 7, 7, 31, 59, 91, 223, 67, 413, 1419, 2163, 5271,
+    1, 1, 3, 15, 23, 7, 79, 95, 111, 419, 81, 2857, 5191,
+    1, 3, 5, 3, 5, 63, 29, 191, 59, 493, 59, 737, 979,
+    1, 1, 7, 3, 5, 19, 35, 89, 391, 393, 1033, 1843, 961,
+    1, 1, 3, 11, 5, 61, 91, 251, 167, 825, 401, 3979, 4819,
+    1, 1, 1, 9, 27, 21, 123, 23, 317, 1007, 569, 2357, 6727,
+    1, 3, 5, 11, 23, 3, 5, 181, 305, 693, 2025, 2855, 7269,
+    1, 3, 3, 15, 23, 51, 15, 213, 51, 751, 413, 1943, 2167,
+    1, 1, 1, 3, 7, 47, 81, 71, 369, 881, 551, 59, 5125,
+    1, 1, 3, 5, 9, 63, 29, 45, 197, 5, 637, 3907, 1897,
+    1, 1, 3, 9, 25, 5, 17, 115, 163, 315, 683, 2141, 5147,
+    1, 3, 1, 11, 29, 45, 81, 227, 489, 613, 515, 945, 153,
+    1, 1, 1, 1, 19, 33, 79, 111, 223, 113, 325, 2241, 129,
+    1, 1, 7, 9, 19, 57, 11, 109, 37, 631, 349, 3755, 2347,
+    1, 1, 5, 3, 25, 15, 93, 9, 123, 887, 599, 2635, 4317,
+    1, 3, 5, 7, 27, 35, 59, 47, 417, 939, 91, 211, 2789,
+    1, 1, 1, 5, 15, 37, 29, 91, 167, 479, 1093, 2847, 4899,
+    1, 3, 1, 1, 9, 31, 91, 3, 487, 405, 1899, 195, 1449,
+    1, 1, 3, 11, 3, 33, 35, 149, 363, 299, 457, 1033, 3801,
+    1, 3, 7, 3, 25, 5, 23, 151, 221, 459, 127, 209, 3709,
+    1, 3, 7, 11, 23, 53, 121, 73, 421, 291, 1425, 1791, 1787,
+    1, 1, 7, 9, 17, 59, 41, 55, 73, 397, 2041, 1933, 3103,
+    1, 3, 3, 15, 31, 23, 85, 101, 259, 735, 21, 3533, 6461,
+    1, 3, 3, 3, 31, 31, 19, 89, 489, 513, 383, 1345, 2115,
+    1, 1, 7, 1, 15, 25, 37, 175, 421, 871, 401, 1717, 6037,
+    1, 3, 7, 11, 25, 11, 87, 219, 307, 815, 1977, 1461, 715,
+    1, 1, 7, 5, 21, 13, 3, 229, 79, 1013, 1851, 2427, 4161,
+    1, 3, 3, 3, 23, 3, 21, 91, 205, 699, 81, 2993, 5121,
+    1, 1, 7, 15, 31, 43, 39, 13, 481, 633, 531, 237, 3241,
+    1, 3, 1, 1, 3, 21, 29, 77, 249, 517, 1697, 3283, 33,
+    1, 1, 1, 3, 15, 41, 101, 87, 377, 215, 205, 1075, 4743,
+    1, 3, 1, 7, 19, 37, 7, 179, 427, 831, 835, 3753, 2479,
+    1, 1, 3, 1, 31, 19, 103, 245, 323, 89, 1069, 4047, 5071,
+    1, 1, 5, 7, 23, 3, 41, 249, 385, 525, 1531, 573, 6447,
+    1, 1, 5, 3, 15, 45, 79, 201, 219, 755, 1223, 2379, 3595,
+    1, 1, 3, 7, 27, 19, 85, 123, 321, 351, 823, 1, 6099,
+    1, 1, 5, 13, 9, 3, 9, 185, 311, 237, 1211, 2235, 4537,
+    1, 1, 5, 13, 27, 21, 53, 73, 257, 609, 395, 3451, 4267,
+    1, 3, 7, 15, 1, 5, 45, 189, 1, 933, 917, 231, 7155,
+    1, 3, 5, 5, 3, 23, 75, 33, 423, 383, 829, 1275, 4069,
+    1, 3, 5, 3, 25, 9, 77, 249, 459, 57, 1789, 303, 4285,
+    1, 3, 3, 9, 5, 57, 89, 87, 457, 215, 997, 2919, 6717,
+    1, 3, 7, 1, 17, 7, 53, 133, 275, 657, 389, 2681, 1661,
+    1, 3, 3, 5, 13, 57, 125, 89, 51, 975, 1433, 3115, 7857,
+    1, 3, 1, 9, 3, 25, 33, 61, 303, 679, 683, 1495, 4875,
+    1, 3, 3, 15, 9, 23, 125, 157, 223, 897, 2043, 3355, 7153,
+    1, 1, 5, 7, 31, 25, 31, 107, 445, 31, 1365, 3025, 3189,
+    1, 1, 1, 15, 7, 49, 53, 15, 235, 149, 895, 2263, 5249,
+    1, 1, 3, 15, 23, 1, 47, 65, 25, 275, 1491, 1677, 1309,
+    1, 3, 3, 3, 29, 21, 127, 201, 253, 585, 1905, 511, 873,
+    1, 1, 1, 13, 23, 41, 23, 215, 405, 7, 49, 2951, 1731,
+    1, 1, 1, 5, 1, 33, 91, 97, 65, 311, 687, 2951, 5447,
+    1, 1, 5, 7, 3, 15, 27, 13, 483, 767, 995, 1661, 623,
+    1, 3, 3, 5, 23, 53, 127, 29, 61, 691, 1041, 2165, 27,
+    1, 3, 5, 7, 31, 23, 97, 203, 313, 93, 1419, 2683, 4911,
+    1, 1, 3, 1, 17, 39, 35, 163, 311, 63, 429, 621, 5459,
+    1, 1, 5, 13, 17, 13, 19, 145, 373, 901, 113, 1849, 2255,
+    1, 1, 1, 11, 9, 29, 67, 169, 109, 725, 259, 2017, 4939,
+    1, 3, 1, 1, 13, 21, 7, 255, 213, 137, 73, 561, 2073,
+    1, 3, 7, 9, 23, 45, 127, 183, 5, 191, 1789, 2563, 2423,
+    1, 1, 1, 5, 7, 1, 87, 121, 457, 37, 685, 209, 4887,
+    1, 3, 3, 11, 23, 23, 41, 255, 85, 73, 1153, 1497, 8123,
+    1, 3, 5, 9, 19, 33, 53, 229, 277, 755, 1997, 2363, 11,
+    1, 3, 5, 7, 23, 55, 35, 57, 87, 1011, 1741, 3975, 3263,
+    1, 1, 3, 3, 29, 63, 41, 9, 25, 905, 837, 3561, 4769,
+    1, 3, 5, 9, 7, 13, 95, 169, 311, 509, 1079, 4035, 1845,
+    1, 1, 7, 5, 5, 33, 75, 37, 3, 411, 285, 3653, 2987,
+    1, 3, 7, 9, 1, 21, 31, 21, 421, 59, 1499, 729, 3417,
+    1, 3, 5, 1, 19, 55, 19, 183, 469, 117, 133, 3493, 6011,
+    1, 1, 7, 13, 21, 53, 51, 57, 495, 55, 1525, 3735, 4195,
+    1, 1, 1, 3, 7, 5, 7, 187, 419, 109, 603, 2605, 6119,
+    1, 3, 7, 9, 19, 49, 9, 129, 241, 323, 437, 1841, 3983,
+    1, 3, 3, 7, 17, 5, 119, 53, 473, 689, 1325, 1083, 1747,
+    1, 3, 5, 1, 29, 15, 107, 255, 295, 933, 1831, 3557, 2211,
+    1, 1, 7, 15, 11, 45, 39, 171, 369, 925, 871, 2009, 6989,
+    1, 1, 1, 1, 3, 33, 97, 213, 393, 839, 539, 2801, 3379,
+    1, 1, 5, 1, 5, 55, 87, 67, 499, 659, 1307, 2177, 1991,
+    1, 3, 7, 11, 25, 55, 39, 21, 303, 361, 161, 2099, 7661,
+    1, 3, 5, 5, 11, 15, 17, 227, 233, 719, 363, 3499, 6645,
+    1, 1, 3, 7, 21, 51, 39, 207, 147, 205, 853, 3747, 5401,
+    1, 1, 7, 9, 15, 61, 21, 7, 465, 367, 643, 3999, 4075,
+    1, 1, 1, 1, 25, 37, 57, 39, 23, 219, 1357, 1705, 819,
+    1, 3, 1, 5, 11, 41, 67, 57, 417, 831, 343, 3027, 2133,
+    1, 3, 5, 13, 23, 33, 53, 27, 247, 93, 691, 3405, 1405,
+    1, 3, 5, 13, 25, 51, 53, 217, 341, 423, 199, 2367, 8027,
+    1, 3, 1, 13, 11, 29, 111, 181, 447, 807, 1065, 3875, 5879,
+    1, 3, 5, 11, 3, 61, 73, 67, 43, 961, 221, 203, 3237,
+    1, 1, 5, 11, 23, 63, 19, 181, 55, 923, 1597, 3585, 8001,
+    1, 3, 1, 15, 19, 53, 105, 85, 345, 581, 291, 3871, 903,
+    1, 3, 7, 1, 17, 43, 55, 7, 259, 527, 1957, 1043, 7347,
+    1, 3, 3, 13, 1, 45, 53, 225, 289, 611, 547, 945, 5509,
+    1, 1, 3, 9, 23, 25, 35, 29, 371, 17, 1523, 1219, 2165,
+    1, 3, 5, 7, 15, 49, 105, 145, 443, 71, 821, 1679, 3333,
+    1, 3, 1, 9, 27, 1, 83, 31, 373, 507, 113, 1409, 7901,
+    1, 1, 1, 9, 17, 27, 89, 165, 363, 95, 1395, 3213, 2825,
+    1, 1, 3, 5, 23, 47, 113, 221, 221, 641, 639, 237, 915,
+    1, 1, 7, 5, 19, 5, 89, 25, 359, 1019, 1793, 1029, 939,
+    1, 3, 3, 3, 11, 43, 107, 69, 363, 801, 921, 1221, 7585,
+    1, 3, 1, 3, 31, 47, 9, 5, 377, 823, 855, 701, 3895,
+    1, 1, 7, 5, 25, 29, 85, 101, 203, 485, 1585, 3947, 5603,
+    1, 3, 3, 7, 5, 47, 121, 121, 139, 257, 207, 2505, 1339,
+    1, 3, 3, 1, 31, 13, 19, 15, 189, 1003, 1063, 2689, 4577,
+    1, 1, 3, 15, 5, 53, 61, 13, 177, 575, 761, 27, 983,
+    1, 3, 7, 11, 15, 43, 33, 207, 465, 699, 1333, 3287, 2415,
+    1, 3, 7, 9, 27, 55, 37, 89, 301, 975, 1807, 2137, 7333,
+    1, 3, 7, 5, 5, 17, 117, 119, 69, 383, 857, 3921, 7743,
+    1, 1, 1, 13, 7, 49, 59, 221, 33, 777, 853, 3587, 6545,
+    1, 1, 5, 1, 1, 35, 5, 31, 147, 141, 1635, 3339, 7771,
+    1, 1, 5, 9, 9, 63, 97, 93, 317, 361, 1779, 3853, 4577,
+    1, 1, 7, 3, 13, 37, 123, 205, 187, 715, 1397, 11, 6025,
+    1, 1, 7, 5, 29, 53, 113, 203, 363, 469, 763, 3481, 5789,
+    1, 3, 5, 3, 21, 43, 77, 243, 479, 841, 525, 1259, 1981,
+    1, 1, 3, 7, 7, 53, 21, 193, 359, 691, 39, 3093, 6761,
+    1, 3, 1, 7, 5, 53, 61, 39, 493, 427, 1947, 3399, 6385,
+    1, 1, 5, 3, 31, 51, 69, 113, 7, 205, 339, 105, 4709,
+    1, 1, 1, 3, 17, 7, 55, 37, 95, 763, 1259, 169, 7961,
+    1, 3, 7, 5, 7, 53, 5, 63, 107, 171, 1659, 3823, 6691,
+    1, 1, 7, 11, 27, 61, 57, 143, 409, 217, 751, 4049, 3259,
+    1, 3, 7, 11, 15, 45, 87, 89, 227, 743, 951, 2225, 6003,
+    1, 3, 3, 11, 3, 53, 3, 181, 41, 1011, 1859, 1245, 2541,
+    1, 3, 7, 9, 1, 59, 67, 181, 153, 325, 1693, 2361, 7913,
+    1, 1, 1, 13, 11, 13, 63, 55, 411, 685, 535, 3879, 7735,
+    1, 3, 3, 3, 7, 19, 85, 177, 379, 663, 785, 953, 6951,
+    1, 1, 5, 3, 29, 61, 97, 39, 389, 465, 1095, 3909, 4419,
+    1, 3, 1, 3, 25, 53, 43, 155, 167, 821, 1923, 2219, 1203,
+    1, 1, 5, 3, 31, 19, 103, 97, 445, 391, 829, 3737, 4771,
+    1, 3, 3, 7, 13, 7, 53, 41, 229, 605, 853, 3081, 6181,
+    1, 3, 5, 5, 15, 1, 101, 207, 481, 79, 227, 1947, 7325,
+    1, 1, 7, 11, 11, 29, 21, 103, 25, 605, 1943, 1853, 5943,
+    1, 1, 1, 1, 9, 45, 75, 249, 255, 845, 975, 1009, 2567,
+    1, 3, 3, 11, 3, 23, 89, 77, 65, 825, 2007, 3717, 5361,
+    1, 1, 1, 15, 15, 49, 113, 187, 479, 801, 2033, 347, 2635,
+    1, 1, 7, 1, 3, 23, 17, 133, 195, 765, 79, 3555, 4363,
+    1, 1, 5, 11, 31, 29, 23, 11, 449, 295, 2009, 2751, 5847,
+    1, 3, 3, 1, 29, 43, 31, 157, 377, 189, 1197, 3831, 3619,
+    1, 3, 1, 9, 5, 51, 9, 93, 353, 413, 579, 957, 6767,
+    1, 3, 5, 13, 9, 23, 127, 233, 5, 879, 661, 3767, 5571,
+    1, 3, 5, 11, 15, 33, 89, 209, 247, 347, 1795, 183, 1395,
+    1, 1, 7, 9, 11, 5, 95, 245, 385, 745, 543, 1471, 3145,
+    1, 1, 5, 11, 19, 63, 41, 89, 1, 837, 1445, 367, 4031,
+    1, 1, 3, 15, 31, 47, 87, 67, 275, 811, 1183, 2049, 3047,
+    1, 3, 5, 1, 27, 21, 27, 181, 461, 751, 1269, 1171, 4809,
+    1, 3, 3, 11, 11, 19, 43, 243, 375, 611, 371, 2701, 7249,
+    1, 3, 5, 15, 27, 43, 95, 129, 409, 271, 131, 323, 5741,
+    1, 3, 5, 13, 25, 47, 15, 1, 9, 341, 1165, 423, 7823,
+    1, 3, 3, 5, 3, 57, 3, 159, 313, 273, 1289, 2431, 1445,
+    1, 1, 5, 11, 17, 51, 67, 33, 143, 697, 1347, 3983, 4345,
+    1, 1, 1, 9, 7, 1, 53, 227, 145, 139, 831, 1097, 4677,
+    1, 3, 3, 1, 27, 47, 41, 125, 481, 497, 295, 265, 5187,
+    1, 3, 3, 7, 21, 7, 85, 173, 319, 595, 169, 3157, 7431,
+    1, 3, 5, 9, 31, 33, 57, 139, 339, 477, 1495, 3869, 4467,
+    1, 3, 1, 13, 3, 53, 21, 73, 91, 53, 1959, 677, 4909,
+    1, 3, 3, 7, 11, 5, 107, 151, 339, 961, 1159, 3517, 6819,
+    1, 1, 1, 3, 27, 37, 33, 57, 139, 655, 1031, 1511, 5155,
+    1, 1, 3, 13, 21, 11, 25, 177, 13, 109, 1069, 2971, 7743,
+    1, 1, 3, 15, 3, 63, 19, 129, 231, 103, 517, 1577, 67,
+    1, 3, 1, 13, 7, 55, 39, 69, 305, 947, 1855, 2329, 7093,
+    1, 3, 7, 3, 21, 61, 13, 209, 275, 913, 811, 3609, 2415,
+    1, 1, 5, 11, 13, 51, 111, 13, 91, 963, 135, 3171, 7929,
+    1, 1, 1, 7, 9, 27, 63, 13, 331, 497, 1701, 713, 4167,
+    1, 3, 5, 1, 17, 19, 117, 187, 23, 705, 1433, 1843, 4215,
+    1, 1, 1, 9, 15, 27, 119, 187, 341, 987, 1041, 3019, 3009,
+    1, 1, 5, 7, 31, 53, 55, 81, 271, 817, 511, 2611, 4505,
+    1, 3, 7, 11, 15, 61, 25, 45, 307, 707, 679, 2723, 2969,
+    1, 1, 1, 5, 7, 13, 17, 249, 381, 605, 1713, 2867, 5541,
+    1, 3, 1, 13, 13, 9, 79, 237, 175, 641, 55, 3111, 6943,
+    1, 3, 1, 11, 27, 37, 37, 45, 465, 103, 1325, 23, 2307,
+    1, 3, 7, 15, 15, 33, 43, 91, 67, 797, 1449, 215, 5233,
+    1, 1, 3, 1, 1, 43, 97, 127, 249, 213, 1481, 585, 363,
+    1, 1, 7, 13, 29, 43, 23, 127, 433, 899, 2021, 427, 297,
+    1, 1, 3, 11, 17, 1, 119, 161, 237, 669, 307, 2483, 4017,
+    1, 3, 7, 5, 21, 15, 61, 51, 37, 911, 343, 487, 3417,
+    1, 1, 5, 13, 23, 21, 33, 51, 199, 113, 403, 1527, 3227,
+    1, 1, 5, 7, 17, 15, 31, 217, 365, 103, 839, 1619, 1899,
+    1, 3, 5, 11, 1, 5, 93, 239, 361, 507, 1891, 449, 5951,
+    1, 3, 3, 15, 5, 13, 63, 55, 213, 815, 881, 157, 875,
+    1, 1, 7, 13, 29, 41, 11, 7, 173, 573, 1227, 2387, 2741,
+    1, 1, 5, 7, 25, 9, 85, 91, 305, 711, 15, 131, 5791,
+    1, 3, 7, 15, 7, 7, 91, 155, 85, 591, 1091, 4091, 777,
+    1, 1, 1, 11, 27, 29, 69, 213, 473, 149, 843, 667, 6355,
+    1, 3, 7, 9, 21, 49, 123, 131, 315, 629, 919, 743, 81,
+    1, 1, 5, 9, 11, 29, 63, 39, 107, 969, 1269, 3499, 5387,
+    1, 1, 3, 7, 1, 63, 57, 45, 361, 509, 1303, 2691, 1445,
+    1, 3, 7, 11, 7, 61, 87, 121, 73, 569, 1801, 1829, 6667,
+    1, 1, 7, 3, 21, 3, 47, 103, 485, 745, 1595, 1035, 1569,
+    1, 3, 1, 15, 3, 21, 101, 117, 269, 553, 1473, 3353, 3473,
+    1, 3, 5, 9, 23, 13, 59, 121, 59, 1023, 451, 579, 3557,
+    1, 1, 5, 7, 17, 63, 33, 235, 135, 927, 649, 1499, 865,
+    1, 3, 3, 3, 3, 25, 23, 205, 407, 403, 1425, 767, 4513,
+    1, 3, 3, 5, 29, 59, 95, 49, 145, 661, 487, 2389, 1673,
+    1, 1, 7, 7, 9, 51, 61, 37, 451, 819, 669, 3691, 4629,
+    1, 3, 1, 9, 19, 61, 71, 5, 111, 313, 1697, 759, 6045,
+    1, 3, 3, 13, 31, 21, 23, 89, 187, 657, 525, 415, 1559,
+    1, 1, 7, 9, 1, 33, 15, 195, 123, 771, 1155, 2181, 2995,
+    1, 1, 1, 3, 3, 39, 111, 103, 117, 663, 983, 3969, 4803,
+    1, 1, 1, 13, 17, 31, 85, 123, 483, 747, 1445, 1495, 6375,
+    1, 1, 3, 3, 31, 35, 127, 1, 281, 133, 1563, 289, 3445,
+    1, 3, 1, 11, 17, 25, 83, 155, 107, 879, 697, 2565, 5265,
+    1, 1, 1, 3, 19, 47, 81, 137, 17, 19, 65, 1335, 3775,
+    1, 3, 7, 15, 5, 11, 91, 137, 349, 965, 967, 3045, 237,
+    1, 1, 7, 3, 25, 19, 31, 23, 255, 483, 1035, 2411, 7271,
+    1, 3, 1, 5, 29, 9, 57, 133, 91, 163, 1293, 2551, 5679,
+    1, 3, 1, 3, 11, 45, 65, 43, 273, 395, 359, 857, 7937,
+    1, 1, 7, 11, 23, 31, 75, 133, 351, 605, 1331, 2109, 1353,
+    1, 3, 3, 9, 31, 15, 85, 209, 391, 615, 43, 2683, 3441,
+    1, 3, 1, 5, 3, 3, 69, 129, 373, 9, 449, 2721, 847,
+    1, 1, 3, 13, 13, 57, 123, 7, 231, 83, 579, 2005, 4253,
+    1, 3, 7, 1, 7, 47, 55, 119, 285, 301, 1373, 2887, 4075,
+    1, 1, 7, 15, 1, 53, 9, 163, 159, 377, 379, 3353, 7755,
+    1, 1, 5, 9, 29, 33, 55, 245, 293, 547, 225, 2227, 2073,
+    1, 1, 1, 3, 17, 5, 37, 119, 339, 587, 595, 2739, 1581,
+    1, 3, 1, 1, 25, 11, 91, 43, 399, 825, 1165, 3471, 5073,
+    1, 3, 1, 7, 7, 63, 27, 77, 219, 145, 1615, 1189, 153,
+    1, 3, 7, 3, 9, 7, 29, 149, 383, 509, 403, 2037, 4655,
+    1, 1, 1, 15, 21, 41, 115, 161, 147, 267, 265, 3743, 6491,
+    1, 3, 1, 9, 3, 3, 11, 139, 149, 753, 911, 1813, 7329,
+    1, 1, 3, 3, 3, 21, 127, 37, 81, 793, 1845, 601, 4029,
+    1, 1, 3, 13, 1, 49, 73, 235, 295, 671, 1105, 3999, 5027,
+    1, 3, 7, 15, 5, 13, 71, 85, 1, 915, 937, 663, 5007,
+    1, 1, 5, 11, 19, 55, 71, 85, 491, 1001, 1327, 1873, 1497,
+    1, 1, 1, 11, 5, 45, 69, 127, 389, 555, 1791, 1151, 6277,
+    1, 1, 3, 11, 27, 13, 127, 27, 345, 25, 1193, 1233, 3409,
+    1, 1, 1, 5, 21, 29, 57, 167, 177, 467, 1057, 2867, 7857,
+    1, 1, 7, 13, 15, 51, 85, 23, 285, 207, 1869, 1161, 5895,
+    1, 1, 5, 3, 15, 3, 79, 9, 131, 949, 1533, 2235, 4801,
+    1, 3, 1, 15, 25, 39, 3, 107, 3, 805, 1273, 1353, 5075,
+    1, 1, 5, 11, 15, 43, 53, 221, 499, 599, 1209, 2853, 1431,
+    1, 3, 7, 15, 17, 61, 13, 83, 355, 941, 333, 3271, 6277,
+    1, 1, 7, 3, 11, 9, 127, 187, 225, 875, 599, 639, 1715,
+    1, 1, 3, 13, 11, 3, 97, 113, 245, 19, 2001, 1719, 3305,
+    1, 1, 7, 13, 31, 61, 29, 149, 17, 207, 1157, 3773, 1255,
+    1, 3, 5, 3, 29, 3, 31, 17, 325, 785, 99, 57, 491,
+    1, 3, 1, 15, 29, 57, 85, 171, 49, 383, 2005, 2689, 5243,
+    1, 3, 5, 7, 29, 57, 19, 75, 3, 691, 1693, 881, 3385,
+    1, 3, 1, 1, 27, 5, 51, 7, 191, 115, 1267, 2809, 3579,
+    1, 3, 7, 11, 23, 43, 1, 251, 211, 805, 1217, 3795, 2381,
+    1, 3, 3, 7, 21, 59, 91, 207, 417, 545, 1509, 3633, 1331,
+    1, 1, 7, 1, 25, 31, 103, 251, 369, 223, 1347, 3979, 4983,
+    1, 3, 7, 9, 23, 47, 125, 177, 155, 879, 1075, 1083, 3301,
+    1, 1, 3, 15, 13, 37, 81, 175, 473, 733, 367, 667, 3475,
+    1, 3, 7, 5, 3, 61, 5, 249, 345, 637, 113, 593, 6273,
+    1, 1, 7, 13, 23, 19, 125, 187, 359, 13, 381, 3059, 6237,
+    1, 3, 7, 5, 5, 47, 59, 37, 457, 341, 55, 3201, 2513,
+    1, 3, 7, 3, 19, 53, 83, 41, 501, 95, 933, 1779, 5721,
+    1, 1, 1, 1, 29, 33, 107, 7, 205, 995, 1785, 1903, 8155,
+    1, 3, 7, 5, 29, 1, 75, 51, 163, 679, 477, 2081, 6267,
+    1, 1, 7, 5, 31, 61, 83, 63, 437, 259, 921, 817, 5121,
+    1, 3, 7, 5, 23, 43, 75, 131, 29, 651, 1071, 3467, 397,
+    1, 3, 5, 9, 21, 59, 49, 7, 73, 133, 679, 1005, 8105,
+    1, 3, 5, 11, 13, 61, 49, 111, 385, 979, 1345, 2321, 7629,
+    1, 1, 7, 15, 3, 25, 121, 213, 117, 877, 1637, 297, 3405,
+    1, 1, 1, 9, 1, 27, 53, 157, 259, 693, 915, 215, 991,
+    1, 1, 5, 13, 5, 37, 83, 51, 271, 641, 717, 1649, 3243,
+    1, 1, 5, 13, 13, 55, 13, 53, 123, 913, 1651, 703, 1829,
+    1, 1, 1, 3, 7, 3, 125, 185, 361, 271, 1821, 1349, 6239,
+    1, 3, 3, 3, 29, 5, 37, 253, 459, 469, 1123, 3275, 3083,
+    1, 1, 3, 7, 15, 41, 93, 95, 443, 775, 1957, 1139, 3111,
+    1, 1, 7, 5, 7, 55, 63, 227, 397, 515, 605, 443, 2345,
+    1, 1, 7, 1, 3, 39, 109, 195, 271, 779, 225, 3607, 6315,
+    1, 1, 5, 9, 13, 61, 67, 197, 273, 295, 971, 3819, 2445,
+    1, 3, 1, 1, 9, 9, 7, 67, 497, 155, 411, 1855, 6725,
+    1, 1, 3, 15, 29, 37, 55, 133, 197, 557, 1355, 3363, 3335,
+    1, 3, 1, 5, 13, 17, 29, 223, 471, 213, 323, 2697, 7605,
+    1, 3, 3, 7, 13, 21, 95, 31, 131, 759, 1927, 2037, 5703,
+    1, 1, 1, 5, 11, 35, 51, 1, 99, 455, 951, 943, 7067,
+    1, 1, 5, 13, 19, 31, 3, 25, 33, 653, 199, 1483, 1819,
+    1, 1, 7, 15, 19, 43, 71, 251, 45, 27, 1943, 1217, 7019,
+    1, 1, 1, 5, 13, 25, 59, 237, 485, 541, 1527, 2003, 2999,
+    1, 1, 5, 5, 29, 43, 123, 215, 59, 355, 971, 2199, 7463,
+    1, 3, 3, 9, 1, 3, 79, 179, 203, 275, 523, 3553, 985,
+    1, 3, 1, 11, 21, 5, 71, 243, 479, 183, 1869, 783, 6167,
+    1, 3, 7, 9, 7, 45, 71, 217, 483, 975, 1039, 3437, 7279,
+    1, 3, 5, 9, 25, 1, 15, 171, 277, 579, 1949, 1319, 4771,
+    1, 3, 3, 9, 9, 33, 75, 217, 427, 137, 899, 207, 565,
+    1, 1, 3, 1, 11, 15, 127, 7, 181, 409, 643, 1347, 7973,
+    1, 1, 7, 11, 23, 37, 3, 105, 307, 691, 677, 2619, 1317,
+    1, 1, 5, 5, 5, 35, 93, 77, 57, 863, 1631, 2775, 1249,
+    1, 1, 7, 13, 19, 11, 53, 255, 331, 77, 1589, 3951, 7105,
+    1, 3, 5, 3, 29, 51, 19, 137, 233, 229, 1781, 1987, 6845,
+    1, 3, 5, 7, 19, 21, 95, 69, 511, 195, 1823, 1415, 7567,
+    1, 3, 5, 13, 11, 11, 63, 125, 435, 787, 319, 3011, 3421,
+    1, 1, 7, 5, 17, 53, 11, 125, 223, 813, 1019, 4093, 2603,
+    1, 1, 5, 9, 23, 19, 69, 245, 229, 939, 2031, 1623, 185,
+    1, 3, 7, 5, 15, 63, 33, 231, 497, 651, 363, 3489, 1827,
+    1, 3, 7, 13, 13, 23, 3, 167, 481, 73, 221, 3333, 5387,
+    1, 3, 3, 11, 5, 17, 11, 199, 225, 243, 1325, 3571, 5053,
+    1, 3, 5, 7, 23, 49, 43, 61, 489, 435, 1355, 681, 3059,
+    1, 1, 5, 11, 9, 3, 13, 197, 281, 485, 805, 1829, 1243,
+    1, 1, 3, 3, 29, 43, 97, 223, 433, 131, 361, 3833, 2519,
+    1, 1, 1, 11, 27, 3, 7, 75, 315, 393, 289, 259, 3067,
+    1, 1, 5, 13, 19, 31, 83, 73, 217, 819, 35, 2923, 7199,
+    1, 3, 3, 13, 13, 39, 31, 31, 67, 493, 887, 1803, 1731,
+    1, 3, 7, 15, 13, 9, 127, 9, 159, 485, 825, 4095, 465,
+    1, 3, 7, 15, 13, 43, 57, 139, 185, 501, 713, 2287, 7889,
+    1, 1, 3, 5, 19, 45, 33, 155, 245, 685, 1565, 2249, 6109,
+    1, 3, 1, 1, 11, 47, 115, 69, 481, 441, 1499, 3273, 2855,
+    1, 3, 5, 7, 3, 51, 73, 27, 361, 505, 865, 941, 8005,
+    1, 3, 3, 11, 25, 17, 15, 53, 455, 79, 1869, 2205, 1565,
+    1, 3, 1, 1, 3, 9, 7, 119, 103, 5, 1539, 351, 5981,
+    1, 1, 5, 1, 5, 13, 35, 119, 249, 237, 645, 3853, 789,
+    1, 1, 1, 15, 1, 57, 71, 83, 25, 513, 1269, 2169, 1731,
+    1, 3, 1, 9, 31, 43, 3, 13, 447, 871, 873, 3789, 6875,
+    1, 1, 1, 7, 19, 31, 41, 139, 289, 155, 969, 2927, 8137,
+    1, 3, 3, 15, 1, 47, 35, 121, 475, 533, 321, 201, 1017,
+    1, 3, 5, 3, 17, 23, 35, 143, 167, 789, 365, 4023, 6157,
+    1, 1, 7, 11, 1, 47, 29, 113, 453, 1015, 517, 3275, 3979,
+    1, 3, 3, 1, 9, 23, 15, 47, 423, 669, 833, 3349, 7669,
+    1, 3, 7, 5, 31, 1, 73, 233, 497, 31, 397, 3915, 1125,
+    1, 1, 7, 1, 21, 11, 73, 65, 473, 47, 391, 597, 5877,
+    1, 3, 7, 7, 21, 7, 109, 101, 63, 817, 3, 2041, 1317,
+    1, 3, 7, 7, 15, 17, 47, 131, 117, 589, 677, 1701, 4707,
+    1, 1, 5, 11, 15, 49, 51, 47, 215, 725, 1747, 2397, 5893,
+    1, 3, 7, 1, 7, 33, 73, 237, 275, 397, 1133, 2717, 2983,
+    1, 3, 5, 9, 27, 39, 121, 7, 111, 963, 817, 1429, 5229,
+    1, 1, 5, 7, 25, 3, 35, 5, 261, 645, 659, 1647, 745,
+    1, 1, 1, 13, 7, 29, 103, 253, 423, 933, 179, 187, 1961,
+    1, 1, 7, 15, 31, 53, 107, 237, 381, 413, 301, 3249, 133,
+    1, 3, 3, 7, 29, 41, 13, 45, 319, 897, 1225, 3579, 3705,
+    1, 3, 3, 11, 15, 63, 101, 45, 95, 395, 1231, 2881, 539,
+    1, 1, 3, 13, 7, 31, 85, 95, 409, 221, 1011, 1841, 7433,
+    1, 3, 5, 1, 1, 35, 53, 203, 147, 747, 361, 89, 2303,
+    1, 1, 5, 3, 3, 21, 31, 255, 373, 437, 1931, 769, 3261,
+    1, 1, 7, 1, 9, 49, 37, 207, 241, 869, 239, 1359, 2701,
+    1, 1, 7, 3, 25, 13, 67, 91, 93, 399, 355, 3597, 4125,
+    1, 3, 3, 13, 13, 19, 83, 183, 241, 225, 207, 307, 943,
+    1, 1, 3, 11, 29, 15, 123, 241, 349, 851, 419, 1405, 1459,
+    1, 3, 7, 1, 3, 55, 11, 235, 395, 593, 1809, 2097, 2455,
+    1, 3, 1, 11, 31, 9, 127, 157, 269, 999, 1253, 3971, 7491,
+    1, 3, 5, 3, 11, 29, 9, 129, 61, 177, 1975, 2779, 975,
+    1, 1, 5, 13, 27, 51, 123, 9, 367, 137, 293, 1785, 4267,
+    1, 1, 3, 1, 5, 17, 35, 165, 99, 409, 607, 2201, 2577,
+    1, 3, 1, 9, 9, 31, 61, 207, 387, 693, 1235, 4025, 3271,
+    1, 1, 7, 15, 13, 43, 59, 217, 419, 37, 1459, 3545, 8065,
+    1, 3, 1, 11, 31, 63, 93, 69, 185, 57, 1533, 2627, 6209,
+    1, 1, 7, 13, 3, 27, 9, 43, 291, 403, 971, 573, 3995,
+    1, 1, 1, 7, 31, 41, 65, 93, 7, 311, 1449, 417, 2139,
+    1, 3, 1, 1, 17, 11, 61, 113, 511, 327, 1973, 767, 3927,
+    1, 1, 1, 1, 1, 15, 67, 133, 485, 941, 565, 1297, 7897,
+    1, 1, 7, 5, 3, 33, 89, 41, 31, 217, 2013, 2195, 1341,
+    1, 1, 3, 13, 27, 41, 51, 169, 481, 873, 1403, 777, 7821,
+    1, 3, 1, 3, 7, 61, 117, 101, 397, 93, 405, 3631, 15,
+    1, 1, 1, 13, 19, 13, 51, 111, 25, 661, 471, 313, 1663,
+    1, 3, 1, 5, 29, 61, 91, 151, 131, 157, 943, 1791, 4207,
+    1, 3, 3, 5, 11, 19, 27, 127, 61, 99, 863, 3889, 665,
+    1, 1, 1, 3, 9, 41, 61, 31, 499, 293, 323, 563, 1717,
+    1, 1, 7, 1, 9, 31, 83, 179, 129, 823, 125, 3225, 1171,
+    1, 1, 7, 1, 21, 31, 77, 11, 145, 687, 37, 1547, 8109,
+    1, 3, 7, 3, 7, 31, 79, 131, 135, 817, 445, 3695, 6225,
+    1, 3, 1, 13, 7, 5, 1, 169, 303, 19, 1851, 393, 2099,
+    1, 3, 7, 7, 31, 57, 23, 219, 57, 985, 1843, 135, 6097,
+    1, 1, 1, 11, 13, 35, 97, 147, 379, 473, 751, 1269, 1835,
+    1, 1, 1, 1, 15, 63, 47, 141, 11, 603, 1167, 2017, 129,
+    1, 3, 1, 7, 31, 15, 103, 213, 87, 45, 1777, 3577, 2049,
+    1, 1, 1, 11, 13, 37, 77, 125, 221, 267, 1503, 3999, 3941,
+    1, 1, 7, 1, 29, 33, 19, 91, 181, 143, 1837, 2951, 2379,
+    1, 3, 3, 15, 9, 45, 9, 183, 355, 321, 167, 2269, 6269,
+    1, 3, 1, 9, 19, 11, 105, 155, 149, 53, 601, 2827, 3525,
+    1, 3, 7, 3, 17, 11, 107, 79, 25, 659, 1693, 1645, 7925,
+    1, 3, 3, 11, 11, 61, 45, 35, 113, 635, 935, 3625, 1985,
+    1, 1, 1, 13, 31, 45, 17, 119, 301, 49, 1659, 2449, 3271,
+    1, 1, 5, 5, 11, 17, 69, 35, 335, 547, 873, 2087, 603,
+    1, 3, 5, 13, 19, 19, 89, 139, 399, 425, 1963, 849, 5597,
+    1, 1, 3, 15, 1, 53, 107, 155, 421, 581, 1005, 2675, 6985,
+    1, 3, 7, 3, 13, 33, 15, 65, 401, 603, 1661, 2995, 4127,
+    1, 3, 1, 13, 15, 11, 39, 129, 177, 9, 1417, 665, 4473,
+    1, 1, 7, 3, 9, 19, 55, 249, 141, 469, 1875, 4085, 2967,
+    1, 1, 5, 15, 5, 9, 71, 31, 37, 243, 1069, 365, 2429,
+    1, 1, 1, 7, 29, 7, 53, 47, 245, 209, 229, 509, 3705,
+    1, 1, 5, 11, 9, 23, 75, 181, 151, 233, 1245, 3719, 6917,
+    1, 1, 1, 3, 13, 53, 97, 169, 411, 141, 1949, 143, 5619,
+    1, 1, 1, 7, 13, 25, 59, 101, 481, 309, 643, 2989, 1405,
+    1, 1, 5, 11, 5, 9, 9, 43, 101, 529, 141, 2509, 1769,
+    1, 3, 3, 9, 13, 3, 113, 91, 315, 449, 1867, 1543, 5261,
+    1, 1, 7, 5, 29, 21, 107, 119, 331, 421, 1751, 2341, 8131,
+    1, 3, 7, 3, 7, 17, 33, 255, 47, 323, 41, 619, 659,
+    1, 1, 1, 1, 31, 43, 49, 3, 507, 259, 1361, 2181, 2047,
+    1, 3, 1, 15, 27, 51, 43, 179, 219, 217, 1495, 1341, 2417,
+    1, 3, 5, 1, 23, 39, 105, 15, 405, 987, 49, 1569, 5987,
+    1, 1, 1, 5, 31, 37, 7, 197, 371, 451, 1753, 2037, 2177,
+    1, 1, 1, 7, 13, 15, 115, 187, 333, 211, 373, 153, 2635,
+    1, 3, 5, 3, 25, 35, 101, 29, 107, 935, 949, 2417, 4423,
+    1, 3, 3, 1, 29, 3, 107, 235, 359, 439, 141, 1151, 6879,
+    1, 1, 7, 1, 3, 31, 35, 157, 3, 307, 793, 3485, 6631,
+    1, 3, 5, 11, 15, 3, 39, 219, 161, 141, 373, 1279, 5563,
+    1, 3, 7, 1, 23, 23, 45, 169, 219, 303, 1089, 1067, 1535,
+    1, 3, 3, 15, 13, 35, 71, 157, 97, 155, 1273, 1605, 43,
+    1, 1, 7, 13, 13, 23, 45, 91, 313, 911, 599, 2075, 1279,
+    1, 3, 7, 3, 19, 31, 125, 91, 363, 629, 577, 25, 1279,
+    1, 3, 5, 3, 5, 47, 111, 157, 107, 861, 629, 977, 1651,
+    1, 1, 1, 7, 29, 41, 33, 53, 73, 83, 1929, 2473, 357,
+    1, 1, 3, 11, 31, 13, 29, 7, 167, 573, 1527, 1695, 6715,
+    1, 3, 7, 11, 13, 53, 11, 89, 217, 137, 527, 2711, 2057,
+    1, 3, 5, 5, 21, 49, 55, 221, 355, 281, 299, 495, 3083,
+    1, 3, 7, 11, 17, 15, 35, 33, 321, 259, 441, 3379, 5245,
+    1, 1, 5, 3, 5, 27, 115, 177, 127, 417, 577, 787, 7177,
+    1, 3, 5, 15, 13, 3, 59, 239, 269, 805, 889, 3625, 2363,
+    1, 3, 3, 9, 27, 35, 65, 35, 409, 549, 1555, 41, 3517,
+    1, 3, 3, 15, 1, 3, 33, 227, 161, 203, 521, 571, 8075,
+    1, 1, 1, 1, 19, 61, 63, 151, 215, 117, 1295, 2375, 4667,
+    1, 1, 5, 7, 7, 35, 97, 159, 107, 219, 1277, 1793, 7217,
+    1, 1, 5, 11, 31, 13, 13, 57, 265, 1003, 1881, 2155, 1343,
+    1, 3, 5, 3, 7, 13, 111, 227, 411, 875, 1589, 3511, 7635,
+    1, 3, 7, 11, 25, 43, 5, 25, 163, 567, 315, 3215, 1059,
+    1, 3, 5, 13, 23, 33, 23, 137, 203, 1013, 133, 1097, 7233,
+    1, 1, 7, 11, 27, 57, 3, 225, 309, 295, 987, 993, 4567,
+    1, 3, 1, 11, 19, 9, 119, 63, 337, 347, 1857, 1695, 5995,
+    1, 1, 7, 15, 5, 45, 95, 151, 365, 609, 817, 2833, 5803,
+    1, 1, 1, 9, 3, 59, 61, 217, 453, 679, 589, 3479, 6917,
+    1, 3, 1, 7, 9, 39, 71, 81, 83, 463, 427, 953, 3895,
+    1, 1, 5, 11, 19, 23, 57, 195, 183, 985, 1275, 1787, 4411,
+    1, 3, 1, 7, 21, 17, 127, 137, 95, 139, 1645, 1921, 6165,
+    1, 3, 7, 5, 21, 63, 119, 67, 107, 567, 1085, 2327, 3685,
+    1, 3, 1, 11, 17, 43, 31, 155, 301, 989, 2019, 931, 5139,
+    1, 1, 5, 5, 1, 11, 123, 57, 327, 933, 1939, 2707, 8015,
+    1, 1, 5, 5, 27, 17, 83, 179, 89, 729, 1085, 2801, 7737,
+    1, 1, 1, 13, 21, 43, 41, 15, 29, 511, 351, 825, 5761,
+    1, 3, 3, 13, 29, 1, 95, 183, 133, 715, 1603, 2331, 5643,
+    1, 3, 5, 15, 11, 33, 7, 107, 375, 853, 459, 1971, 3561,
+    1, 3, 1, 3, 31, 31, 65, 27, 463, 337, 1393, 3869, 6433,
+    1, 1, 7, 3, 29, 59, 57, 167, 391, 965, 1107, 3631, 2303,
+    1, 3, 7, 9, 13, 7, 71, 245, 29, 939, 1145, 753, 383,
+    1, 1, 1, 9, 19, 53, 89, 227, 79, 669, 457, 2621, 7001,
+    1, 3, 5, 1, 21, 17, 95, 59, 509, 703, 1255, 3163, 5019,
+    1, 3, 5, 3, 25, 29, 51, 101, 123, 711, 1917, 3321, 1689,
+    1, 1, 1, 5, 13, 1, 7, 57, 189, 221, 1445, 3143, 2705,
+    1, 3, 7, 11, 13, 61, 57, 21, 231, 637, 35, 915, 3879,
+    1, 1, 7, 5, 7, 43, 31, 123, 253, 533, 1993, 1051, 6399,
+    1, 1, 3, 15, 25, 61, 9, 67, 135, 779, 1049, 369, 2591,
+    1, 3, 7, 7, 3, 21, 105, 141, 121, 83, 1607, 4033, 4209,
+    1, 1, 5, 3, 31, 21, 13, 189, 397, 389, 1455, 3129, 1021,
+    1, 3, 7, 11, 23, 13, 23, 67, 419, 765, 433, 875, 681,
+    1, 1, 3, 9, 7, 49, 91, 101, 175, 43, 1183, 1009, 7965,
+    1, 1, 5, 5, 11, 45, 89, 195, 281, 401, 1173, 3303, 6427,
+    1, 1, 7, 3, 3, 1, 97, 175, 309, 515, 1751, 4037, 3183,
+    1, 3, 7, 11, 17, 47, 75, 139, 59, 89, 1227, 57, 6687,
+    1, 1, 1, 7, 15, 35, 61, 229, 83, 945, 1957, 2197, 4837,
+    1, 3, 5, 11, 5, 37, 3, 253, 9, 853, 421, 2721, 7229,
+    1, 1, 5, 5, 21, 15, 95, 235, 177, 851, 735, 3865, 6381,
+    1, 3, 7, 5, 31, 13, 21, 23, 267, 177, 1475, 1247, 727,
+    1, 1, 3, 1, 9, 39, 41, 35, 197, 183, 1825, 1907, 7985,
+    1, 3, 3, 3, 19, 51, 91, 181, 185, 719, 559, 3161, 6065,
+    1, 1, 5, 15, 27, 3, 99, 213, 29, 667, 2031, 3529, 6049,
+    1, 3, 1, 11, 5, 21, 19, 193, 119, 731, 1149, 205, 3341,
+    1, 3, 3, 9, 25, 53, 45, 57, 159, 369, 1941, 305, 5071,
+    1, 3, 5, 9, 31, 11, 25, 105, 249, 591, 1849, 59, 3929,
+    1, 1, 5, 7, 15, 57, 81, 93, 427, 99, 443, 2715, 503,
+    1, 3, 5, 13, 1, 27, 93, 25, 361, 643, 449, 3209, 8069,
+    1, 3, 3, 15, 1, 17, 97, 229, 331, 529, 1101, 1661, 751,
+    1, 3, 7, 5, 21, 23, 119, 197, 177, 489, 1983, 2251, 1547,
+    1, 3, 1, 11, 19, 39, 45, 147, 315, 601, 1075, 2345, 7173,
+    1, 3, 5, 11, 9, 13, 7, 151, 103, 801, 1163, 3783, 3719,
+    1, 1, 7, 15, 1, 37, 123, 219, 381, 165, 1833, 631, 6499,
+    1, 3, 3, 15, 17, 17, 29, 247, 337, 17, 1503, 4085, 3413,
+    1, 1, 7, 15, 7, 15, 67, 255, 419, 131, 467, 1363, 5221,
+    1, 3, 5, 7, 1, 53, 31, 183, 409, 135, 1849, 19, 577,
+    1, 1, 3, 11, 27, 51, 87, 117, 451, 95, 1177, 2117, 3221,
+    1, 1, 7, 13, 21, 53, 111, 33, 377, 983, 1349, 2109, 2045,
+    1, 3, 5, 13, 31, 45, 77, 77, 319, 541, 527, 361, 249,
+    1, 3, 1, 3, 15, 45, 59, 113, 279, 143, 169, 605, 4193,
+    1, 3, 7, 1, 1, 51, 19, 205, 97, 653, 1411, 3131, 883,
+    1, 1, 1, 1, 29, 61, 13, 213, 445, 955, 1865, 133, 2305,
+    1, 1, 7, 3, 29, 25, 85, 229, 503, 613, 953, 489, 1335,
+    1, 3, 1, 9, 23, 25, 49, 183, 79, 839, 801, 3743, 3687,
+    1, 1, 3, 3, 19, 45, 9, 59, 297, 651, 1125, 2199, 327,
+    1, 1, 1, 9, 23, 59, 119, 117, 39, 159, 1749, 3239, 2719,
+    1, 3, 3, 5, 3, 23, 93, 47, 49, 285, 1801, 3095, 5203,
+    1, 1, 5, 11, 23, 9, 89, 237, 405, 749, 1083, 1217, 723,
+    1, 3, 5, 5, 3, 37, 71, 49, 57, 221, 659, 53, 3637,
+    1, 1, 3, 1, 15, 61, 123, 111, 297, 131, 439, 2139, 373,
+    1, 3, 1, 3, 11, 61, 55, 117, 63, 895, 785, 27, 3965,
+    1, 1, 5, 7, 13, 51, 73, 85, 173, 679, 457, 333, 5293,
+    1, 3, 3, 15, 25, 25, 99, 211, 63, 379, 1351, 3005, 6419,
+    1, 3, 3, 1, 19, 27, 77, 101, 187, 469, 1083, 2635, 5659,
+    1, 1, 5, 13, 13, 63, 71, 165, 213, 1001, 1891, 943, 3577,
+    1, 1, 5, 11, 1, 63, 77, 175, 133, 691, 1087, 3829, 3933,
+    1, 1, 1, 9, 11, 17, 47, 33, 477, 297, 1727, 269, 389,
+    1, 1, 1, 15, 1, 7, 75, 61, 153, 519, 2021, 1591, 3083,
+    1, 3, 1, 15, 21, 35, 59, 1, 195, 423, 981, 2573, 2771,
+    1, 3, 3, 13, 5, 31, 115, 7, 433, 91, 1409, 3753, 4651,
+    1, 3, 1, 5, 29, 51, 121, 175, 211, 875, 61, 1549, 6903,
+    1, 3, 1, 1, 3, 33, 13, 135, 431, 77, 59, 1343, 6959,
+    1, 3, 7, 9, 7, 5, 7, 91, 151, 431, 1223, 2825, 3267,
+    1, 1, 5, 1, 9, 11, 21, 97, 313, 61, 1323, 2243, 1451,
+    1, 1, 1, 11, 23, 35, 55, 69, 359, 941, 1375, 2531, 1025,
+    1, 1, 7, 1, 5, 27, 67, 219, 283, 483, 471, 395, 7781,
+    1, 3, 7, 3, 13, 47, 57, 45, 179, 321, 1981, 565, 2503,
+    1, 3, 7, 9, 7, 21, 35, 19, 103, 295, 191, 119, 6049,
+    1, 3, 3, 15, 29, 11, 43, 225, 243, 9, 111, 2849, 6273,
+    1, 1, 5, 7, 3, 15, 119, 241, 43, 509, 1841, 3861, 187,
+    1, 3, 1, 3, 21, 13, 61, 49, 467, 119, 119, 3829, 2779,
+    1, 3, 5, 13, 17, 13, 89, 93, 179, 821, 783, 3947, 6743,
+    1, 1, 1, 11, 29, 19, 49, 145, 127, 89, 257, 2931, 5657,
+    1, 1, 5, 11, 21, 51, 113, 95, 77, 423, 995, 1863, 4167,
+    1, 1, 7, 9, 31, 23, 73, 77, 439, 347, 1907, 2527, 7351,
+};
+static const size_t SobolInitialSize =
+    sizeof(SobolInitial)/sizeof(SobolInitial[0]);
+
+// direction numbers of all dimensions, built on first use
+class SobolDirections
+{
+public:
+    static const SobolDirections &tables() {
+        static const SobolDirections directions;
+        return(directions);
+    }
+
+    // v(j,k), direction number k of dimension j
+    const uint64_t *operator[](unsigned int j) const {
+        return(&v_[64*j]);
+    }
+
+protected:
+    SobolDirections();
+
+    // x**e mod p over GF(2), p of degree s
+    static uint64_t powMod(uint64_t e, uint64_t p, unsigned int s);
+    static bool primitive(uint64_t p, unsigned int s);
+
+    // data
+    std::vector<uint64_t> v_;
+};
+
+uint64_t
+SobolDirections::powMod(uint64_t e, uint64_t p, unsigned int s)
+{
+    uint64_t top = uint64_t(1) << s;
+    uint64_t r = 1;
+    uint64_t b = 2;
+    while (e > 0)
+    {
+        if (e & 1)
+        {
+            uint64_t t = 0;
+            for (unsigned int i=0; i<s; ++i)
+            {
+                if ((b >> i) & 1) t ^= r << i;
+            }
+            for (int i=2*s-2; i>=int(s); --i)
+            {
+                if ((t >> i) & 1) t ^= p << (i-s);
+            }
+            r = t;
+        }
+        uint64_t t = 0;
+        for (unsigned int i=0; i<s; ++i)
+        {
+            if ((b >> i) & 1) t ^= b << i;
+        }
+        for (int i=2*s-2; i>=int(s); --i)
+        {
+            if ((t >> i) & 1) t ^= p << (i-s);
+        }
+        b = t & (top-1);
+        e >>= 1;
+    }
+    return(r);
+}
+
+// x has order 2**s-1, checked against every prime factor
+bool
+SobolDirections::primitive(uint64_t p, unsigned int s)
+{
+    uint64_t order = (uint64_t(1) << s) - 1;
+    if (powMod(order, p, s) != 1) return(false);
+    uint64_t rest = order;
+    for (uint64_t q=3; q<=rest; q+=2)
+    {
+        if (rest%q != 0) continue;
+        if (powMod(order/q, p, s) == 1) return(false);
+        while (rest%q == 0) rest /= q;
+    }
+    return(true);
+}
+
+SobolDirections::SobolDirections():
+    v_(64*Sobol::MaxDimensions, 0)
+{
+    // van der corput
+    for (unsigned int k=0; k<64; ++k)
+    {
+        v_[k] = uint64_t(1) << (63-k);
+    }
+
+    size_t next = 0;
+    unsigned int j = 1;
+    for (unsigned int s=1; j<Sobol::MaxDimensions; ++s)
+    {
+        for (uint64_t a=0; a<(uint64_t(1) << (s-1)) &&
+             j<Sobol::MaxDimensions; ++a)
+        {
+            uint64_t p = (uint64_t(1) << s) | (a << 1) | 1;
+            if (s > 1 && !primitive(p, s)) continue;
+
+            // initial direction numbers
+            uint64_t *v = &v_[64*j];
+            for (unsigned int k=0; k<s; ++k)
+            {
+                MustBeTrue(next < SobolInitialSize);
+                uint64_t m = SobolInitial[next++];
+                v[k] = m << (63-k);
+            }
+
+            // recurrence for the rest
+            for (unsigned int k=s; k<64; ++k)
+            {
+                uint64_t x = v[k-s] ^ (v[k-s] >> s);
+                for (unsigned int i=1; i<s; ++i)
+                {
+                    if ((a >> (s-1-i)) & 1) x ^= v[k-i];
+                }
+                v[k] = x;
+            }
+            ++j;
+        }
+    }
+    MustBeTrue(next == SobolInitialSize);
+}
+
+// ctors and dtor
+Sobol::Sobol():
+    dimensions_(1), scramble_(true), index_(0), coord_(0),
+    x_(1, 0), seeds_(1, 0)
+{
+    setKey(0);
+}
+
+Sobol::Sobol(unsigned long newKey, unsigned int dimensions, bool scramble):
+    dimensions_(dimensions), scramble_(scramble), index_(0), coord_(0),
+    x_(), seeds_()
+{
+    MustBeTrue(dimensions_ > 0 && dimensions_ <= MaxDimensions);
+    x_.resize(dimensions_, 0);
+    seeds_.resize(dimensions_, 0);
+    setKey(newKey);
+}
+
+Sobol::Sobol(const Sobol &src):
+    dimensions_(src.dimensions_), scramble_(src.scramble_),
+    index_(src.index_), coord_(src.coord_), x_(src.x_),
+    seeds_(src.seeds_)
+{
+}
+
+Sobol::~Sobol() { }
+
+// assignment
+Sobol &
+Sobol::operator=(const Sobol &rhs)
+{
+    if (this != &rhs)
+    {
+        dimensions_ = rhs.dimensions_;
+        scramble_ = rhs.scramble_;
+        index_ = rhs.index_;
+        coord_ = rhs.coord_;
+        x_ = rhs.x_;
+        seeds_ = rhs.seeds_;
+    }
+    return(*this);
+}
+
+// operations
+void
+Sobol::setKey(unsigned long newKey)
+{
+    SobolDirections::tables();
+    SplitMix64 sm(newKey);
+    for (unsigned int j=0; j<dimensions_; ++j)
+    {
+        seeds_[j] = sm.next();
+    }
+    seek(0, 0);
+}
+
+// next point in gray code order
+void
+Sobol::next()
+{
+    const SobolDirections &v = SobolDirections::tables();
+    ++index_;
+    int k = __builtin_ctzll(index_);
+    for (unsigned int j=0; j<dimensions_; ++j)
+    {
+        x_[j] ^= v[j][k];
+    }
+    coord_ = 0;
+}
+
+// move to a coordinate of a point
+void
+Sobol::seek(uint64_t point, unsigned int coord)
+{
+    const SobolDirections &v = SobolDirections::tables();
+    uint64_t gray = point ^ (point >> 1);
+    for (unsigned int j=0; j<dimensions_; ++j)
+    {
+        uint64_t x = 0;
+        for (uint64_t g=gray; g!=0; g&=g-1)
+        {
+            x ^= v[j][__builtin_ctzll(g)];
+        }
+        x_[j] = x;
+    }
+    index_ = point;
+    coord_ = coord;
+}
+
+// jumps
+void
+Sobol::jump(uint64_t n)
+{
+    unsigned __int128 value =
+        (unsigned __int128)index_*dimensions_ + coord_ + n;
+    seek(uint64_t(value/dimensions_), unsigned(value%dimensions_));
+}
+
+void
+Sobol::jumpSubstreams(uint64_t i)
+{
+    if (i == 0) return;
+    seek(index_ + (i << SobolSubstreamBits), coord_);
+}
+
+Sobol
+Sobol::substream(uint64_t i) const
+{
+    Sobol stream(*this);
+    stream.jumpSubstreams(i);
+    return(stream);
+}
+
+std::vector<Sobol>
+Sobol::split(unsigned int k) const
+{
+    std::vector<Sobol> streams;
+    streams.reserve(k);
+    for (unsigned int i=0; i<k; ++i)
+    {
+        streams.push_back(substream(i));
+    }
+    return(streams);
+}
+
+}
@@ -0,0 +1,262 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// xoshiro256** pseudo-random number generator
+//
+// the 256-bit state is filled from the key using splitmix64,
+// as recommended by the authors, so any key (including 0) gives
+// a valid, non-zero state.
+//
+// jumping ahead. the state update is linear over GF(2), s' = T*s.
+// if p(x) is the characteristic polynomial of T, then p(T) = 0, so
+// T**n = r(T) where r(x) = x**n mod p(x), and r has degree < 256.
+// T**n*s = sum of r_i*T**i*s is then 256 steps of the generator,
+// xor-ing in the state for each non-zero coefficient. p(x) is found
+// once with berlekamp-massey from a run of state bits, x**n mod p(x)
+// by square-and-multiply, so a jump is O(log n).
+
+// headers
+#include "system/Debug.h"
+#include "hdr/Xoshiro256.h"
+#include "random/SplitMix64.h"
+
+namespace ombt {
+
+// x**(2**128) mod p(x), the published jump polynomial
+static const uint64_t Xoshiro256JumpPoly[4] = {
+    0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 
+    0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL
+};
+
+// polynomials over GF(2). bit j of word i is the coefficient of 
+// x**(64*i+j). the characteristic polynomial has degree 256 and
+// needs a fifth word.
+struct Xoshiro256CharPoly {
+    uint64_t p_[5];
+
+    Xoshiro256CharPoly() {
+        // run of 512 state bits from an arbitrary non-zero state.
+        // only the linear state update of random() is needed.
+        const int nbits = 512;
+        unsigned char bits[nbits];
+        uint64_t s[4] = { 1, 2, 3, 4 };
+        for (int n=0; n<nbits; ++n)
+        {
+            bits[n] = (unsigned char)(s[0] & 1);
+            uint64_t t = s[1] << 17;
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+            s[2] ^= t;
+            s[3] = (s[3] << 45) | (s[3] >> 19);
+        }
+
+        // berlekamp-massey, connection polynomial c and previous b.
+        unsigned char c[nbits+1], b[nbits+1], t[nbits+1];
+        for (int i=0; i<=nbits; ++i) c[i] = b[i] = 0;
+        c[0] = b[0] = 1;
+        int L = 0;
+        int m = 1;
+        for (int n=0; n<nbits; ++n)
+        {
+            unsigned char d = bits[n];
+            for (int i=1; i<=L; ++i) d ^= c[i] & bits[n-i];
+            if (d == 0)
+            {
+                ++m;
+            }
+            else if (2*L <= n)
+            {
+                for (int i=0; i<=nbits; ++i) t[i] = c[i];
+                for (int i=0; i+m<=nbits; ++i) c[i+m] ^= b[i];
+                L = n+1-L;
+                for (int i=0; i<=nbits; ++i) b[i] = t[i];
+                m = 1;
+            }
+            else
+            {
+                for (int i=0; i+m<=nbits; ++i) c[i+m] ^= b[i];
+                ++m;
+            }
+        }
+        MustBeTrue(L == 256);
+
+        // p(x) is the reciprocal of c(x): p(x) = x**L*c(1/x)
+        for (int i=0; i<5; ++i) p_[i] = 0;
+        for (int i=0; i<=L; ++i)
+        {
+            if (c[i]) p_[(L-i)/64] |= 1ULL << ((L-i)%64);
+        }
+    }
+};
+
+static const Xoshiro256CharPoly &
+xoshiro256CharPoly()
+{
+    static const Xoshiro256CharPoly charpoly;
+    return(charpoly);
+}
+
+// r = a*b mod p over GF(2)
+static void
+polyMulMod(const uint64_t a[4], const uint64_t b[4], uint64_t r[4])
+{
+    const uint64_t *p = xoshiro256CharPoly().p_;
+
+    uint64_t prod[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    for (int j=0; j<256; ++j)
+    {
+        if ((b[j/64] >> (j%64)) & 1)
+        {
+            int ws = j/64;
+            int bs = j%64;
+            for (int i=0; i<4; ++i)
+            {
+                prod[i+ws] ^= a[i] << bs;
+                if (bs != 0) prod[i+ws+1] ^= a[i] >> (64-bs);
+            }
+        }
+    }
+
+    for (int d=510; d>=256; --d)
+    {
+        if ((prod[d/64] >> (d%64)) & 1)
+        {
+            int ws = (d-256)/64;
+            int bs = (d-256)%64;
+            for (int i=0; i<5 && i+ws<8; ++i)
+            {
+                prod[i+ws] ^= p[i] << bs;
+                if (bs != 0 && i+ws+1 < 8) prod[i+ws+1] ^= p[i] >> (64-bs);
+            }
+        }
+    }
+
+    for (int i=0; i<4; ++i) r[i] = prod[i];
+}
+
+// r = base**e mod p
+static void
+polyPowMod(const uint64_t base[4], uint64_t e, uint64_t r[4])
+{
+    uint64_t b[4] = { base[0], base[1], base[2], base[3] };
+    r[0] = 1;
+    r[1] = r[2] = r[3] = 0;
+    while (e > 0)
+    {
+        if (e & 1) polyMulMod(r, b, r);
+        polyMulMod(b, b, b);
+        e >>= 1;
+    }
+}
+
+// ctors and dtor
+Xoshiro256::Xoshiro256()
+{
+    setKey(0);
+}
+
+Xoshiro256::Xoshiro256(unsigned long newKey)
+{
+    setKey(newKey);
+}
+
+Xoshiro256::Xoshiro256(const Xoshiro256 &src)
+{
+    for (int i=0; i<4; ++i) s_[i] = src.s_[i];
+}
+
+Xoshiro256::~Xoshiro256() { }
+
+// assignment
+Xoshiro256 &
+Xoshiro256::operator=(const Xoshiro256 &rhs)
+{
+    if (this != &rhs)
+    {
+        for (int i=0; i<4; ++i) s_[i] = rhs.s_[i];
+    }
+    return(*this);
+}
+
+// operations
+void
+Xoshiro256::setKey(unsigned long newKey)
+{
+    SplitMix64 sm(newKey);
+    for (int i=0; i<4; ++i) s_[i] = sm.next();
+}
+
+// s = poly(T)*s
+void
+Xoshiro256::applyPolynomial(const uint64_t poly[4])
+{
+    uint64_t t[4] = { 0, 0, 0, 0 };
+    for (int i=0; i<4; ++i)
+    {
+        for (int b=0; b<64; ++b)
+        {
+            if ((poly[i] >> b) & 1)
+            {
+                t[0] ^= s_[0];
+                t[1] ^= s_[1];
+                t[2] ^= s_[2];
+                t[3] ^= s_[3];
+            }
+            random();
+        }
+    }
+    for (int i=0; i<4; ++i) s_[i] = t[i];
+}
+
+// jumps
+void
+Xoshiro256::jump(uint64_t n)
+{
+    if (n < 256)
+    {
+        // cheaper to just step
+        for ( ; n>0; --n) random();
+        return;
+    }
+    uint64_t x[4] = { 2, 0, 0, 0 };
+    uint64_t r[4];
+    polyPowMod(x, n, r);
+    applyPolynomial(r);
+}
+
+void
+Xoshiro256::jumpSubstreams(uint64_t i)
+{
+    if (i == 0) return;
+    uint64_t r[4];
+    polyPowMod(Xoshiro256JumpPoly, i, r);
+    applyPolynomial(r);
+}
+
+Xoshiro256
+Xoshiro256::substream(uint64_t i) const
+{
+    Xoshiro256 stream(*this);
+    stream.jumpSubstreams(i);
+    return(stream);
+}
+
+std::vector<Xoshiro256>
+Xoshiro256::split(unsigned int k) const
+{
+    std::vector<Xoshiro256> streams;
+    streams.reserve(k);
+    Xoshiro256 stream(*this);
+    for (unsigned int i=0; i<k; ++i)
+    {
+        streams.push_back(stream);
+        stream.applyPolynomial(Xoshiro256JumpPoly);
+    }
+    return(streams);
+}
+
+}
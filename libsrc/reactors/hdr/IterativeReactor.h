@@ -13,6 +13,7 @@
 #include <map>
 #include <set>
 #include <queue>
+#include <iostream>
 
 // local headers
 #include "system/Debug.h"
@@ -23,6 +24,8 @@
 #include "signals/Signal.h"
 #include "timers/Timer.h"
 #include "logging/Logging.h"
+#include "statistics/HdrHistogram.h"
+#include "performance/NanoSecTime.h"
 
 namespace ombt {
 
@@ -129,9 +132,14 @@ public:
     // misc
     void setDone();
 
+    // time spent in the accept, i/o and signal handlers, in
+    // seconds, from 1 us to an hour, to two digits
+    const HdrHistogram &latency() const { return(latency_); }
+
 protected:
     // misc
     bool done_;
+    HdrHistogram latency_;
 
     // internal handler classes
     class InternalBaseHandler: public UCBaseObject {
@@ -281,7 +281,7 @@ IterativeReactor::TimerQueueItem::operator>(const TimerQueueItem &rhs) const
 // ctors and dtor
 IterativeReactor::IterativeReactor(MultiplexMode mode, int epollsize):
     UCBaseObject(NOTOK), 
-    done_(false), mode_(mode), epollfd_(-1), epollsize_(epollsize),
+    done_(false), latency_(1.0e-6, 3600.0, 2), mode_(mode), epollfd_(-1), epollsize_(epollsize),
     epolleventflags_(), maxsocket_(-1), nreaders_(0), nwriters_(0), nexceptions_(0),
     endpoints_(), handlers_()
 {
@@ -847,7 +847,10 @@ IterativeReactor::callHandler(KeySocketOper &key, int &status)
     {
         UseCntPtr<EndPoint> pep = hit->second.first;
         UseCntPtr<InternalBaseHandler> pibh = hit->second.second;
+        NanoSecTime started;
         status = pibh->handler(pep);
+        started.stop();
+        latency_.record(started._seconds + 1.0e-9*started._nanoseconds);
         handleStatus(status, pep);
     }
     else
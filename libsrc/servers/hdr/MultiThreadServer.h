@@ -37,6 +37,9 @@ public:
         virtual int operator()(EndPoint *peer) { return(1); }
     };
 
+    // connection threads record latencies into this many shards
+    enum { LatencyShards = 16 };
+
     // ctors and dtor
     MultiThreadStreamServer(EndPoint *serverep, Handler *handler);
     virtual ~MultiThreadStreamServer();
@@ -56,7 +59,8 @@ protected:
     class Task: public SimpleThread::Task {
     public:
         // ctor and dtor
-        Task(EndPoint *subserverep, Handler *handler);
+        Task(EndPoint *subserverep, Handler *handler,
+             HdrHistogram *platency);
         virtual ~Task();
 
         // worker functions
@@ -68,6 +72,7 @@ protected:
         // data
         UseCntPtr<EndPoint> psubserverep_;
         UseCntPtr<Handler> phandler_;
+        HdrHistogram *platency_;
     };
 
     // track handlers
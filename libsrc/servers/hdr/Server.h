@@ -8,9 +8,12 @@
 
 // local headers
 #include <map>
+#include <iostream>
 #include "atomic/UCBaseObject.h"
 #include "sockets/EndPoint.h"
 #include "timers/Timer.h"
+#include "statistics/HdrHistogram.h"
+#include "performance/NanoSecTime.h"
 
 namespace ombt {
 
@@ -24,7 +27,9 @@ public:
     enum { DefaultEPollEventsToHandle = 128 };
 
     // ctors and dtor
-    Server(): UCBaseObject(true) { }
+    Server(unsigned latencyshards = 1):
+        UCBaseObject(true),
+        latency_(1.0e-6, 3600.0, 2, latencyshards) { }
     virtual ~Server() { };
 
     // operations
@@ -36,13 +41,25 @@ public:
     virtual void scheduleTimer(EndPoint *, Timer &) { }
     virtual void cancelTimer(EndPoint *, Timer &) { }
 
+    // time spent in the handlers, in seconds, from 1 us to an
+    // hour, to two digits
+    const HdrHistogram &latency() const { return(latency_); }
+
 private:
     // leper colony
     Server(const Server &src);
     Server &operator=(const Server &rhs);
 
+protected:
+    // record the time since a handler was started
+    void recordLatency(NanoSecTime &started) {
+        started.stop();
+        latency_.record(started._seconds + 1.0e-9*started._nanoseconds);
+    }
+
 protected:
     bool done_;
+    HdrHistogram latency_;
 };
 
 }
@@ -391,7 +391,9 @@ IterativeMSDatagramServer::selectLoop()
                 if (hit == handlers_.end()) continue;
                 UseCntPtr<EndPoint> pep(hit->second.first);
                 UseCntPtr<Handler> phandler(hit->second.second);
+                NanoSecTime started;
                 int status = (*phandler)(pep);
+                recordLatency(started);
                 if (status > 0)
                 {
                     // success and done with this server
@@ -571,7 +573,9 @@ IterativeMSDatagramServer::epollLoop()
                 if (hit == handlers_.end()) continue;
                 UseCntPtr<EndPoint> pep(hit->second.first);
                 UseCntPtr<Handler> phandler(hit->second.second);
+                NanoSecTime started;
                 int status = (*phandler)(pep);
+                recordLatency(started);
                 if (status > 0)
                 {
                     // success and done with this server
@@ -1024,7 +1028,9 @@ IterativeMSStreamServer::selectLoop()
                 }
                 else
                 {
+                    NanoSecTime started;
                     int status = (*phandler)(pep);
+                    recordLatency(started);
                     if (status > 0)
                     {
                         // success and done with this server
@@ -1249,7 +1255,9 @@ IterativeMSStreamServer::epollLoop()
                 }
                 else
                 {
+                    NanoSecTime started;
                     int status = (*phandler)(pep);
+                    recordLatency(started);
                     if (status > 0)
                     {
                         // success and done with this server
@@ -54,7 +54,9 @@ IterativeDatagramServer::run()
 
     while (pserverep_->read(buf, count, *peer_address) > 0)
     {
+        NanoSecTime started;
         int status = (*phandler_)(pserverep_, peer_address, buf, count);
+        recordLatency(started);
         if (status < 0)
         {
             // error of some type
@@ -132,7 +134,9 @@ IterativeStreamServer::run()
             }
         }
 
+        NanoSecTime started;
         (void) (*phandler_)(peer);
+        recordLatency(started);
 
         peer->close();
     }
@@ -21,8 +21,10 @@ namespace ombt {
 
 // thread ctor and dtor
         // ctor and dtor
-MultiThreadStreamServer::Task::Task(EndPoint *psubserverep, Handler *phandler):
-    SimpleThread::Task(), psubserverep_(psubserverep), phandler_(phandler)
+MultiThreadStreamServer::Task::Task(EndPoint *psubserverep, Handler *phandler,
+                                    HdrHistogram *platency):
+    SimpleThread::Task(), psubserverep_(psubserverep), phandler_(phandler),
+    platency_(platency)
 {
 TRACE();
     if (psubserverep_->isOk() && phandler_->isOk())
@@ -50,7 +52,12 @@ TRACE();
     if (isNotOk()) return(NOTOK);
 TRACE();
     int status;
-    while ((status = (*phandler_)(psubserverep_)) == OK) ;
+    do {
+        NanoSecTime started;
+        status = (*phandler_)(psubserverep_);
+        started.stop();
+        platency_->record(started._seconds + 1.0e-9*started._nanoseconds);
+    } while (status == OK);
 TRACE();
     return(status < 0 ? NOTOK : OK);
 }
@@ -65,7 +72,7 @@ TRACE();
 MultiThreadStreamServer::MultiThreadStreamServer(
     EndPoint *pserverep, 
     MultiThreadStreamServer::Handler *phandler):
-        Server(), pserverep_(pserverep), phandler_(phandler)
+        Server(LatencyShards), pserverep_(pserverep), phandler_(phandler)
 {
 TRACE();
     if (pserverep_->isOk() && phandler_->isOk())
@@ -121,7 +128,7 @@ TRACE();
         // do we need this? - mar, 5/5/11
         // Task task(peer, phandler_);
 
-        SimpleThread thread(new Task(peer, phandler_));
+        SimpleThread thread(new Task(peer, phandler_, &latency_));
 TRACE();
         MustBeTrue(thread.isOk());
 
@@ -0,0 +1,85 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_BATCH_MEANS_H
+#define __OMBT_BATCH_MEANS_H
+
+// batch means output analysis for one long run.
+//
+// successive observations of a simulation are correlated, so the
+// variance of their mean is not the sample variance over n. the
+// observations are cut into batches instead, and if the batches are
+// long enough their means are close to independent and normal,
+// which gives a student t interval for the steady-state mean.
+//
+// the batch size is not needed in advance: up to 2k batches are
+// kept, and when they are full, neighbours are combined into k
+// batches of twice the size (the fixed number of batches method of
+// schmeiser). the last, partial batch is left out of the results.
+// the lag-1 correlation of the batch means is a check that the
+// batches are long enough.
+
+// system headers
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+
+namespace ombt {
+
+// batch means
+class BatchMeans: public BaseObject
+{
+public:
+    // sizes
+    enum { DefaultBatches = 32 };
+
+    // ctors and dtor
+    BatchMeans(unsigned int batches = DefaultBatches);
+    BatchMeans(const BatchMeans &src);
+    ~BatchMeans();
+
+    // assignment
+    BatchMeans &operator=(const BatchMeans &rhs);
+
+    // observations
+    void clear();
+    inline void add(double x) {
+        partial_ += x;
+        if (++count_ == size_) flush();
+    }
+    void add(const double *x, size_t n);
+
+    // results over the full batches
+    size_t batches() const { return(full_); }
+    uint64_t batchSize() const { return(size_); }
+    double mean() const;
+    double variance() const;
+    double standardError() const;
+    double halfWidth(double confidence) const;
+    double lag1() const;
+
+protected:
+    // close the partial batch, combining batches when all are full
+    void flush();
+
+protected:
+    // internal data
+    unsigned int batches_;
+    std::vector<double> sums_;
+    size_t full_;
+    uint64_t size_;
+    uint64_t count_;
+    double partial_;
+};
+
+}
+
+#endif
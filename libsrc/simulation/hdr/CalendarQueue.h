@@ -0,0 +1,149 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_CALENDAR_QUEUE_H
+#define __OMBT_CALENDAR_QUEUE_H
+
+// future event list as a calendar queue (brown, "calendar queues:
+// a fast o(1) priority queue implementation for the simulation
+// event set problem", cacm 1988).
+//
+// events hash by time into buckets of a fixed width, like days of
+// a year on a desk calendar, and each bucket is a short sorted
+// list. dequeue scans forward from the bucket of the last event
+// taken, so with about one to two events per bucket both enqueue
+// and dequeue are o(1) amortized. the number of buckets doubles or
+// halves with the number of events, and the width is re-estimated
+// from the spacing of the next events at each resize. the queue
+// also counts the empty buckets scanned and list nodes passed, and
+// if they average more than a few per operation the width no longer
+// fits the events and is estimated again.
+//
+// events at equal times leave in the order they were enqueued. each
+// bucket keeps its tail as well as its head, so an event after all
+// the others of its bucket, the usual case and always the case for
+// events at equal times, is linked in at once. the list nodes are kept in one array and recycled, so a steady state
+// simulation does no allocation at all.
+
+// system headers
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+
+namespace ombt {
+
+// an event: when, what, and to whom. sequence is set by the queue.
+struct Event {
+    double time;
+    uint64_t sequence;
+    int type;
+    uint64_t entity;
+};
+
+// calendar queue of events
+class CalendarQueue: public BaseObject
+{
+public:
+    // sizes
+    enum {
+        MinBuckets = 16,
+        WidthSamples = 25,
+        MaxSteps = 4
+    };
+
+    // ctors and dtor
+    CalendarQueue(double width = 1.0);
+    CalendarQueue(const CalendarQueue &src);
+    ~CalendarQueue();
+
+    // assignment
+    CalendarQueue &operator=(const CalendarQueue &rhs);
+
+    // queue operations. times must not be negative or nan.
+    int isEmpty() const { return(size_ == 0); }
+    size_t size() const { return(size_); }
+    int enqueue(const Event &event);
+    int dequeue(Event &event);
+    int peek(Event &event);
+    void clear();
+
+    // calendar in use
+    size_t buckets() const { return(buckets_.size()); }
+    double width() const { return(width_); }
+
+protected:
+    // list nodes, linked by index, 32 bytes each
+    enum { Nil = 0xffffffff };
+    struct Node {
+        double time;
+        uint64_t sequence;
+        uint64_t entity;
+        int type;
+        uint32_t next;
+    };
+    struct Bucket {
+        uint32_t head;
+        uint32_t tail;
+    };
+    static inline Bucket empty() {
+        Bucket bucket;
+        bucket.head = Nil;
+        bucket.tail = Nil;
+        return(bucket);
+    }
+
+    // utilities
+    inline int64_t day(double time) const {
+        return(int64_t(time*inverse_));
+    }
+    static inline bool before(const Node &a, const Node &b) {
+        return(a.time < b.time ||
+               (a.time == b.time && a.sequence < b.sequence));
+    }
+    static inline void copy(const Node &node, Event &event) {
+        event.time = node.time;
+        event.sequence = node.sequence;
+        event.type = node.type;
+        event.entity = node.entity;
+    }
+    uint32_t allocate();
+    uint64_t insert(uint32_t node);
+    Bucket *front(uint64_t &steps);
+    void resize(size_t nbuckets);
+    double estimateWidth();
+
+    // steps taken by an operation; too many on average and the
+    // width is estimated again
+    inline void account(uint64_t steps) {
+        steps_ += steps;
+        if (++operations_ < buckets_.size() + MinBuckets) return;
+        if (steps_ > MaxSteps*operations_) resize(buckets_.size());
+        steps_ = 0;
+        operations_ = 0;
+    }
+
+protected:
+    // internal data
+    std::vector<Bucket> buckets_;
+    std::vector<Node> nodes_;
+    uint32_t free_;
+    size_t size_;
+    uint64_t sequence_;
+    double width_;
+    double inverse_;
+    int64_t current_;
+    double last_;
+    uint64_t steps_;
+    uint64_t operations_;
+};
+
+}
+
+#endif
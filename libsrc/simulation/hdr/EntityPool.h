@@ -0,0 +1,65 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_ENTITY_POOL_H
+#define __OMBT_ENTITY_POOL_H
+
+// pool of simulation entities (customers, jobs, packets).
+//
+// entities are records of type T in one array, named by their
+// index, which is what events carry. released records go on a free
+// list and are handed out again, so the array grows to the largest
+// number of entities alive at once and a long run allocates nothing
+// after the warm-up.
+
+// system headers
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+
+namespace ombt {
+
+// entity pool
+template <class T>
+class EntityPool: public BaseObject
+{
+public:
+    // ctors and dtor
+    EntityPool();
+    EntityPool(const EntityPool &src);
+    ~EntityPool();
+
+    // assignment
+    EntityPool &operator=(const EntityPool &rhs);
+
+    // a fresh entity, T(), and its index
+    uint64_t acquire();
+    void release(uint64_t id);
+    void clear();
+
+    // access
+    T &operator[](uint64_t id) { return(entities_[id]); }
+    const T &operator[](uint64_t id) const { return(entities_[id]); }
+
+    // entities alive, and the most ever alive at once
+    size_t size() const { return(entities_.size()-free_.size()); }
+    size_t capacity() const { return(entities_.size()); }
+
+protected:
+    // internal data
+    std::vector<T> entities_;
+    std::vector<uint64_t> free_;
+};
+
+}
+
+#include "simulation/EntityPool.i"
+
+#endif
@@ -0,0 +1,74 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// pool of simulation entities
+
+namespace ombt {
+
+// ctors and dtor
+template <class T>
+EntityPool<T>::EntityPool():
+    BaseObject(true), entities_(), free_()
+{
+}
+
+template <class T>
+EntityPool<T>::EntityPool(const EntityPool &src):
+    BaseObject(src), entities_(src.entities_), free_(src.free_)
+{
+}
+
+template <class T>
+EntityPool<T>::~EntityPool()
+{
+}
+
+// assignment
+template <class T>
+EntityPool<T> &
+EntityPool<T>::operator=(const EntityPool &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        entities_ = rhs.entities_;
+        free_ = rhs.free_;
+    }
+    return(*this);
+}
+
+// operations
+template <class T>
+uint64_t
+EntityPool<T>::acquire()
+{
+    if (free_.empty())
+    {
+        entities_.push_back(T());
+        return(entities_.size()-1);
+    }
+    uint64_t id = free_.back();
+    free_.pop_back();
+    entities_[id] = T();
+    return(id);
+}
+
+template <class T>
+void
+EntityPool<T>::release(uint64_t id)
+{
+    MustBeTrue(id < entities_.size());
+    free_.push_back(id);
+}
+
+template <class T>
+void
+EntityPool<T>::clear()
+{
+    entities_.clear();
+    free_.clear();
+}
+
+}
@@ -0,0 +1,110 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_REPLICATIONS_H
+#define __OMBT_REPLICATIONS_H
+
+// independent replications of a simulation, run in parallel.
+//
+// an experiment is anything callable as experiment(const RNG &stream)
+// returning the output of one run, a double. replication i gets
+// substream i of the master engine, so its result is the same
+// whichever thread runs it, and the replications are independent.
+// each builds its own simulator and model, nothing is shared.
+//
+// the outputs of the replications are independent and identically
+// distributed, so their mean has a student t interval.
+
+// system headers
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+#include "random/Random.h"
+#include "threads/Job.h"
+#include "threads/ThreadPool.h"
+#include "threads/CountDownLatch.h"
+#include "specialfunctions/SpecialFunctions.h"
+
+namespace ombt {
+
+// replications driver
+template <class RNG>
+class ReplicationsT: public BaseObject
+{
+public:
+    // ctors and dtor
+    ReplicationsT();
+    ReplicationsT(const RNG &master);
+    ReplicationsT(const ReplicationsT &src);
+    ~ReplicationsT();
+
+    // assignment
+    ReplicationsT &operator=(const ReplicationsT &rhs);
+
+    // run the replications on the pool's threads, or in this thread
+    template <class Experiment>
+    void run(ThreadPool &pool, const Experiment &experiment, size_t count);
+    template <class Experiment>
+    void run(const Experiment &experiment, size_t count);
+
+    // results of the last run, in replication order
+    const std::vector<double> &results() const { return(results_); }
+    double mean() const;
+    double variance() const;
+    double standardError() const;
+    double halfWidth(double confidence) const;
+
+protected:
+    // one replication as a pool job. the pool owns and deletes the
+    // job, the driver owns everything the job points to.
+    template <class Experiment>
+    class ReplicationJob: public Job {
+    public:
+        ReplicationJob(const RNG &stream, const Experiment &experiment,
+                       double &result, CountDownLatch &latch):
+            Job(), stream_(stream), experiment_(experiment),
+            result_(result), latch_(latch) {
+        }
+        virtual ~ReplicationJob() {
+        }
+
+        virtual JobReturn run() {
+            result_ = experiment_(stream_);
+            latch_.countDown();
+            return Finished;
+        }
+
+    private:
+        ReplicationJob();
+        ReplicationJob(const ReplicationJob &);
+        ReplicationJob &operator=(const ReplicationJob &);
+
+    protected:
+        RNG stream_;
+        const Experiment &experiment_;
+        double &result_;
+        CountDownLatch &latch_;
+    };
+
+protected:
+    // internal data
+    RNG master_;
+    std::vector<double> results_;
+};
+
+// default instantiation, engine chosen at run-time
+typedef ReplicationsT<Random> Replications;
+
+}
+
+#include "simulation/Replications.i"
+
+#endif
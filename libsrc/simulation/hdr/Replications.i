@@ -0,0 +1,128 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// independent replications of a simulation
+
+namespace ombt {
+
+// ctors and dtor
+template <class RNG>
+ReplicationsT<RNG>::ReplicationsT():
+    BaseObject(false), master_(), results_()
+{
+    setOk(false);
+}
+
+template <class RNG>
+ReplicationsT<RNG>::ReplicationsT(const RNG &master):
+    BaseObject(true), master_(master), results_()
+{
+}
+
+template <class RNG>
+ReplicationsT<RNG>::ReplicationsT(const ReplicationsT &src):
+    BaseObject(src), master_(src.master_), results_(src.results_)
+{
+}
+
+template <class RNG>
+ReplicationsT<RNG>::~ReplicationsT()
+{
+}
+
+// assignment
+template <class RNG>
+ReplicationsT<RNG> &
+ReplicationsT<RNG>::operator=(const ReplicationsT &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        master_ = rhs.master_;
+        results_ = rhs.results_;
+    }
+    return(*this);
+}
+
+// run on the pool, one job per replication
+template <class RNG>
+template <class Experiment>
+void
+ReplicationsT<RNG>::run(ThreadPool &pool, const Experiment &experiment,
+                        size_t count)
+{
+    MustBeTrue(isOk());
+
+    results_.assign(count, 0.0);
+    CountDownLatch latch(count);
+    for (size_t i=0; i<count; ++i)
+    {
+        pool.addJob(new ReplicationJob<Experiment>(
+            master_.substream(i), experiment, results_[i], latch));
+    }
+    latch.wait();
+}
+
+// run in the calling thread, same results as on a pool
+template <class RNG>
+template <class Experiment>
+void
+ReplicationsT<RNG>::run(const Experiment &experiment, size_t count)
+{
+    MustBeTrue(isOk());
+
+    results_.assign(count, 0.0);
+    for (size_t i=0; i<count; ++i)
+    {
+        results_[i] = experiment(master_.substream(i));
+    }
+}
+
+// results
+template <class RNG>
+double
+ReplicationsT<RNG>::mean() const
+{
+    if (results_.empty()) return(NAN);
+    double sum = 0.0;
+    for (size_t i=0; i<results_.size(); ++i) sum += results_[i];
+    return(sum/results_.size());
+}
+
+template <class RNG>
+double
+ReplicationsT<RNG>::variance() const
+{
+    size_t count = results_.size();
+    if (count < 2) return(NAN);
+    double m = mean();
+    double sum2 = 0.0;
+    for (size_t i=0; i<count; ++i)
+    {
+        double d = results_[i] - m;
+        sum2 += d*d;
+    }
+    return(sum2/(count-1));
+}
+
+template <class RNG>
+double
+ReplicationsT<RNG>::standardError() const
+{
+    return(sqrt(variance()/results_.size()));
+}
+
+// half-width of the two-sided interval for the mean
+template <class RNG>
+double
+ReplicationsT<RNG>::halfWidth(double confidence) const
+{
+    size_t count = results_.size();
+    if (count < 2) return(NAN);
+    double t = studentQuantile(0.5*(1.0+confidence), double(count-1));
+    return(t*standardError());
+}
+
+}
@@ -0,0 +1,85 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_RESOURCE_H
+#define __OMBT_RESOURCE_H
+
+// a pool of identical servers with a fifo waiting line.
+//
+// an entity seizes a server if one is free, or waits in line. a
+// release frees the server or hands it straight to the first entity
+// in line. the resource keeps the time integrals of busy servers
+// and line length, for the time-average utilization and line
+// length. the clock is passed in, so the resource does not depend
+// on the simulator.
+
+// system headers
+#include <stddef.h>
+#include <stdint.h>
+#include <deque>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+
+namespace ombt {
+
+// servers and a waiting line
+class Resource: public BaseObject
+{
+public:
+    // ctors and dtor
+    Resource(unsigned int servers = 1);
+    Resource(const Resource &src);
+    ~Resource();
+
+    // assignment
+    Resource &operator=(const Resource &rhs);
+
+    // true if the entity got a server, false if it is in line
+    bool seize(double now, uint64_t entity);
+
+    // free a server. true if it went to the first entity in line,
+    // which is returned in next.
+    bool release(double now, uint64_t &next);
+
+    // state
+    unsigned int servers() const { return(servers_); }
+    unsigned int busy() const { return(busy_); }
+    size_t waiting() const { return(line_.size()); }
+
+    // time averages since the last reset of the statistics, up to now
+    double utilization(double now) const;
+    double meanWaiting(double now) const;
+    uint64_t served() const { return(served_); }
+
+    // drop the statistics gathered so far, e.g. after a warm-up
+    void resetStatistics(double now);
+
+protected:
+    // advance the time integrals to now
+    inline void update(double now) {
+        double dt = now - last_;
+        busyArea_ += dt*busy_;
+        lineArea_ += dt*line_.size();
+        last_ = now;
+    }
+
+protected:
+    // internal data
+    unsigned int servers_;
+    unsigned int busy_;
+    std::deque<uint64_t> line_;
+    uint64_t served_;
+    double start_;
+    double last_;
+    double busyArea_;
+    double lineArea_;
+};
+
+}
+
+#endif
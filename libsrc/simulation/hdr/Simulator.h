@@ -0,0 +1,117 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_SIMULATOR_H
+#define __OMBT_SIMULATOR_H
+
+// discrete-event simulation kernel.
+//
+// the simulator owns the clock and the future event list. a model
+// is anything with
+//
+//     void handle(Simulator &simulator, const Event &event);
+//
+// run() takes events in time order, advances the clock to each and
+// hands it to the model, which schedules more events. the event
+// type says what happened and the entity which one, usually an
+// index into an EntityPool. events at equal times are handled in
+// the order they were scheduled, so a run is reproducible.
+//
+// the model is a template parameter, not a virtual base, so the
+// dispatch of each event can be inlined.
+
+// system headers
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+#include "simulation/CalendarQueue.h"
+
+namespace ombt {
+
+// simulation kernel
+class Simulator: public BaseObject
+{
+public:
+    // ctors and dtor. width is the first guess at the calendar
+    // bucket width, about the mean time between events.
+    Simulator(double width = 1.0);
+    Simulator(const Simulator &src);
+    ~Simulator();
+
+    // assignment
+    Simulator &operator=(const Simulator &rhs);
+
+    // clock and counts
+    double now() const { return(now_); }
+    uint64_t events() const { return(events_); }
+    size_t pending() const { return(queue_.size()); }
+
+    // schedule an event after a delay, or at a time, not in the past
+    inline int schedule(double delay, int type, uint64_t entity = 0) {
+        return(scheduleAt(now_+delay, type, entity));
+    }
+    inline int scheduleAt(double time, int type, uint64_t entity = 0) {
+        if (!(time >= now_)) return(NOTOK);
+        Event event;
+        event.time = time;
+        event.sequence = 0;
+        event.type = type;
+        event.entity = entity;
+        return(queue_.enqueue(event));
+    }
+
+    // run until the time limit, the event limit, or stop(). the
+    // clock is left at the time limit if the events run out first.
+    // returns the number of events handled.
+    template <class Model>
+    uint64_t run(Model &model, double until = HUGE_VAL,
+                 uint64_t maxevents = UINT64_MAX);
+    void stop() { stopped_ = true; }
+
+    // back to time zero with no events
+    void reset();
+
+protected:
+    // internal data
+    CalendarQueue queue_;
+    double now_;
+    uint64_t events_;
+    bool stopped_;
+};
+
+// event loop
+template <class Model>
+uint64_t
+Simulator::run(Model &model, double until, uint64_t maxevents)
+{
+    MustBeTrue(isOk());
+
+    stopped_ = false;
+    uint64_t count = 0;
+    Event event;
+    while (!stopped_ && count < maxevents)
+    {
+        if (queue_.peek(event) != OK || event.time > until)
+        {
+            if (until > now_ && until < HUGE_VAL) now_ = until;
+            break;
+        }
+        queue_.dequeue(event);
+        now_ = event.time;
+        ++events_;
+        ++count;
+        model.handle(*this, event);
+    }
+    return(count);
+}
+
+}
+
+#endif
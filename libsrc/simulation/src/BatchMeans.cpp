@@ -0,0 +1,141 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// batch means output analysis
+
+// headers
+#include "hdr/BatchMeans.h"
+#include "specialfunctions/SpecialFunctions.h"
+
+namespace ombt {
+
+// ctors and dtor
+BatchMeans::BatchMeans(unsigned int batches):
+    BaseObject(true), batches_(batches), sums_(2*batches, 0.0), full_(0),
+    size_(1), count_(0), partial_(0.0)
+{
+    if (batches_ < 2) setOk(false);
+}
+
+BatchMeans::BatchMeans(const BatchMeans &src):
+    BaseObject(src), batches_(src.batches_), sums_(src.sums_),
+    full_(src.full_), size_(src.size_), count_(src.count_),
+    partial_(src.partial_)
+{
+}
+
+BatchMeans::~BatchMeans()
+{
+}
+
+// assignment
+BatchMeans &
+BatchMeans::operator=(const BatchMeans &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        batches_ = rhs.batches_;
+        sums_ = rhs.sums_;
+        full_ = rhs.full_;
+        size_ = rhs.size_;
+        count_ = rhs.count_;
+        partial_ = rhs.partial_;
+    }
+    return(*this);
+}
+
+// observations
+void
+BatchMeans::clear()
+{
+    sums_.assign(2*batches_, 0.0);
+    full_ = 0;
+    size_ = 1;
+    count_ = 0;
+    partial_ = 0.0;
+}
+
+void
+BatchMeans::add(const double *x, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        add(x[i]);
+    }
+}
+
+void
+BatchMeans::flush()
+{
+    sums_[full_++] = partial_;
+    partial_ = 0.0;
+    count_ = 0;
+    if (full_ < sums_.size()) return;
+
+    for (size_t i=0; i<batches_; ++i)
+    {
+        sums_[i] = sums_[2*i] + sums_[2*i+1];
+    }
+    full_ = batches_;
+    size_ *= 2;
+}
+
+// results
+double
+BatchMeans::mean() const
+{
+    if (full_ == 0) return(NAN);
+    double sum = 0.0;
+    for (size_t i=0; i<full_; ++i) sum += sums_[i];
+    return(sum/(double(full_)*size_));
+}
+
+double
+BatchMeans::variance() const
+{
+    if (full_ < 2) return(NAN);
+    double m = mean();
+    double sum2 = 0.0;
+    for (size_t i=0; i<full_; ++i)
+    {
+        double d = sums_[i]/size_ - m;
+        sum2 += d*d;
+    }
+    return(sum2/(full_-1));
+}
+
+double
+BatchMeans::standardError() const
+{
+    return(sqrt(variance()/full_));
+}
+
+// half-width of the two-sided interval for the mean
+double
+BatchMeans::halfWidth(double confidence) const
+{
+    if (full_ < 2) return(NAN);
+    double t = studentQuantile(0.5*(1.0+confidence), double(full_-1));
+    return(t*standardError());
+}
+
+double
+BatchMeans::lag1() const
+{
+    if (full_ < 3) return(NAN);
+    double m = mean();
+    double sum2 = 0.0;
+    double sum1 = 0.0;
+    for (size_t i=0; i<full_; ++i)
+    {
+        double d = sums_[i]/size_ - m;
+        sum2 += d*d;
+        if (i > 0) sum1 += d*(sums_[i-1]/size_ - m);
+    }
+    return((sum2 > 0.0) ? sum1/sum2 : 0.0);
+}
+
+}
@@ -0,0 +1,276 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// calendar queue future event list
+
+// headers
+#include "hdr/CalendarQueue.h"
+
+namespace ombt {
+
+// ctors and dtor
+CalendarQueue::CalendarQueue(double width):
+    BaseObject(true), buckets_(MinBuckets, empty()), nodes_(),
+    free_(Nil), size_(0), sequence_(0), width_(width),
+    inverse_(1.0/width), current_(0), last_(0.0), steps_(0),
+    operations_(0)
+{
+    if (!(width_ > 0.0)) setOk(false);
+}
+
+CalendarQueue::CalendarQueue(const CalendarQueue &src):
+    BaseObject(src), buckets_(src.buckets_), nodes_(src.nodes_),
+    free_(src.free_), size_(src.size_), sequence_(src.sequence_),
+    width_(src.width_), inverse_(src.inverse_), current_(src.current_),
+    last_(src.last_), steps_(src.steps_), operations_(src.operations_)
+{
+}
+
+CalendarQueue::~CalendarQueue()
+{
+}
+
+// assignment
+CalendarQueue &
+CalendarQueue::operator=(const CalendarQueue &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        buckets_ = rhs.buckets_;
+        nodes_ = rhs.nodes_;
+        free_ = rhs.free_;
+        size_ = rhs.size_;
+        sequence_ = rhs.sequence_;
+        width_ = rhs.width_;
+        inverse_ = rhs.inverse_;
+        current_ = rhs.current_;
+        last_ = rhs.last_;
+        steps_ = rhs.steps_;
+        operations_ = rhs.operations_;
+    }
+    return(*this);
+}
+
+// queue operations
+int
+CalendarQueue::enqueue(const Event &event)
+{
+    // days must fit in 63 bits
+    if (!(event.time >= 0.0 && event.time*inverse_ < 4.0e18))
+        return(NOTOK);
+
+    uint32_t node = allocate();
+    nodes_[node].time = event.time;
+    nodes_[node].sequence = sequence_++;
+    nodes_[node].entity = event.entity;
+    nodes_[node].type = event.type;
+    uint64_t steps = insert(node);
+
+    if (++size_ > 2*buckets_.size())
+        resize(2*buckets_.size());
+    else
+        account(steps);
+    return(OK);
+}
+
+int
+CalendarQueue::dequeue(Event &event)
+{
+    if (size_ == 0) return(NOTOK);
+
+    uint64_t steps = 0;
+    Bucket *bucket = front(steps);
+    uint32_t node = bucket->head;
+    bucket->head = nodes_[node].next;
+    copy(nodes_[node], event);
+    last_ = event.time;
+
+    nodes_[node].next = free_;
+    free_ = node;
+
+    if (--size_ < buckets_.size()/2 && buckets_.size() > MinBuckets)
+        resize(buckets_.size()/2);
+    else
+        account(steps);
+    return(OK);
+}
+
+int
+CalendarQueue::peek(Event &event)
+{
+    if (size_ == 0) return(NOTOK);
+    uint64_t steps = 0;
+    copy(nodes_[front(steps)->head], event);
+    return(OK);
+}
+
+void
+CalendarQueue::clear()
+{
+    buckets_.assign(MinBuckets, empty());
+    nodes_.clear();
+    free_ = Nil;
+    size_ = 0;
+    sequence_ = 0;
+    current_ = 0;
+    last_ = 0.0;
+    steps_ = 0;
+    operations_ = 0;
+}
+
+// a node from the free list, or a new one
+uint32_t
+CalendarQueue::allocate()
+{
+    if (free_ != Nil)
+    {
+        uint32_t node = free_;
+        free_ = nodes_[node].next;
+        return(node);
+    }
+    MustBeTrue(nodes_.size() < size_t(Nil));
+    nodes_.push_back(Node());
+    return(uint32_t(nodes_.size()-1));
+}
+
+// link a node into its bucket, after the events before it.
+// returns the number of nodes passed.
+uint64_t
+CalendarQueue::insert(uint32_t node)
+{
+    Node &event = nodes_[node];
+    int64_t d = day(event.time);
+    if (d < current_) current_ = d;
+
+    Bucket &bucket = buckets_[size_t(d) & (buckets_.size()-1)];
+    event.next = Nil;
+    if (bucket.head == Nil)
+    {
+        bucket.head = node;
+        bucket.tail = node;
+        return(0);
+    }
+    if (!before(event, nodes_[bucket.tail]))
+    {
+        nodes_[bucket.tail].next = node;
+        bucket.tail = node;
+        return(0);
+    }
+
+    uint64_t steps = 0;
+    uint32_t *link = &bucket.head;
+    while (!before(event, nodes_[*link]))
+    {
+        link = &nodes_[*link].next;
+        ++steps;
+    }
+    event.next = *link;
+    *link = node;
+    return(steps);
+}
+
+// link to the first event. the scan goes day by day from the
+// current one; the head of a bucket is due if it falls on the day
+// being scanned. after a whole year with nothing due, the earliest
+// head is found directly. adds the buckets looked at to steps.
+CalendarQueue::Bucket *
+CalendarQueue::front(uint64_t &steps)
+{
+    const size_t mask = buckets_.size()-1;
+    for (size_t scanned=0; scanned<buckets_.size(); ++scanned, ++current_)
+    {
+        Bucket *bucket = &buckets_[size_t(current_) & mask];
+        if (bucket->head != Nil &&
+            day(nodes_[bucket->head].time) <= current_)
+        {
+            steps += scanned;
+            return(bucket);
+        }
+    }
+    steps += 2*buckets_.size();
+
+    Bucket *best = NULL;
+    for (size_t b=0; b<buckets_.size(); ++b)
+    {
+        if (buckets_[b].head == Nil) continue;
+        if (best == NULL ||
+            before(nodes_[buckets_[b].head], nodes_[best->head]))
+            best = &buckets_[b];
+    }
+    current_ = day(nodes_[best->head].time);
+    return(best);
+}
+
+// rebuild with a new number of buckets and a new width
+void
+CalendarQueue::resize(size_t nbuckets)
+{
+    double width = estimateWidth();
+
+    std::vector<Bucket> old(nbuckets, empty());
+    old.swap(buckets_);
+    width_ = width;
+    inverse_ = 1.0/width;
+    current_ = day(last_);
+    steps_ = 0;
+    operations_ = 0;
+
+    for (size_t b=0; b<old.size(); ++b)
+    {
+        for (uint32_t node=old[b].head; node!=Nil; )
+        {
+            uint32_t next = nodes_[node].next;
+            insert(node);
+            node = next;
+        }
+    }
+}
+
+// three times the mean spacing of the next few events, leaving out
+// the large gaps (brown's rule). the events are unlinked to find
+// them and linked back in.
+double
+CalendarQueue::estimateWidth()
+{
+    size_t n = (size_ < WidthSamples) ? size_ : size_t(WidthSamples);
+    if (n < 2) return(width_);
+
+    int64_t saved = current_;
+    uint64_t steps = 0;
+    uint32_t taken[WidthSamples];
+    double times[WidthSamples];
+    for (size_t i=0; i<n; ++i)
+    {
+        Bucket *bucket = front(steps);
+        taken[i] = bucket->head;
+        times[i] = nodes_[bucket->head].time;
+        bucket->head = nodes_[bucket->head].next;
+    }
+    for (size_t i=0; i<n; ++i)
+    {
+        insert(taken[i]);
+    }
+    current_ = saved;
+
+    double mean = (times[n-1]-times[0])/(n-1);
+    if (!(mean > 0.0)) return(width_);
+
+    double sum = 0.0;
+    size_t count = 0;
+    for (size_t i=0; i+1<n; ++i)
+    {
+        double gap = times[i+1]-times[i];
+        if (gap < 2.0*mean)
+        {
+            sum += gap;
+            ++count;
+        }
+    }
+    double width = 3.0*sum/count;
+    return((width > 0.0) ? width : width_);
+}
+
+}
@@ -0,0 +1,111 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// servers with a fifo waiting line
+
+// headers
+#include "hdr/Resource.h"
+
+namespace ombt {
+
+// ctors and dtor
+Resource::Resource(unsigned int servers):
+    BaseObject(true), servers_(servers), busy_(0), line_(), served_(0),
+    start_(0.0), last_(0.0), busyArea_(0.0), lineArea_(0.0)
+{
+    if (servers_ == 0) setOk(false);
+}
+
+Resource::Resource(const Resource &src):
+    BaseObject(src), servers_(src.servers_), busy_(src.busy_),
+    line_(src.line_), served_(src.served_), start_(src.start_),
+    last_(src.last_), busyArea_(src.busyArea_), lineArea_(src.lineArea_)
+{
+}
+
+Resource::~Resource()
+{
+}
+
+// assignment
+Resource &
+Resource::operator=(const Resource &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        servers_ = rhs.servers_;
+        busy_ = rhs.busy_;
+        line_ = rhs.line_;
+        served_ = rhs.served_;
+        start_ = rhs.start_;
+        last_ = rhs.last_;
+        busyArea_ = rhs.busyArea_;
+        lineArea_ = rhs.lineArea_;
+    }
+    return(*this);
+}
+
+// operations
+bool
+Resource::seize(double now, uint64_t entity)
+{
+    update(now);
+    if (busy_ < servers_)
+    {
+        ++busy_;
+        ++served_;
+        return(true);
+    }
+    line_.push_back(entity);
+    return(false);
+}
+
+bool
+Resource::release(double now, uint64_t &next)
+{
+    MustBeTrue(busy_ > 0);
+    update(now);
+    if (line_.empty())
+    {
+        --busy_;
+        return(false);
+    }
+    next = line_.front();
+    line_.pop_front();
+    ++served_;
+    return(true);
+}
+
+// time averages
+double
+Resource::utilization(double now) const
+{
+    double elapsed = now - start_;
+    if (!(elapsed > 0.0)) return(0.0);
+    double area = busyArea_ + (now - last_)*busy_;
+    return(area/(elapsed*servers_));
+}
+
+double
+Resource::meanWaiting(double now) const
+{
+    double elapsed = now - start_;
+    if (!(elapsed > 0.0)) return(0.0);
+    double area = lineArea_ + (now - last_)*line_.size();
+    return(area/elapsed);
+}
+
+void
+Resource::resetStatistics(double now)
+{
+    served_ = 0;
+    start_ = now;
+    last_ = now;
+    busyArea_ = 0.0;
+    lineArea_ = 0.0;
+}
+
+}
@@ -0,0 +1,56 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// discrete-event simulation kernel
+
+// headers
+#include "hdr/Simulator.h"
+
+namespace ombt {
+
+// ctors and dtor
+Simulator::Simulator(double width):
+    BaseObject(true), queue_(width), now_(0.0), events_(0),
+    stopped_(false)
+{
+    if (!queue_.isOk()) setOk(false);
+}
+
+Simulator::Simulator(const Simulator &src):
+    BaseObject(src), queue_(src.queue_), now_(src.now_),
+    events_(src.events_), stopped_(src.stopped_)
+{
+}
+
+Simulator::~Simulator()
+{
+}
+
+// assignment
+Simulator &
+Simulator::operator=(const Simulator &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        queue_ = rhs.queue_;
+        now_ = rhs.now_;
+        events_ = rhs.events_;
+        stopped_ = rhs.stopped_;
+    }
+    return(*this);
+}
+
+// back to the start
+void
+Simulator::reset()
+{
+    queue_.clear();
+    now_ = 0.0;
+    events_ = 0;
+    stopped_ = false;
+}
+
+}
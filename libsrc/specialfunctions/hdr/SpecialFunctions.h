@@ -0,0 +1,73 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// special functions used by the density and distribution
+// functions of the distributions.
+//
+// every function has a scalar form and an array form which
+// writes n results to out. out may be the same array as the
+// input. the array forms of exponential, logarithm, logGamma,
+// the error functions and the normal functions are branch-free
+// kernels the compiler can vectorize. they are good to a few
+// ulps, logGamma to about 1e-14. the incomplete gamma and beta
+// functions iterate to convergence element by element, so their
+// array forms only hoist the per-shape work out of the loop.
+#ifndef __OMBT_SPECIAL_FUNCTIONS_H
+#define __OMBT_SPECIAL_FUNCTIONS_H
+
+// system headers
+#include <stddef.h>
+#include <math.h>
+
+namespace ombt {
+
+// exp(x) and log(x), array forms only; the scalar forms are libm
+extern void exponential(const double *x, double *out, size_t n);
+extern void logarithm(const double *x, double *out, size_t n);
+
+// log(gamma(x)) and log(beta(a,b)), thread-safe unlike lgamma()
+extern double logGamma(double x);
+extern void logGamma(const double *x, double *out, size_t n);
+extern double logBeta(double a, double b);
+
+// a*log(x) and a*log(1+x), zero when a is zero
+extern double xlogy(double a, double x);
+extern double xlog1py(double a, double x);
+
+// error function and its complement
+extern double errorFunction(double x);
+extern void errorFunction(const double *x, double *out, size_t n);
+extern double errorFunctionC(double x);
+extern void errorFunctionC(const double *x, double *out, size_t n);
+
+// regularized incomplete gamma, P(a,x) and Q(a,x) = 1-P(a,x),
+// and x such that P(a,x) = p
+extern double gammaP(double a, double x);
+extern void gammaP(double a, const double *x, double *out, size_t n);
+extern double gammaQ(double a, double x);
+extern void gammaQ(double a, const double *x, double *out, size_t n);
+extern double gammaPInverse(double a, double p);
+extern void gammaPInverse(double a, const double *p, double *out, size_t n);
+
+// regularized incomplete beta, I(x;a,b), and x such that
+// I(x;a,b) = p
+extern double betaI(double a, double b, double x);
+extern void betaI(double a, double b, const double *x, double *out, size_t n);
+extern double betaIInverse(double a, double b, double p);
+extern void betaIInverse(double a, double b, const double *p, double *out, size_t n);
+
+// standard normal distribution function and its inverse
+extern double normalCdf(double x);
+extern void normalCdf(const double *x, double *out, size_t n);
+extern double normalQuantile(double p);
+extern void normalQuantile(const double *p, double *out, size_t n);
+
+// quantile of student's t with dof degrees of freedom
+extern double studentQuantile(double p, double dof);
+extern void studentQuantile(double dof, const double *p, double *out, size_t n);
+
+}
+
+#endif
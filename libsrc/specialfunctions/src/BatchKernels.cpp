@@ -0,0 +1,405 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// array forms of the special functions
+//
+// each kernel is straight-line code on doubles and 64-bit
+// integers, special cases are handled with selects instead of
+// branches, and nothing calls into libm, so every loop below
+// vectorizes at -O3 with whatever simd width the target has.
+//
+// exp() reduces x = k*ln2 + r, |r| <= ln2/2, and sums the taylor
+// series of exp(r) to degree 13. log() splits x = m*2^e with m
+// in [sqrt(1/2),sqrt(2)) and sums 2*atanh((m-1)/(m+1)). both
+// are good to 1-2 ulps. erfc() is the chebyshev fit of numerical
+// recipes, 3rd ed., 6.2.2, erfc(z) = t*exp(-z*z + P(t)) with
+// t = 2/(2+z), with the exponent carried in double-double.
+
+// headers
+#include <string.h>
+#include <stdint.h>
+#include <float.h>
+#include "hdr/SpecialFunctions.h"
+
+namespace ombt {
+
+// every array form is also built for avx2 and avx-512, the
+// dynamic loader picks the widest the machine supports.
+#if defined(__GNUC__) && defined(__x86_64__)
+#define ArrayKernel \
+    __attribute__((target_clones("avx512f","avx2","default")))
+#else
+#define ArrayKernel
+#endif
+
+// bit casts
+static inline uint64_t
+toBits(double x)
+{
+    uint64_t b;
+    memcpy(&b, &x, sizeof(b));
+    return(b);
+}
+
+static inline double
+fromBits(uint64_t b)
+{
+    double x;
+    memcpy(&x, &b, sizeof(x));
+    return(x);
+}
+
+// constants
+static const double Magic = 6755399441055744.0;     // 1.5*2^52
+static const double Two52 = 4503599627370496.0;     // 2^52
+static const double Two54 = 18014398509481984.0;    // 2^54
+static const double Ln2Hi = 6.93147180369123816490e-01;
+static const double Ln2Lo = 1.90821492927058770002e-10;
+static const double Log2E = 1.44269504088896338700e+00;
+
+// round to nearest integer, |x| < 2^51
+static inline double
+roundMagic(double x)
+{
+    return((x + Magic) - Magic);
+}
+
+// 2^k for an integral k in [-1022,1023]
+static inline double
+pow2(double k)
+{
+    return(fromBits((toBits(k + Magic) - toBits(Magic) + 1023) << 52));
+}
+
+// exp(x)
+static inline double
+kernelExp(double x)
+{
+    // clamp so 2^k splits into two normal powers
+    x = (x < -746.0) ? -746.0 : x;
+    x = (x > 710.0) ? 710.0 : x;
+
+    double k = roundMagic(x*Log2E);
+    double r = (x - k*Ln2Hi) - k*Ln2Lo;
+
+    double p = 1.0/6227020800.0;
+    p = p*r + 1.0/479001600.0;
+    p = p*r + 1.0/39916800.0;
+    p = p*r + 1.0/3628800.0;
+    p = p*r + 1.0/362880.0;
+    p = p*r + 1.0/40320.0;
+    p = p*r + 1.0/5040.0;
+    p = p*r + 1.0/720.0;
+    p = p*r + 1.0/120.0;
+    p = p*r + 1.0/24.0;
+    p = p*r + 1.0/6.0;
+    p = p*r + 0.5;
+    p = p*r + 1.0;
+    p = p*r + 1.0;
+
+    // scale in two steps, results near the overflow and
+    // underflow limits stay correct
+    double k1 = roundMagic(0.5*k);
+    double k2 = k - k1;
+    return(p*pow2(k1)*pow2(k2));
+}
+
+// log(x)
+static inline double
+kernelLog(double x)
+{
+    // subnormals are scaled into the normal range
+    bool sub = (x < DBL_MIN);
+    double xs = sub ? x*Two54 : x;
+
+    uint64_t b = toBits(xs);
+    double m = fromBits((b & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL);
+    double e = fromBits(0x4330000000000000ULL | ((b >> 52) & 0x7ff)) - Two52;
+    e -= sub ? 1077.0 : 1023.0;
+
+    bool big = (m > M_SQRT2);
+    m = big ? 0.5*m : m;
+    e = big ? e+1.0 : e;
+
+    double s = (m-1.0)/(m+1.0);
+    double s2 = s*s;
+    double p = 1.0/19.0;
+    p = p*s2 + 1.0/17.0;
+    p = p*s2 + 1.0/15.0;
+    p = p*s2 + 1.0/13.0;
+    p = p*s2 + 1.0/11.0;
+    p = p*s2 + 1.0/9.0;
+    p = p*s2 + 1.0/7.0;
+    p = p*s2 + 1.0/5.0;
+    p = p*s2 + 1.0/3.0;
+    double f = 2.0*s + 2.0*s*s2*p;
+
+    double y = e*Ln2Hi + (f + e*Ln2Lo);
+    y = (x == HUGE_VAL) ? HUGE_VAL : y;
+    y = (x > 0.0) ? y : ((x == 0.0) ? -HUGE_VAL : NAN);
+    return(y);
+}
+
+// |sin(pi*x)|
+static inline double
+kernelAbsSinPi(double x)
+{
+    double r = fabs(x) - roundMagic(fabs(x));
+    r = (fabs(x) >= Two52) ? 0.0 : r;
+
+    // taylor series on |r| <= 1/2
+    double r2 = r*r;
+    double p = 5.3926646626081284894e-10;
+    p = p*r2 - 2.294842899726987311e-8;
+    p = p*r2 + 7.9520540014755127848e-7;
+    p = p*r2 - 2.1915353447830215827e-5;
+    p = p*r2 + 4.6630280576761256442e-4;
+    p = p*r2 - 7.3704309457143507773e-3;
+    p = p*r2 + 8.2145886611128228799e-2;
+    p = p*r2 - 5.9926452932079207689e-1;
+    p = p*r2 + 2.5501640398773454439;
+    p = p*r2 - 5.1677127800499700292;
+    p = p*r2 + 3.1415926535897932385;
+    return(fabs(p*r));
+}
+
+// log(gamma(x)). the stirling series for x >= 8, smaller x are
+// shifted up by 8 and x(x+1)...(x+7) divided out, which costs one
+// division where lanczos costs eight. x < 1/2 is reflected.
+static inline double
+kernelLogGamma(double x)
+{
+    bool refl = (x < 0.5);
+    double y = refl ? 1.0-x : x;
+
+    bool shift = (y < 8.0);
+    double p = y*(y+1.0)*(y+2.0)*(y+3.0)*(y+4.0)*(y+5.0)*(y+6.0)*(y+7.0);
+    double z = shift ? y+8.0 : y;
+
+    double r = 1.0/z;
+    double r2 = r*r;
+    double s = -3617.0/122400.0;
+    s = s*r2 + 1.0/156.0;
+    s = s*r2 - 691.0/360360.0;
+    s = s*r2 + 1.0/1188.0;
+    s = s*r2 - 1.0/1680.0;
+    s = s*r2 + 1.0/1260.0;
+    s = s*r2 - 1.0/360.0;
+    s = s*r2 + 1.0/12.0;
+    double lg = (z-0.5)*kernelLog(z) - z + 0.91893853320467274178 + s*r;
+    lg -= shift ? kernelLog(p) : 0.0;
+
+    double lr = kernelLog(M_PI/kernelAbsSinPi(x)) - lg;
+    return(refl ? lr : lg);
+}
+
+// erfc(z) for z >= 0
+static inline double
+kernelErfcPositive(double z)
+{
+    static const double cof[28] = {
+        -1.3026537197817094, 6.4196979235649026e-1,
+        1.9476473204185836e-2, -9.5615147868086316e-3,
+        -9.4659534448203687e-4, 3.6683949785276145e-4,
+        4.2523324806907772e-5, -2.0278578112534243e-5,
+        -1.6242900046470255e-6, 1.3036558355805232e-6,
+        1.5626441722066143e-8, -8.5238095914926543e-8,
+        6.5290544390988515e-9, 5.0593434955514689e-9,
+        -9.9136415649303309e-10, -2.2736512229318359e-10,
+        9.6467911020155268e-11, 2.3940380830391147e-12,
+        -6.8860275264975534e-12, 8.9448792730907257e-13,
+        3.1309213993429581e-13, -1.1270822361367252e-13,
+        3.8109052551892321e-16, 7.1060976136092370e-15,
+        -1.5230282014571043e-15, -9.4574945712912340e-17,
+        1.2102371892242790e-16, -2.8166630877471770e-17
+    };
+
+    // erfc underflows long before z = 30
+    z = (z > 30.0) ? 30.0 : z;
+
+    double t = 2.0/(2.0+z);
+    double ty = 4.0*t - 2.0;
+    double d = 0.0;
+    double dd = 0.0;
+#pragma GCC unroll 27
+    for (int j=27; j>0; --j)
+    {
+        double tmp = d;
+        d = ty*d - dd + cof[j];
+        dd = tmp;
+    }
+    double g = 0.5*(cof[0] + ty*d) - dd;
+
+    // z*z = zz + zzlo exactly, veltkamp splitting
+    double zz = z*z;
+    double c = 134217729.0*z;
+    double zh = c - (c - z);
+    double zl = z - zh;
+    double zzlo = ((zh*zh - zz) + 2.0*zh*zl) + zl*zl;
+
+    // g - zz as a rounded sum plus its error, otherwise the
+    // rounding of the sum costs hundreds of ulps far in the tail
+    double s = g - zz;
+    double bb = s - g;
+    double err = (g - (s - bb)) - (zz + bb);
+
+    return(t*kernelExp(s)*(1.0 + (err - zzlo)));
+}
+
+// erfc(x)
+static inline double
+kernelErfc(double x)
+{
+    double r = kernelErfcPositive(fabs(x));
+    return((x < 0.0) ? 2.0-r : r);
+}
+
+// erf(x), taylor series near zero where 1-erfc(x) cancels
+static inline double
+kernelErf(double x)
+{
+    double x2 = x*x;
+    double p = 9.4227590646504109706e-11;
+    p = p*x2 - 1.2290555301717927353e-9;
+    p = p*x2 + 1.480719281587921724e-8;
+    p = p*x2 - 1.6365844691234924317e-7;
+    p = p*x2 + 1.6462114365889247402e-6;
+    p = p*x2 - 1.4925650358406250977e-5;
+    p = p*x2 + 1.2055332981789664251e-4;
+    p = p*x2 - 8.5483270234508528325e-4;
+    p = p*x2 + 5.2239776254421878421e-3;
+    p = p*x2 - 2.6866170645131251759e-2;
+    p = p*x2 + 1.1283791670955125739e-1;
+    p = p*x2 - 3.7612638903183752463e-1;
+    p = p*x2 + 1.1283791670955125739;
+    double near = p*x;
+
+    double far = 1.0 - kernelErfcPositive(fabs(x));
+    far = (x < 0.0) ? -far : far;
+    return((fabs(x) < 0.5) ? near : far);
+}
+
+// standard normal quantile, acklam plus one halley step
+static inline double
+kernelNormalQuantile(double p)
+{
+    static const double a0 = -3.969683028665376e+01;
+    static const double a1 = 2.209460984245205e+02;
+    static const double a2 = -2.759285104469687e+02;
+    static const double a3 = 1.383577518672690e+02;
+    static const double a4 = -3.066479806614716e+01;
+    static const double a5 = 2.506628277459239e+00;
+    static const double b0 = -5.447609879822406e+01;
+    static const double b1 = 1.615858368580409e+02;
+    static const double b2 = -1.556989798598866e+02;
+    static const double b3 = 6.680131188771972e+01;
+    static const double b4 = -1.328068155288572e+01;
+    static const double c0 = -7.784894002430293e-03;
+    static const double c1 = -3.223964580411365e-01;
+    static const double c2 = -2.400758277161838e+00;
+    static const double c3 = -2.549732539343734e+00;
+    static const double c4 = 4.374664141464968e+00;
+    static const double c5 = 2.938163982698783e+00;
+    static const double d0 = 7.784695709041462e-03;
+    static const double d1 = 3.224671290700398e-01;
+    static const double d2 = 2.445134137142996e+00;
+    static const double d3 = 3.754408661907416e+00;
+    static const double plow = 0.02425;
+
+    // central region
+    double q = p - 0.5;
+    double r = q*q;
+    double xc = (((((a0*r+a1)*r+a2)*r+a3)*r+a4)*r+a5)*q/
+                (((((b0*r+b1)*r+b2)*r+b3)*r+b4)*r+1.0);
+
+    // tails, 1-p is exact for p >= 1/2
+    bool upper = (p > 0.5);
+    double pt = upper ? 1.0-p : p;
+    pt = (pt > 0.0) ? pt : DBL_MIN;
+    double s = sqrt(-2.0*kernelLog(pt));
+    double xt = (((((c0*s+c1)*s+c2)*s+c3)*s+c4)*s+c5)/
+                ((((d0*s+d1)*s+d2)*s+d3)*s+1.0);
+    xt = upper ? -xt : xt;
+
+    double x = (pt < plow) ? xt : xc;
+
+    // halley step, upper residual measured from 1
+    double w = 0.5*kernelErfcPositive(fabs(x)*M_SQRT1_2);
+    double e = (x < 0.0) ? w - p : (1.0-p) - w;
+    double u = e*2.50662827463100050242*kernelExp(0.5*x*x);
+    x = x - u/(1.0 + 0.5*x*u);
+
+    // limits and domain errors
+    x = (p == 0.0) ? -HUGE_VAL : x;
+    x = (p == 1.0) ? HUGE_VAL : x;
+    x = (p >= 0.0 && p <= 1.0) ? x : NAN;
+    return(x);
+}
+
+// array forms
+ArrayKernel void
+exponential(const double *x, double *out, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = kernelExp(x[i]);
+    }
+}
+
+ArrayKernel void
+logarithm(const double *x, double *out, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = kernelLog(x[i]);
+    }
+}
+
+ArrayKernel void
+logGamma(const double *x, double *out, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = kernelLogGamma(x[i]);
+    }
+}
+
+ArrayKernel void
+errorFunction(const double *x, double *out, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = kernelErf(x[i]);
+    }
+}
+
+ArrayKernel void
+errorFunctionC(const double *x, double *out, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = kernelErfc(x[i]);
+    }
+}
+
+ArrayKernel void
+normalCdf(const double *x, double *out, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = 0.5*kernelErfc(-x[i]*M_SQRT1_2);
+    }
+}
+
+ArrayKernel void
+normalQuantile(const double *p, double *out, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = kernelNormalQuantile(p[i]);
+    }
+}
+
+}
@@ -0,0 +1,484 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// special functions
+//
+// log(gamma(x)) uses the lanczos approximation (g=7, 9 terms),
+// with the reflection formula below 1/2. the incomplete gamma
+// function is a series for x < a+1 and a continued fraction 
+// otherwise, the incomplete beta function is a continued fraction
+// on whichever side of the mean converges fastest. the inverses
+// start from the usual normal approximations and are polished
+// with halley steps (numerical recipes, 3rd ed., 6.2 and 6.4).
+// the normal quantile is acklam's rational approximation plus 
+// one halley step, good to about 1e-15. the vectorized array
+// forms are in BatchKernels.cpp.
+
+// headers
+#include <float.h>
+#include "hdr/SpecialFunctions.h"
+
+namespace ombt {
+
+// tolerances
+static const double SFEpsilon = DBL_EPSILON;
+static const double SFTiny = DBL_MIN/DBL_EPSILON;
+static const int SFMaxIterations = 1000000;
+
+// log(gamma(x))
+double
+logGamma(double x)
+{
+    static const double p[9] = {
+        0.99999999999980993, 676.5203681218851, -1259.1392167224028,
+        771.32342877765313, -176.61502916214059, 12.507343278686905,
+        -0.13857109526572012, 9.9843695780195716e-6, 
+        1.5056327351493116e-7
+    };
+
+    // reduce before sin() so the poles stay sharp
+    if (x < 0.5)
+        return(log(M_PI/fabs(sin(M_PI*(x-rint(x))))) - logGamma(1.0-x));
+
+    x -= 1.0;
+    double a = p[0];
+    double t = x + 7.5;
+    for (int i=1; i<9; ++i)
+    {
+        a += p[i]/(x+i);
+    }
+    return(0.5*log(2*M_PI) + (x+0.5)*log(t) - t + log(a));
+}
+
+double
+logBeta(double a, double b)
+{
+    // one argument dwarfs the other, avoid inf - inf
+    double lo = (a < b) ? a : b;
+    double hi = (a < b) ? b : a;
+    if (hi > 1.0e10*(lo+1.0))
+        return(logGamma(lo) - lo*log(hi));
+    return(logGamma(a) + logGamma(b) - logGamma(a+b));
+}
+
+double
+xlogy(double a, double x)
+{
+    return((a == 0.0) ? 0.0 : a*log(x));
+}
+
+double
+xlog1py(double a, double x)
+{
+    return((a == 0.0) ? 0.0 : a*log1p(x));
+}
+
+// incomplete gamma, series for P. gln is logGamma(a).
+static double
+gammaPSeries(double a, double x, double gln)
+{
+    double ap = a;
+    double del = 1.0/a;
+    double sum = del;
+    for (int n=0; n<SFMaxIterations; ++n)
+    {
+        ap += 1.0;
+        del *= x/ap;
+        sum += del;
+        if (fabs(del) < fabs(sum)*SFEpsilon) break;
+    }
+    return(sum*exp(-x + a*log(x) - gln));
+}
+
+// incomplete gamma, continued fraction for Q
+static double
+gammaQFraction(double a, double x, double gln)
+{
+    double b = x + 1.0 - a;
+    double c = 1.0/SFTiny;
+    double d = 1.0/b;
+    double h = d;
+    for (int i=1; i<SFMaxIterations; ++i)
+    {
+        double an = -i*(i-a);
+        b += 2.0;
+        d = an*d + b;
+        if (fabs(d) < SFTiny) d = SFTiny;
+        c = b + an/c;
+        if (fabs(c) < SFTiny) c = SFTiny;
+        d = 1.0/d;
+        double del = d*c;
+        h *= del;
+        if (fabs(del-1.0) <= SFEpsilon) break;
+    }
+    return(exp(-x + a*log(x) - gln)*h);
+}
+
+static double
+gammaP(double a, double x, double gln)
+{
+    if (x <= 0.0) return(0.0);
+    if (isinf(x)) return(1.0);
+    if (x < a+1.0) return(gammaPSeries(a, x, gln));
+    return(1.0 - gammaQFraction(a, x, gln));
+}
+
+static double
+gammaQ(double a, double x, double gln)
+{
+    if (x <= 0.0) return(1.0);
+    if (isinf(x)) return(0.0);
+    if (x < a+1.0) return(1.0 - gammaPSeries(a, x, gln));
+    return(gammaQFraction(a, x, gln));
+}
+
+static double
+gammaPInverse(double a, double p, double gln)
+{
+    if (isnan(p)) return(p);
+    if (p <= 0.0) return(0.0);
+    if (p >= 1.0) return(HUGE_VAL);
+
+    double a1 = a - 1.0;
+    double lna1 = 0.0;
+    double afac = 0.0;
+    double x, t;
+
+    if (a > 1.0)
+    {
+        lna1 = log(a1);
+        afac = exp(a1*(lna1-1.0) - gln);
+        double pp = (p < 0.5) ? p : 1.0-p;
+        t = sqrt(-2.0*log(pp));
+        x = (2.30753 + t*0.27061)/(1.0 + t*(0.99229 + t*0.04481)) - t;
+        if (p < 0.5) x = -x;
+        x = 1.0 - 1.0/(9.0*a) - x/(3.0*sqrt(a));
+        x = a*x*x*x;
+        if (x < 1.0e-3) x = 1.0e-3;
+    }
+    else
+    {
+        t = 1.0 - a*(0.253 + a*0.12);
+        if (p < t)
+            x = pow(p/t, 1.0/a);
+        else
+            x = 1.0 - log(1.0 - (p-t)/(1.0-t));
+    }
+
+    for (int j=0; j<100; ++j)
+    {
+        if (x <= 0.0) return(0.0);
+        double err = gammaP(a, x, gln) - p;
+        if (a > 1.0)
+            t = afac*exp(-(x-a1) + a1*(log(x)-lna1));
+        else
+            t = exp(-x + a1*log(x) - gln);
+        if (t == 0.0) break;
+        double u = err/t;
+        double corr = u*((a-1.0)/x - 1.0);
+        t = u/(1.0 - 0.5*((corr < 1.0) ? corr : 1.0));
+        x -= t;
+        if (x <= 0.0) x = 0.5*(x+t);
+        if (fabs(t) < 1.0e-13*x) break;
+    }
+    return(x);
+}
+
+double
+gammaP(double a, double x)
+{
+    return(gammaP(a, x, logGamma(a)));
+}
+
+void
+gammaP(double a, const double *x, double *out, size_t n)
+{
+    const double gln = logGamma(a);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = gammaP(a, x[i], gln);
+    }
+}
+
+double
+gammaQ(double a, double x)
+{
+    return(gammaQ(a, x, logGamma(a)));
+}
+
+void
+gammaQ(double a, const double *x, double *out, size_t n)
+{
+    const double gln = logGamma(a);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = gammaQ(a, x[i], gln);
+    }
+}
+
+double
+gammaPInverse(double a, double p)
+{
+    return(gammaPInverse(a, p, logGamma(a)));
+}
+
+void
+gammaPInverse(double a, const double *p, double *out, size_t n)
+{
+    const double gln = logGamma(a);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = gammaPInverse(a, p[i], gln);
+    }
+}
+
+// incomplete beta, continued fraction
+static double
+betaFraction(double a, double b, double x)
+{
+    double qab = a + b;
+    double qap = a + 1.0;
+    double qam = a - 1.0;
+    double c = 1.0;
+    double d = 1.0 - qab*x/qap;
+    if (fabs(d) < SFTiny) d = SFTiny;
+    d = 1.0/d;
+    double h = d;
+    for (int m=1; m<SFMaxIterations; ++m)
+    {
+        int m2 = 2*m;
+        double aa = m*(b-m)*x/((qam+m2)*(a+m2));
+        d = 1.0 + aa*d;
+        if (fabs(d) < SFTiny) d = SFTiny;
+        c = 1.0 + aa/c;
+        if (fabs(c) < SFTiny) c = SFTiny;
+        d = 1.0/d;
+        h *= d*c;
+        aa = -(a+m)*(qab+m)*x/((a+m2)*(qap+m2));
+        d = 1.0 + aa*d;
+        if (fabs(d) < SFTiny) d = SFTiny;
+        c = 1.0 + aa/c;
+        if (fabs(c) < SFTiny) c = SFTiny;
+        d = 1.0/d;
+        double del = d*c;
+        h *= del;
+        if (fabs(del-1.0) <= SFEpsilon) break;
+    }
+    return(h);
+}
+
+// incomplete beta, lbeta is logBeta(a,b)
+static double
+betaI(double a, double b, double x, double lbeta)
+{
+    if (x <= 0.0) return(0.0);
+    if (x >= 1.0) return(1.0);
+
+    double bt = exp(-lbeta + a*log(x) + b*log1p(-x));
+    bool lower = (x < (a+1.0)/(a+b+2.0));
+    if (bt == 0.0)
+        return(lower ? 0.0 : 1.0);
+    else if (lower)
+        return(bt*betaFraction(a, b, x)/a);
+    else
+        return(1.0 - bt*betaFraction(b, a, 1.0-x)/b);
+}
+
+static double
+betaIInverse(double a, double b, double p, double lbeta)
+{
+    if (isnan(p)) return(p);
+    if (p <= 0.0) return(0.0);
+    if (p >= 1.0) return(1.0);
+
+    double a1 = a - 1.0;
+    double b1 = b - 1.0;
+    double x, t, u;
+
+    if (a >= 1.0 && b >= 1.0)
+    {
+        double pp = (p < 0.5) ? p : 1.0-p;
+        t = sqrt(-2.0*log(pp));
+        x = (2.30753 + t*0.27061)/(1.0 + t*(0.99229 + t*0.04481)) - t;
+        if (p < 0.5) x = -x;
+        double al = (x*x - 3.0)/6.0;
+        double h = 2.0/(1.0/(2.0*a-1.0) + 1.0/(2.0*b-1.0));
+        double w = x*sqrt(al+h)/h - 
+                   (1.0/(2.0*b-1.0) - 1.0/(2.0*a-1.0))*
+                   (al + 5.0/6.0 - 2.0/(3.0*h));
+        x = a/(a + b*exp(2.0*w));
+    }
+    else
+    {
+        double lna = log(a/(a+b));
+        double lnb = log(b/(a+b));
+        t = exp(a*lna)/a;
+        u = exp(b*lnb)/b;
+        double w = t + u;
+        if (p < t/w)
+            x = pow(a*w*p, 1.0/a);
+        else
+            x = 1.0 - pow(b*w*(1.0-p), 1.0/b);
+    }
+
+    double afac = -lbeta;
+    for (int j=0; j<100; ++j)
+    {
+        if (x == 0.0 || x == 1.0) return(x);
+        double err = betaI(a, b, x, lbeta) - p;
+        t = exp(a1*log(x) + b1*log1p(-x) + afac);
+        u = err/t;
+        double corr = u*(a1/x - b1/(1.0-x));
+        t = u/(1.0 - 0.5*((corr < 1.0) ? corr : 1.0));
+        x -= t;
+        if (x <= 0.0) x = 0.5*(x+t);
+        if (x >= 1.0) x = 0.5*(x+t+1.0);
+        if (fabs(t) < 1.0e-13*x && j > 0) break;
+    }
+    return(x);
+}
+
+double
+betaI(double a, double b, double x)
+{
+    return(betaI(a, b, x, logBeta(a, b)));
+}
+
+void
+betaI(double a, double b, const double *x, double *out, size_t n)
+{
+    const double lbeta = logBeta(a, b);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = betaI(a, b, x[i], lbeta);
+    }
+}
+
+double
+betaIInverse(double a, double b, double p)
+{
+    return(betaIInverse(a, b, p, logBeta(a, b)));
+}
+
+void
+betaIInverse(double a, double b, const double *p, double *out, size_t n)
+{
+    const double lbeta = logBeta(a, b);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = betaIInverse(a, b, p[i], lbeta);
+    }
+}
+
+// error function, libm is accurate and reentrant
+double
+errorFunction(double x)
+{
+    return(erf(x));
+}
+
+double
+errorFunctionC(double x)
+{
+    return(erfc(x));
+}
+
+// standard normal
+double
+normalCdf(double x)
+{
+    return(0.5*erfc(-x*M_SQRT1_2));
+}
+
+double
+normalQuantile(double p)
+{
+    static const double a[6] = {
+        -3.969683028665376e+01, 2.209460984245205e+02,
+        -2.759285104469687e+02, 1.383577518672690e+02,
+        -3.066479806614716e+01, 2.506628277459239e+00
+    };
+    static const double b[5] = {
+        -5.447609879822406e+01, 1.615858368580409e+02,
+        -1.556989798598866e+02, 6.680131188771972e+01,
+        -1.328068155288572e+01
+    };
+    static const double c[6] = {
+        -7.784894002430293e-03, -3.223964580411365e-01,
+        -2.400758277161838e+00, -2.549732539343734e+00,
+        4.374664141464968e+00, 2.938163982698783e+00
+    };
+    static const double d[4] = {
+        7.784695709041462e-03, 3.224671290700398e-01,
+        2.445134137142996e+00, 3.754408661907416e+00
+    };
+    static const double plow = 0.02425;
+    static const double phigh = 1.0 - plow;
+
+    if (p <= 0.0) return((p == 0.0) ? -HUGE_VAL : NAN);
+    if (p >= 1.0) return((p == 1.0) ? HUGE_VAL : NAN);
+
+    double x;
+    if (p < plow)
+    {
+        double q = sqrt(-2.0*log(p));
+        x = (((((c[0]*q+c[1])*q+c[2])*q+c[3])*q+c[4])*q+c[5])/
+            ((((d[0]*q+d[1])*q+d[2])*q+d[3])*q+1.0);
+    }
+    else if (p <= phigh)
+    {
+        double q = p - 0.5;
+        double r = q*q;
+        x = (((((a[0]*r+a[1])*r+a[2])*r+a[3])*r+a[4])*r+a[5])*q/
+            (((((b[0]*r+b[1])*r+b[2])*r+b[3])*r+b[4])*r+1.0);
+    }
+    else
+    {
+        double q = sqrt(-2.0*log1p(-p));
+        x = -(((((c[0]*q+c[1])*q+c[2])*q+c[3])*q+c[4])*q+c[5])/
+             ((((d[0]*q+d[1])*q+d[2])*q+d[3])*q+1.0);
+    }
+
+    // one halley step, upper tail measured from 1 to keep the
+    // residual accurate when p is close to 1.
+    double e = (x < 0.0) ? normalCdf(x) - p 
+                         : (1.0-p) - 0.5*erfc(x*M_SQRT1_2);
+    double u = e*sqrt(2*M_PI)*exp(0.5*x*x);
+    return(x - u/(1.0 + 0.5*x*u));
+}
+
+// student's t from the incomplete beta: the two tails beyond t
+// have probability I(dof/(dof+t*t); dof/2, 1/2).
+static double
+studentQuantile(double p, double dof, double lbeta)
+{
+    if (isnan(p) || !(dof > 0.0)) return(NAN);
+    if (p <= 0.0) return((p == 0.0) ? -HUGE_VAL : NAN);
+    if (p >= 1.0) return((p == 1.0) ? HUGE_VAL : NAN);
+    if (p == 0.5) return(0.0);
+
+    double tail = (p < 0.5) ? 2.0*p : 2.0*(1.0-p);
+    double x = betaIInverse(0.5*dof, 0.5, tail, lbeta);
+    double t = sqrt(dof*(1.0-x)/x);
+    return((p < 0.5) ? -t : t);
+}
+
+double
+studentQuantile(double p, double dof)
+{
+    return(studentQuantile(p, dof, logBeta(0.5*dof, 0.5)));
+}
+
+void
+studentQuantile(double dof, const double *p, double *out, size_t n)
+{
+    const double lbeta = logBeta(0.5*dof, 0.5);
+    for (size_t i=0; i<n; ++i)
+    {
+        out[i] = studentQuantile(p[i], dof, lbeta);
+    }
+}
+
+}
@@ -0,0 +1,139 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_HDR_HISTOGRAM_H
+#define __OMBT_HDR_HISTOGRAM_H
+
+// high dynamic range histogram, after gil tene's HdrHistogram.
+//
+// values from lowest to highest are counted in units of lowest.
+// the unit counts fall in power-of-two buckets, each cut into
+// linear sub-buckets, enough of them that any value is known to
+// the given number of significant decimal digits. the memory is
+// fixed by the range and the digits, record() is a few shifts
+// and one add, whatever the value.
+//
+// the counts are kept in shards. a thread always records into the
+// same shard, with a relaxed atomic add, so threads on different
+// shards never share a cache line and no locks are taken. queries
+// add the shards up as they go; counts recorded while a query runs
+// may or may not be seen.
+//
+// values below zero, and nans, are counted as underflow, and
+// values above highest as overflow, neither in the buckets.
+// values between zero and lowest count in the first unit.
+
+// system headers
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+
+namespace ombt {
+
+// hdr histogram
+class HdrHistogram: public BaseObject
+{
+public:
+    // limits
+    enum {
+        MinimumDigits = 1,
+        MaximumDigits = 5,
+        DefaultDigits = 3
+    };
+
+    // ctors and dtor
+    HdrHistogram();
+    HdrHistogram(double lowest, double highest,
+                 int digits = DefaultDigits, unsigned shards = 1);
+    HdrHistogram(const HdrHistogram &src);
+    ~HdrHistogram();
+
+    // assignment, copies a snapshot into one shard
+    HdrHistogram &operator=(const HdrHistogram &rhs);
+
+    // record values. these may be called from any thread.
+    inline void record(double value) {
+        record(value, 1);
+    }
+    void record(double value, uint64_t count);
+
+    // reducer interface, so a histogram can also collect sampler
+    // output. clear() must not run while others record.
+    void clear();
+    void add(const double *x, size_t n);
+    void merge(const HdrHistogram &other);
+
+    // results. quantile() gives the largest value equivalent to
+    // the one at quantile q in [0,1], percentile() the same for p
+    // in [0,100]. nan when empty.
+    uint64_t count() const;
+    uint64_t underflow() const;
+    uint64_t overflow() const;
+    double quantile(double q) const;
+    double percentile(double p) const { return(quantile(p/100.0)); }
+    double minimum() const;
+    double maximum() const;
+    double mean() const;
+
+    // layout
+    double lowest() const { return(lowest_); }
+    double highest() const { return(highest_); }
+    int digits() const { return(digits_); }
+    unsigned shards() const { return(nshards_); }
+    size_t buckets() const { return(ncounts_); }
+
+    // values equivalent to a value, that is counted with it
+    double lowestEquivalent(double value) const;
+    double highestEquivalent(double value) const;
+
+protected:
+    // index of the counter for a value in units of lowest
+    inline size_t index(uint64_t v) const {
+        int pow2ceiling = 64 - __builtin_clzll(v | submask_);
+        int bucket = pow2ceiling - (halfmagnitude_ + 1);
+        size_t sub = size_t(v >> bucket);
+        return((size_t(bucket + 1) << halfmagnitude_) + sub - halfcount_);
+    }
+
+    // first and last unit counted by a counter
+    uint64_t lowestUnit(size_t i) const;
+    uint64_t highestUnit(size_t i) const;
+
+    // the shard for the calling thread
+    uint64_t *shard() const;
+
+    // one counter summed over the shards
+    uint64_t total(size_t i) const;
+
+    // set up the layout
+    void layout(double lowest, double highest, int digits,
+                unsigned shards);
+
+protected:
+    // internal data. each shard holds the counters, then underflow
+    // and overflow, padded to whole cache lines.
+    double lowest_;
+    double highest_;
+    double scale_;
+    uint64_t highestunit_;
+    int digits_;
+    int halfmagnitude_;
+    size_t halfcount_;
+    uint64_t submask_;
+    size_t ncounts_;
+    size_t stride_;
+    unsigned nshards_;
+    std::vector<uint64_t> counts_;
+};
+
+}
+
+#endif
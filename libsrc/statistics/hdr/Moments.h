@@ -0,0 +1,100 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_MOMENTS_H
+#define __OMBT_MOMENTS_H
+
+// streaming descriptive statistics: count, mean, variance,
+// skewness, kurtosis, minimum and maximum in one pass.
+//
+// the running state is the count, the mean and the sums of the
+// 2nd, 3rd and 4th powers of the deviations from the mean. single
+// values use the welford/terriberry update, accumulators combine
+// with the pairwise formulas of pebay (sandia report 2008-6212).
+// a block of values is reduced with two passes over the block,
+// lane by lane so it vectorizes, then combined like an accumulator.
+//
+// merging is not exactly associative in floating point. combine
+// partial results in a fixed order if the bits have to repeat.
+
+// system headers
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/BaseObject.h"
+
+namespace ombt {
+
+// moments accumulator
+class Moments: public BaseObject
+{
+public:
+    // sizes for the block reduction
+    enum {
+        Lanes = 8,
+        BlockSize = 1024
+    };
+
+    // ctors and dtor
+    Moments();
+    Moments(const double *x, size_t n);
+    Moments(const Moments &src);
+    ~Moments();
+
+    // assignment
+    Moments &operator=(const Moments &rhs);
+
+    // accumulate
+    void clear();
+    void add(double x);
+    void add(const double *x, size_t n);
+    void merge(const Moments &other);
+    Moments &operator+=(const Moments &other) {
+        merge(other);
+        return(*this);
+    }
+
+    // results. variance is the unbiased estimate, skewness and
+    // kurtosis are the sample g1 and excess g2. nan when there
+    // are too few values. nans in the data propagate to all but
+    // the minimum and maximum, which ignore them.
+    uint64_t count() const { return(count_); }
+    double sum() const { return(mean_*count_); }
+    double mean() const;
+    double variance() const;
+    double populationVariance() const;
+    double standardDeviation() const;
+    double skewness() const;
+    double kurtosis() const;
+    double minimum() const { return(min_); }
+    double maximum() const { return(max_); }
+
+protected:
+    // combine with n values of the given mean, central sums m2,
+    // m3 and m4, minimum and maximum
+    void combine(uint64_t n, double mean, double m2, double m3,
+                 double m4, double min, double max);
+
+    // reduce at most BlockSize values and combine them
+    void addBlock(const double *x, size_t n);
+
+protected:
+    // internal data
+    uint64_t count_;
+    double mean_;
+    double m2_;
+    double m3_;
+    double m4_;
+    double min_;
+    double max_;
+};
+
+}
+
+#endif
@@ -0,0 +1,336 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// high dynamic range histogram
+
+// system headers
+#include <stdint.h>
+
+// headers
+#include "hdr/HdrHistogram.h"
+
+namespace ombt {
+
+// threads are handed shard numbers in the order they first record
+static unsigned nextshard = 0;
+static __thread unsigned threadshard = 0;
+
+// counters per cache line
+static const size_t CacheLine = 64/sizeof(uint64_t);
+
+// ctors and dtor
+HdrHistogram::HdrHistogram():
+    BaseObject(false), lowest_(0.0), highest_(0.0), scale_(0.0),
+    highestunit_(0), digits_(0), halfmagnitude_(0), halfcount_(0),
+    submask_(0), ncounts_(0), stride_(0), nshards_(0), counts_()
+{
+    setOk(false);
+}
+
+HdrHistogram::HdrHistogram(double lowest, double highest,
+                           int digits, unsigned shards):
+    BaseObject(true), lowest_(0.0), highest_(0.0), scale_(0.0),
+    highestunit_(0), digits_(0), halfmagnitude_(0), halfcount_(0),
+    submask_(0), ncounts_(0), stride_(0), nshards_(0), counts_()
+{
+    layout(lowest, highest, digits, shards);
+}
+
+HdrHistogram::HdrHistogram(const HdrHistogram &src):
+    BaseObject(src), lowest_(0.0), highest_(0.0), scale_(0.0),
+    highestunit_(0), digits_(0), halfmagnitude_(0), halfcount_(0),
+    submask_(0), ncounts_(0), stride_(0), nshards_(0), counts_()
+{
+    if (src.isOk())
+    {
+        layout(src.lowest_, src.highest_, src.digits_, src.nshards_);
+        merge(src);
+    }
+}
+
+HdrHistogram::~HdrHistogram()
+{
+}
+
+// assignment
+HdrHistogram &
+HdrHistogram::operator=(const HdrHistogram &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        counts_.clear();
+        if (rhs.isOk())
+        {
+            layout(rhs.lowest_, rhs.highest_, rhs.digits_, rhs.nshards_);
+            merge(rhs);
+        }
+    }
+    return(*this);
+}
+
+// set up the layout
+void
+HdrHistogram::layout(double lowest, double highest, int digits,
+                     unsigned shards)
+{
+    if (!(lowest > 0.0) || !(highest >= 2.0*lowest) ||
+        !(highest/lowest < 4.0e18) || digits < MinimumDigits ||
+        digits > MaximumDigits || shards == 0)
+    {
+        setOk(false);
+        return;
+    }
+
+    lowest_ = lowest;
+    highest_ = highest;
+    scale_ = 1.0/lowest;
+    highestunit_ = uint64_t(highest*scale_);
+    digits_ = digits;
+    nshards_ = shards;
+
+    // sub-buckets to resolve 2*10^digits units one by one
+    uint64_t single = 2;
+    for (int d=0; d<digits; ++d) single *= 10;
+    int magnitude = 0;
+    while ((uint64_t(1) << magnitude) < single) ++magnitude;
+    halfmagnitude_ = magnitude - 1;
+    halfcount_ = size_t(1) << halfmagnitude_;
+    submask_ = (uint64_t(1) << magnitude) - 1;
+
+    // buckets to reach the highest unit
+    size_t nbuckets = 1;
+    uint64_t untrackable = uint64_t(1) << magnitude;
+    while (untrackable <= highestunit_)
+    {
+        ++nbuckets;
+        if (untrackable > (uint64_t(1) << 62)) break;
+        untrackable <<= 1;
+    }
+    ncounts_ = (nbuckets + 1)*halfcount_;
+
+    // room for underflow and overflow, and for lining the first
+    // shard up with a cache line
+    stride_ = (ncounts_ + 2 + CacheLine - 1)/CacheLine*CacheLine;
+    counts_.assign(stride_*nshards_ + CacheLine, 0);
+}
+
+// first and last unit counted by a counter
+uint64_t
+HdrHistogram::lowestUnit(size_t i) const
+{
+    int bucket = int(i >> halfmagnitude_) - 1;
+    uint64_t sub = (i & (halfcount_ - 1)) + halfcount_;
+    if (bucket < 0)
+    {
+        sub -= halfcount_;
+        bucket = 0;
+    }
+    return(sub << bucket);
+}
+
+uint64_t
+HdrHistogram::highestUnit(size_t i) const
+{
+    int bucket = int(i >> halfmagnitude_) - 1;
+    if (bucket < 0) bucket = 0;
+    return(lowestUnit(i) + (uint64_t(1) << bucket) - 1);
+}
+
+// the shard for the calling thread
+uint64_t *
+HdrHistogram::shard() const
+{
+    if (threadshard == 0)
+        threadshard = __sync_add_and_fetch(&nextshard, 1);
+    const uint64_t *base = &counts_[0];
+    size_t align = (CacheLine - (uintptr_t(base)/sizeof(uint64_t)) %
+                   CacheLine) % CacheLine;
+    return(const_cast<uint64_t *>(base) + align +
+           ((threadshard - 1) % nshards_)*stride_);
+}
+
+// one counter summed over the shards
+uint64_t
+HdrHistogram::total(size_t i) const
+{
+    const uint64_t *base = &counts_[0];
+    size_t align = (CacheLine - (uintptr_t(base)/sizeof(uint64_t)) %
+                   CacheLine) % CacheLine;
+    uint64_t sum = 0;
+    for (unsigned s=0; s<nshards_; ++s)
+    {
+        sum += __atomic_load_n(base + align + s*stride_ + i,
+                               __ATOMIC_RELAXED);
+    }
+    return(sum);
+}
+
+// record values
+void
+HdrHistogram::record(double value, uint64_t count)
+{
+    MustBeTrue(isOk());
+    uint64_t *counts = shard();
+    size_t i;
+    double unit = value*scale_;
+    if (!(unit >= 0.0))
+        i = ncounts_;
+    else if (unit > double(highestunit_))
+        i = ncounts_ + 1;
+    else
+        i = index(uint64_t(unit));
+    __atomic_fetch_add(counts + i, count, __ATOMIC_RELAXED);
+}
+
+// reducer interface
+void
+HdrHistogram::clear()
+{
+    for (size_t i=0; i<counts_.size(); ++i)
+    {
+        __atomic_store_n(&counts_[i], 0, __ATOMIC_RELAXED);
+    }
+}
+
+void
+HdrHistogram::add(const double *x, size_t n)
+{
+    MustBeTrue(isOk());
+    uint64_t *counts = shard();
+    for (size_t k=0; k<n; ++k)
+    {
+        size_t i;
+        double unit = x[k]*scale_;
+        if (!(unit >= 0.0))
+            i = ncounts_;
+        else if (unit > double(highestunit_))
+            i = ncounts_ + 1;
+        else
+            i = index(uint64_t(unit));
+        __atomic_fetch_add(counts + i, 1, __ATOMIC_RELAXED);
+    }
+}
+
+void
+HdrHistogram::merge(const HdrHistogram &other)
+{
+    MustBeTrue(isOk() && other.isOk());
+    MustBeTrue(lowest_ == other.lowest_ && highest_ == other.highest_ &&
+               digits_ == other.digits_);
+    uint64_t *counts = shard();
+    for (size_t i=0; i<ncounts_+2; ++i)
+    {
+        uint64_t t = other.total(i);
+        if (t != 0) __atomic_fetch_add(counts + i, t, __ATOMIC_RELAXED);
+    }
+}
+
+// results
+uint64_t
+HdrHistogram::count() const
+{
+    uint64_t sum = 0;
+    for (size_t i=0; i<ncounts_; ++i)
+    {
+        sum += total(i);
+    }
+    return(sum);
+}
+
+uint64_t
+HdrHistogram::underflow() const
+{
+    return(isOk() ? total(ncounts_) : 0);
+}
+
+uint64_t
+HdrHistogram::overflow() const
+{
+    return(isOk() ? total(ncounts_+1) : 0);
+}
+
+double
+HdrHistogram::quantile(double q) const
+{
+    MustBeTrue(isOk());
+    uint64_t n = count();
+    if (n == 0 || isnan(q)) return(NAN);
+    if (q <= 0.0) return(minimum());
+    if (q > 1.0) q = 1.0;
+
+    // the value at rank ceil(qn), counted from 1
+    uint64_t rank = uint64_t(ceil(q*double(n)));
+    if (rank < 1) rank = 1;
+    uint64_t sofar = 0;
+    for (size_t i=0; i<ncounts_; ++i)
+    {
+        sofar += total(i);
+        if (sofar >= rank) return(highestUnit(i)*lowest_);
+    }
+    return(maximum());
+}
+
+double
+HdrHistogram::minimum() const
+{
+    MustBeTrue(isOk());
+    for (size_t i=0; i<ncounts_; ++i)
+    {
+        if (total(i) != 0) return(lowestUnit(i)*lowest_);
+    }
+    return(NAN);
+}
+
+double
+HdrHistogram::maximum() const
+{
+    MustBeTrue(isOk());
+    for (size_t i=ncounts_; i-- > 0; )
+    {
+        if (total(i) != 0) return(highestUnit(i)*lowest_);
+    }
+    return(NAN);
+}
+
+double
+HdrHistogram::mean() const
+{
+    MustBeTrue(isOk());
+    double sum = 0.0;
+    uint64_t n = 0;
+    for (size_t i=0; i<ncounts_; ++i)
+    {
+        uint64_t t = total(i);
+        if (t == 0) continue;
+        // middle of the units counted here
+        double middle = 0.5*(double(lowestUnit(i)) +
+                             double(highestUnit(i)) + 1.0);
+        sum += t*middle;
+        n += t;
+    }
+    return((n > 0) ? sum/n*lowest_ : NAN);
+}
+
+// values counted together with a value
+double
+HdrHistogram::lowestEquivalent(double value) const
+{
+    MustBeTrue(isOk());
+    double unit = value*scale_;
+    if (!(unit >= 0.0) || unit > double(highestunit_)) return(NAN);
+    return(lowestUnit(index(uint64_t(unit)))*lowest_);
+}
+
+double
+HdrHistogram::highestEquivalent(double value) const
+{
+    MustBeTrue(isOk());
+    double unit = value*scale_;
+    if (!(unit >= 0.0) || unit > double(highestunit_)) return(NAN);
+    return(highestUnit(index(uint64_t(unit)))*lowest_);
+}
+
+}
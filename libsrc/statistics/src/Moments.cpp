@@ -0,0 +1,278 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// streaming descriptive statistics
+
+// headers
+#include "hdr/Moments.h"
+
+namespace ombt {
+
+// ctors and dtor
+Moments::Moments():
+    BaseObject(true), count_(0), mean_(0.0), m2_(0.0), m3_(0.0),
+    m4_(0.0), min_(HUGE_VAL), max_(-HUGE_VAL)
+{
+}
+
+Moments::Moments(const double *x, size_t n):
+    BaseObject(true), count_(0), mean_(0.0), m2_(0.0), m3_(0.0),
+    m4_(0.0), min_(HUGE_VAL), max_(-HUGE_VAL)
+{
+    add(x, n);
+}
+
+Moments::Moments(const Moments &src):
+    BaseObject(src), count_(src.count_), mean_(src.mean_),
+    m2_(src.m2_), m3_(src.m3_), m4_(src.m4_),
+    min_(src.min_), max_(src.max_)
+{
+}
+
+Moments::~Moments()
+{
+}
+
+// assignment
+Moments &
+Moments::operator=(const Moments &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        count_ = rhs.count_;
+        mean_ = rhs.mean_;
+        m2_ = rhs.m2_;
+        m3_ = rhs.m3_;
+        m4_ = rhs.m4_;
+        min_ = rhs.min_;
+        max_ = rhs.max_;
+    }
+    return(*this);
+}
+
+// accumulate
+void
+Moments::clear()
+{
+    count_ = 0;
+    mean_ = 0.0;
+    m2_ = 0.0;
+    m3_ = 0.0;
+    m4_ = 0.0;
+    min_ = HUGE_VAL;
+    max_ = -HUGE_VAL;
+}
+
+void
+Moments::add(double x)
+{
+    double n1 = double(count_);
+    double n = n1 + 1.0;
+    double delta = x - mean_;
+    double dn = delta/n;
+    double dn2 = dn*dn;
+    double term = delta*dn*n1;
+
+    mean_ += dn;
+    m4_ += term*dn2*(n*n - 3.0*n + 3.0) + 6.0*dn2*m2_ - 4.0*dn*m3_;
+    m3_ += term*dn*(n - 2.0) - 3.0*dn*m2_;
+    m2_ += term;
+    ++count_;
+
+    if (x < min_) min_ = x;
+    if (x > max_) max_ = x;
+}
+
+void
+Moments::add(const double *x, size_t n)
+{
+    for (size_t i=0; i<n; i+=BlockSize)
+    {
+        addBlock(x+i, (n-i < BlockSize) ? n-i : size_t(BlockSize));
+    }
+}
+
+void
+Moments::addBlock(const double *x, size_t n)
+{
+    if (n == 0) return;
+
+    size_t nv = n - n%Lanes;
+
+    // first pass, sum, minimum and maximum. the tail goes into
+    // the leading lanes, the lanes are summed in a fixed order.
+    double s[Lanes];
+    double lo[Lanes];
+    double hi[Lanes];
+    for (int l=0; l<Lanes; ++l)
+    {
+        s[l] = 0.0;
+        lo[l] = HUGE_VAL;
+        hi[l] = -HUGE_VAL;
+    }
+    for (size_t i=0; i<nv; i+=Lanes)
+    {
+        for (int l=0; l<Lanes; ++l)
+        {
+            double v = x[i+l];
+            s[l] += v;
+            lo[l] = (v < lo[l]) ? v : lo[l];
+            hi[l] = (v > hi[l]) ? v : hi[l];
+        }
+    }
+    for (size_t i=nv; i<n; ++i)
+    {
+        double v = x[i];
+        s[i-nv] += v;
+        lo[i-nv] = (v < lo[i-nv]) ? v : lo[i-nv];
+        hi[i-nv] = (v > hi[i-nv]) ? v : hi[i-nv];
+    }
+    double sum = 0.0;
+    double min = HUGE_VAL;
+    double max = -HUGE_VAL;
+    for (int l=0; l<Lanes; ++l)
+    {
+        sum += s[l];
+        min = (lo[l] < min) ? lo[l] : min;
+        max = (hi[l] > max) ? hi[l] : max;
+    }
+    double mean = sum/n;
+
+    // second pass, powers of the deviations from the block mean
+    double c1[Lanes];
+    double c2[Lanes];
+    double c3[Lanes];
+    double c4[Lanes];
+    for (int l=0; l<Lanes; ++l)
+    {
+        c1[l] = c2[l] = c3[l] = c4[l] = 0.0;
+    }
+    for (size_t i=0; i<nv; i+=Lanes)
+    {
+        for (int l=0; l<Lanes; ++l)
+        {
+            double d = x[i+l] - mean;
+            double d2 = d*d;
+            c1[l] += d;
+            c2[l] += d2;
+            c3[l] += d2*d;
+            c4[l] += d2*d2;
+        }
+    }
+    for (size_t i=nv; i<n; ++i)
+    {
+        double d = x[i] - mean;
+        double d2 = d*d;
+        c1[i-nv] += d;
+        c2[i-nv] += d2;
+        c3[i-nv] += d2*d;
+        c4[i-nv] += d2*d2;
+    }
+    double r1 = 0.0;
+    double r2 = 0.0;
+    double r3 = 0.0;
+    double r4 = 0.0;
+    for (int l=0; l<Lanes; ++l)
+    {
+        r1 += c1[l];
+        r2 += c2[l];
+        r3 += c3[l];
+        r4 += c4[l];
+    }
+
+    // the deviations should sum to zero. whatever rounding left
+    // over moves the mean, and the sums are shifted to match.
+    double e = r1/n;
+    double ne = r1;
+    double m2 = r2 - ne*e;
+    double m3 = r3 - 3.0*e*r2 + 2.0*ne*e*e;
+    double m4 = r4 - 4.0*e*r3 + 6.0*e*e*r2 - 3.0*ne*e*e*e;
+
+    combine(n, mean+e, m2, m3, m4, min, max);
+}
+
+void
+Moments::merge(const Moments &other)
+{
+    if (other.count_ == 0) return;
+    combine(other.count_, other.mean_, other.m2_, other.m3_,
+            other.m4_, other.min_, other.max_);
+}
+
+void
+Moments::combine(uint64_t n, double mean, double m2, double m3,
+                 double m4, double min, double max)
+{
+    if (count_ == 0)
+    {
+        count_ = n;
+        mean_ = mean;
+        m2_ = m2;
+        m3_ = m3;
+        m4_ = m4;
+    }
+    else
+    {
+        double na = double(count_);
+        double nb = double(n);
+        double nab = na + nb;
+        double delta = mean - mean_;
+        double dn = delta/nab;
+        double dn2 = dn*dn;
+        double term = delta*dn*na*nb;
+
+        m4_ += m4 + term*dn2*(na*na - na*nb + nb*nb)
+             + 6.0*dn2*(na*na*m2 + nb*nb*m2_)
+             + 4.0*dn*(na*m3 - nb*m3_);
+        m3_ += m3 + term*dn*(na - nb) + 3.0*dn*(na*m2 - nb*m2_);
+        m2_ += m2 + term;
+        mean_ += dn*nb;
+        count_ += n;
+    }
+    if (min < min_) min_ = min;
+    if (max > max_) max_ = max;
+}
+
+// results
+double
+Moments::mean() const
+{
+    return((count_ > 0) ? mean_ : NAN);
+}
+
+double
+Moments::variance() const
+{
+    return((count_ > 1) ? m2_/(count_-1) : NAN);
+}
+
+double
+Moments::populationVariance() const
+{
+    return((count_ > 0) ? m2_/count_ : NAN);
+}
+
+double
+Moments::standardDeviation() const
+{
+    return(sqrt(variance()));
+}
+
+double
+Moments::skewness() const
+{
+    if (count_ < 3) return(NAN);
+    return(sqrt(double(count_))*m3_/pow(m2_, 1.5));
+}
+
+double
+Moments::kurtosis() const
+{
+    if (count_ < 4) return(NAN);
+    return(double(count_)*m4_/(m2_*m2_) - 3.0);
+}
+
+}
@@ -0,0 +1,454 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// t-digest quantile sketch
+
+// system headers
+#include <string.h>
+#include <algorithm>
+
+// headers
+#include "hdr/TDigest.h"
+
+namespace ombt {
+
+// image layout: magic, compression, minimum, maximum, count,
+// number of centroids, then each centroid as its mean and weight.
+// doubles are 8 bytes, integers are base-128 varints, all of it
+// little-endian.
+static const unsigned char TDigestMagic[4] = { 'T', 'D', 'G', 1 };
+
+static unsigned char *
+putDouble(unsigned char *p, double v)
+{
+    uint64_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    for (int i=0; i<8; ++i, bits >>= 8)
+    {
+        *p++ = (unsigned char)(bits & 0xff);
+    }
+    return(p);
+}
+
+static const unsigned char *
+getDouble(const unsigned char *p, const unsigned char *end, double &v)
+{
+    if (end-p < 8) return(NULL);
+    uint64_t bits = 0;
+    for (int i=7; i>=0; --i)
+    {
+        bits = (bits << 8) | p[i];
+    }
+    memcpy(&v, &bits, sizeof(v));
+    return(p+8);
+}
+
+static size_t
+varintSize(uint64_t v)
+{
+    size_t n = 1;
+    while (v >= 0x80)
+    {
+        v >>= 7;
+        ++n;
+    }
+    return(n);
+}
+
+static unsigned char *
+putVarint(unsigned char *p, uint64_t v)
+{
+    while (v >= 0x80)
+    {
+        *p++ = (unsigned char)(v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (unsigned char)v;
+    return(p);
+}
+
+static const unsigned char *
+getVarint(const unsigned char *p, const unsigned char *end, uint64_t &v)
+{
+    v = 0;
+    for (int shift=0; shift<64 && p<end; shift+=7)
+    {
+        uint64_t b = *p++;
+        v |= (b & 0x7f) << shift;
+        if ((b & 0x80) == 0) return(p);
+    }
+    return(NULL);
+}
+
+// ctors and dtor
+TDigest::TDigest(double compression):
+    BaseObject(true), compression_(compression), buffersize_(0),
+    count_(0), min_(HUGE_VAL), max_(-HUGE_VAL),
+    centroids_(), buffer_(), scratch_()
+{
+    if (!(compression_ >= 1.0 && compression_ < 1.0e9))
+    {
+        setOk(false);
+        return;
+    }
+    buffersize_ = size_t(BufferFactor*compression_);
+    buffer_.reserve(buffersize_);
+}
+
+TDigest::TDigest(const TDigest &src):
+    BaseObject(src), compression_(src.compression_),
+    buffersize_(src.buffersize_), count_(src.count_),
+    min_(src.min_), max_(src.max_), centroids_(src.centroids_),
+    buffer_(src.buffer_), scratch_()
+{
+}
+
+TDigest::~TDigest()
+{
+}
+
+// assignment
+TDigest &
+TDigest::operator=(const TDigest &rhs)
+{
+    if (this != &rhs)
+    {
+        BaseObject::operator=(rhs);
+        compression_ = rhs.compression_;
+        buffersize_ = rhs.buffersize_;
+        count_ = rhs.count_;
+        min_ = rhs.min_;
+        max_ = rhs.max_;
+        centroids_ = rhs.centroids_;
+        buffer_ = rhs.buffer_;
+    }
+    return(*this);
+}
+
+// the quantile at which a centroid starting at q must end. the
+// arcsine scale bounds centroids by sqrt(q(1-q)), which suits the
+// middle. the logistic scale, with the normalizer z, bounds them
+// by q(1-q), which keeps the tails down to single values. a
+// centroid has to satisfy both.
+double
+TDigest::limit(double q, double z) const
+{
+    double a = asin(2.0*q - 1.0) + 2.0*M_PI/compression_;
+    double q1 = (a >= M_PI/2.0) ? 1.0 : (sin(a) + 1.0)/2.0;
+    if (q <= 0.0) return(0.0);
+    if (q >= 1.0) return(1.0);
+    double k = log(q/(1.0 - q)) + z/compression_;
+    double q2 = 1.0/(1.0 + exp(-k));
+    return((q1 < q2) ? q1 : q2);
+}
+
+// accumulate
+void
+TDigest::clear()
+{
+    count_ = 0;
+    min_ = HUGE_VAL;
+    max_ = -HUGE_VAL;
+    centroids_.clear();
+    buffer_.clear();
+}
+
+void
+TDigest::add(double x, uint64_t weight)
+{
+    MustBeTrue(isOk());
+    if (isnan(x) || weight == 0) return;
+
+    buffer_.push_back(Centroid(x, weight));
+    count_ += weight;
+    if (x < min_) min_ = x;
+    if (x > max_) max_ = x;
+    if (buffer_.size() >= buffersize_) compress();
+}
+
+void
+TDigest::add(const double *x, size_t n)
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        add(x[i]);
+    }
+}
+
+void
+TDigest::merge(const TDigest &other)
+{
+    MustBeTrue(isOk());
+    if (other.count_ == 0) return;
+    if (this == &other)
+    {
+        TDigest copy(other);
+        merge(copy);
+        return;
+    }
+
+    other.compress();
+    for (size_t i=0; i<other.centroids_.size(); ++i)
+    {
+        buffer_.push_back(other.centroids_[i]);
+        if (buffer_.size() >= buffersize_) compress();
+    }
+    count_ += other.count_;
+    if (other.min_ < min_) min_ = other.min_;
+    if (other.max_ > max_) max_ = other.max_;
+    compress();
+}
+
+// sort the buffer, merge it with the centroids, and combine
+// neighbours while a centroid stays within its limit.
+void
+TDigest::compress() const
+{
+    if (buffer_.empty()) return;
+
+    std::sort(buffer_.begin(), buffer_.end());
+    scratch_.resize(centroids_.size() + buffer_.size());
+    std::merge(centroids_.begin(), centroids_.end(),
+               buffer_.begin(), buffer_.end(), scratch_.begin());
+    buffer_.clear();
+    centroids_.clear();
+
+    // the normalizer keeps the number of tail centroids near
+    // the compression whatever the count
+    double total = double(count_);
+    double z = 4.0*log(std::max(total/compression_, 1.0)) + 24.0;
+    double sofar = 0.0;
+    double limit = 0.0;
+    centroids_.push_back(scratch_[0]);
+    for (size_t i=1; i<scratch_.size(); ++i)
+    {
+        Centroid &last = centroids_.back();
+        const Centroid &next = scratch_[i];
+        double proposed = sofar + double(last.weight + next.weight);
+        if (proposed <= limit)
+        {
+            uint64_t weight = last.weight + next.weight;
+            last.mean += (next.mean - last.mean)*
+                         (double(next.weight)/double(weight));
+            last.weight = weight;
+        }
+        else
+        {
+            sofar += double(last.weight);
+            limit = total*this->limit(sofar/total, z);
+            centroids_.push_back(next);
+        }
+    }
+}
+
+// results
+double
+TDigest::quantile(double q) const
+{
+    MustBeTrue(isOk());
+    compress();
+    if (count_ == 0 || isnan(q)) return(NAN);
+    if (q <= 0.0) return(min_);
+    if (q >= 1.0) return(max_);
+
+    const std::vector<Centroid> &c = centroids_;
+    size_t n = c.size();
+    double total = double(count_);
+    double index = q*total;
+    if (n == 1) return(min_ + q*(max_ - min_));
+
+    // between the minimum and the middle of the first centroid,
+    // or the middle of the last centroid and the maximum
+    double half = double(c[0].weight)/2.0;
+    if (index < half)
+        return(min_ + (index/half)*(c[0].mean - min_));
+    half = double(c[n-1].weight)/2.0;
+    if (index >= total - half)
+        return(max_ - ((total - index)/half)*(max_ - c[n-1].mean));
+
+    // between the middles of two centroids. a single value is
+    // not spread out, it owns half a unit of rank on each side.
+    double sofar = double(c[0].weight)/2.0;
+    for (size_t i=0; i+1<n; ++i)
+    {
+        double dw = double(c[i].weight + c[i+1].weight)/2.0;
+        if (index < sofar + dw)
+        {
+            double left = 0.0;
+            if (c[i].weight == 1)
+            {
+                if (index - sofar < 0.5) return(c[i].mean);
+                left = 0.5;
+            }
+            double right = 0.0;
+            if (c[i+1].weight == 1)
+            {
+                if (sofar + dw - index <= 0.5) return(c[i+1].mean);
+                right = 0.5;
+            }
+            double z1 = index - sofar - left;
+            double z2 = sofar + dw - index - right;
+            return((c[i].mean*z2 + c[i+1].mean*z1)/(z1 + z2));
+        }
+        sofar += dw;
+    }
+    return(c[n-1].mean);
+}
+
+void
+TDigest::quantile(const double *q, double *x, size_t n) const
+{
+    for (size_t i=0; i<n; ++i)
+    {
+        x[i] = quantile(q[i]);
+    }
+}
+
+double
+TDigest::cdf(double x) const
+{
+    MustBeTrue(isOk());
+    compress();
+    if (count_ == 0 || isnan(x)) return(NAN);
+    if (x < min_) return(0.0);
+    if (x >= max_) return(1.0);
+
+    const std::vector<Centroid> &c = centroids_;
+    size_t n = c.size();
+    double total = double(count_);
+    if (n == 1) return((x - min_)/(max_ - min_));
+
+    // the mirror image of quantile()
+    if (x < c[0].mean)
+    {
+        double half = double(c[0].weight)/2.0;
+        return(half*(x - min_)/(c[0].mean - min_)/total);
+    }
+    if (x > c[n-1].mean)
+    {
+        double half = double(c[n-1].weight)/2.0;
+        return(1.0 - half*(max_ - x)/(max_ - c[n-1].mean)/total);
+    }
+
+    double sofar = double(c[0].weight)/2.0;
+    for (size_t i=0; i+1<n; ++i)
+    {
+        double dw = double(c[i].weight + c[i+1].weight)/2.0;
+        if (x < c[i+1].mean)
+        {
+            double f = (x - c[i].mean)/(c[i+1].mean - c[i].mean);
+            return((sofar + f*dw)/total);
+        }
+        sofar += dw;
+    }
+    return(sofar/total);
+}
+
+size_t
+TDigest::centroids() const
+{
+    compress();
+    return(centroids_.size());
+}
+
+const TDigest::Centroid &
+TDigest::centroid(size_t i) const
+{
+    compress();
+    MustBeTrue(i < centroids_.size());
+    return(centroids_[i]);
+}
+
+// binary image
+size_t
+TDigest::serializedSize() const
+{
+    compress();
+    size_t size = sizeof(TDigestMagic) + 3*8 + varintSize(count_) +
+                  varintSize(centroids_.size());
+    for (size_t i=0; i<centroids_.size(); ++i)
+    {
+        size += 8 + varintSize(centroids_[i].weight);
+    }
+    return(size);
+}
+
+size_t
+TDigest::serialize(unsigned char *buf, size_t len) const
+{
+    MustBeTrue(isOk());
+    size_t size = serializedSize();
+    if (buf == NULL || len < size) return(0);
+
+    unsigned char *p = buf;
+    memcpy(p, TDigestMagic, sizeof(TDigestMagic));
+    p += sizeof(TDigestMagic);
+    p = putDouble(p, compression_);
+    p = putDouble(p, min_);
+    p = putDouble(p, max_);
+    p = putVarint(p, count_);
+    p = putVarint(p, centroids_.size());
+    for (size_t i=0; i<centroids_.size(); ++i)
+    {
+        p = putDouble(p, centroids_[i].mean);
+        p = putVarint(p, centroids_[i].weight);
+    }
+    MustBeTrue(size_t(p-buf) == size);
+    return(size);
+}
+
+bool
+TDigest::deserialize(const unsigned char *buf, size_t len)
+{
+    if (buf == NULL || len < sizeof(TDigestMagic)) return(false);
+    if (memcmp(buf, TDigestMagic, sizeof(TDigestMagic)) != 0)
+        return(false);
+
+    const unsigned char *p = buf + sizeof(TDigestMagic);
+    const unsigned char *end = buf + len;
+    double compression, min, max;
+    uint64_t count, ncentroids;
+    if ((p = getDouble(p, end, compression)) == NULL ||
+        (p = getDouble(p, end, min)) == NULL ||
+        (p = getDouble(p, end, max)) == NULL ||
+        (p = getVarint(p, end, count)) == NULL ||
+        (p = getVarint(p, end, ncentroids)) == NULL)
+        return(false);
+    if (!(compression >= 1.0 && compression < 1.0e9))
+        return(false);
+    if (ncentroids > uint64_t(end-p)/9) return(false);
+
+    std::vector<Centroid> centroids;
+    centroids.reserve(ncentroids);
+    uint64_t total = 0;
+    for (uint64_t i=0; i<ncentroids; ++i)
+    {
+        Centroid c;
+        if ((p = getDouble(p, end, c.mean)) == NULL ||
+            (p = getVarint(p, end, c.weight)) == NULL)
+            return(false);
+        if (isnan(c.mean) || c.weight == 0 || c.mean < min || c.mean > max)
+            return(false);
+        if (!centroids.empty() && c.mean < centroids.back().mean)
+            return(false);
+        total += c.weight;
+        centroids.push_back(c);
+    }
+    if (p != end || total != count) return(false);
+    if (count > 0 && !(min <= max)) return(false);
+
+    setOk(true);
+    compression_ = compression;
+    buffersize_ = size_t(BufferFactor*compression_);
+    count_ = count;
+    min_ = (count > 0) ? min : HUGE_VAL;
+    max_ = (count > 0) ? max : -HUGE_VAL;
+    centroids_.swap(centroids);
+    buffer_.clear();
+    buffer_.reserve(buffersize_);
+    return(true);
+}
+
+}
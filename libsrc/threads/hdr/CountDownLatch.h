@@ -0,0 +1,83 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+#ifndef __OMBT_COUNT_DOWN_LATCH_H
+#define __OMBT_COUNT_DOWN_LATCH_H
+// count-down latch - threads block until the count reaches zero
+
+// system headers
+#include <pthread.h>
+
+// local headers
+#include "system/Returns.h"
+#include "system/Debug.h"
+#include "atomic/UCBaseObject.h"
+
+namespace ombt {
+
+// count-down latch class
+class CountDownLatch: public UCBaseObject {
+public:
+    // ctor and dtor
+    CountDownLatch(unsigned long count = 0):
+        UCBaseObject(OK),
+        count_(count) {
+        pthread_cond_init(&cv_, NULL);
+        pthread_mutex_init(&cv_mutex_, NULL);
+    }
+    ~CountDownLatch() {
+        pthread_cond_destroy(&cv_);
+        pthread_mutex_destroy(&cv_mutex_);
+    }
+
+    // raise the count before handing out more work
+    void countUp(unsigned long n = 1) {
+        pthread_mutex_lock(&cv_mutex_);
+        count_ += n;
+        pthread_mutex_unlock(&cv_mutex_);
+    }
+
+    // one unit of work is done. the broadcast happens with the
+    // mutex held, so a waiter cannot destroy the latch before
+    // the last count-down has stopped touching it.
+    void countDown() {
+        pthread_mutex_lock(&cv_mutex_);
+        MustBeTrue(count_ > 0);
+        if (--count_ == 0)
+            pthread_cond_broadcast(&cv_);
+        pthread_mutex_unlock(&cv_mutex_);
+    }
+
+    // wait for the count to reach zero
+    void wait() {
+        pthread_mutex_lock(&cv_mutex_);
+        while (count_ > 0)
+        {
+            pthread_cond_wait(&cv_, &cv_mutex_);
+        }
+        pthread_mutex_unlock(&cv_mutex_);
+    }
+
+    unsigned long count() {
+        pthread_mutex_lock(&cv_mutex_);
+        unsigned long count = count_;
+        pthread_mutex_unlock(&cv_mutex_);
+        return(count);
+    }
+
+private:
+    // leper colony
+    CountDownLatch(const CountDownLatch &src);
+    CountDownLatch &operator=(const CountDownLatch &rhs);
+
+private:
+    pthread_mutex_t cv_mutex_;
+    pthread_cond_t cv_;
+    unsigned long count_;
+};
+
+}
+
+#endif
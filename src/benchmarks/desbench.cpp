@@ -0,0 +1,329 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// discrete-event simulation kernel benchmark
+//
+// usage: desbench [events [threads [replications]]]
+//
+// first the future event list alone, in the classic hold model:
+// with n events pending, take the first and schedule one at an
+// exponential time after it, for the calendar queue and for a
+// binary heap of events (std::priority_queue, as in TimerQueue),
+// both breaking ties by sequence number. then an
+// M/M/4 queue at 90% load, with the mean wait checked against the
+// erlang c formula, and a G/G/1 queue with erlang-2 arrivals and
+// gamma services against kingman's approximation. the queues run
+// the given number of events in all, split over independent
+// replications on the threads of a pool. each replication also
+// gives a batch means interval from its own run.
+
+// system headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <queue>
+#include <vector>
+#include <functional>
+#include <iostream>
+
+// local headers
+#include "performance/NanoSecTime.h"
+#include "random/Xoshiro256.h"
+#include "threads/ThreadPool.h"
+#include "distributions/Exponential.h"
+#include "distributions/Gamma.h"
+#include "distributions/mErlang.h"
+#include "simulation/CalendarQueue.h"
+#include "simulation/Simulator.h"
+#include "simulation/EntityPool.h"
+#include "simulation/Resource.h"
+#include "simulation/BatchMeans.h"
+#include "simulation/Replications.h"
+
+using namespace ombt;
+
+// run parameters
+static uint64_t events = 10000000;
+static unsigned threads = 4;
+static unsigned replications = 16;
+
+// elapsed seconds
+static double
+seconds(const NanoSecTime &t)
+{
+    return(t._seconds + 1.0e-9*t._nanoseconds);
+}
+
+// hold model on the calendar queue
+static double
+holdCalendar(size_t pending, uint64_t holds)
+{
+    ExponentialT<Xoshiro256> increment(1.0, Xoshiro256(1));
+    CalendarQueue queue;
+    Event event;
+    event.type = 0;
+    event.entity = 0;
+    for (size_t i=0; i<pending; ++i)
+    {
+        event.time = increment.nextValue();
+        queue.enqueue(event);
+    }
+
+    NanoSecTime t;
+    t.start();
+    for (uint64_t i=0; i<holds; ++i)
+    {
+        queue.dequeue(event);
+        event.time += increment.nextValue();
+        queue.enqueue(event);
+    }
+    t.stop();
+    return(1.0e9*seconds(t)/holds);
+}
+
+// hold model on a binary heap of the same events, ordered the same
+struct Later {
+    bool operator()(const Event &a, const Event &b) const {
+        return(a.time > b.time ||
+               (a.time == b.time && a.sequence > b.sequence));
+    }
+};
+
+static double
+holdHeap(size_t pending, uint64_t holds)
+{
+    ExponentialT<Xoshiro256> increment(1.0, Xoshiro256(1));
+    std::priority_queue<Event, std::vector<Event>, Later> queue;
+    Event event;
+    event.sequence = 0;
+    event.type = 0;
+    event.entity = 0;
+    for (size_t i=0; i<pending; ++i)
+    {
+        event.time = increment.nextValue();
+        queue.push(event);
+        ++event.sequence;
+    }
+
+    NanoSecTime t;
+    t.start();
+    for (uint64_t i=0; i<holds; ++i)
+    {
+        Event next = queue.top();
+        queue.pop();
+        next.time += increment.nextValue();
+        next.sequence = event.sequence++;
+        queue.push(next);
+    }
+    t.stop();
+    return(1.0e9*seconds(t)/holds);
+}
+
+// G/G/c queue, fifo. the waits in line of the customers starting
+// service after the warm-up go to batch means.
+template <class Arrivals, class Services>
+class ServiceQueue {
+public:
+    enum { Arrival, Departure };
+
+    struct Customer {
+        double arrived;
+    };
+
+    ServiceQueue(unsigned servers, const Arrivals &arrivals,
+          const Services &services, double warmup):
+        arrivals_(arrivals), services_(services), servers_(servers),
+        customers_(), waits_(), warmup_(warmup), warm_(false) {
+    }
+
+    void handle(Simulator &simulator, const Event &event) {
+        double now = simulator.now();
+        if (!warm_ && now >= warmup_)
+        {
+            servers_.resetStatistics(now);
+            warm_ = true;
+        }
+
+        uint64_t next;
+        switch (event.type)
+        {
+        case Arrival:
+            next = customers_.acquire();
+            customers_[next].arrived = now;
+            simulator.schedule(arrivals_.nextValue(), Arrival);
+            if (servers_.seize(now, next)) begin(simulator, next);
+            break;
+        case Departure:
+            customers_.release(event.entity);
+            if (servers_.release(now, next)) begin(simulator, next);
+            break;
+        }
+    }
+
+    const BatchMeans &waits() const { return(waits_); }
+    const Resource &servers() const { return(servers_); }
+
+protected:
+    void begin(Simulator &simulator, uint64_t customer) {
+        if (warm_) waits_.add(simulator.now() - customers_[customer].arrived);
+        simulator.schedule(services_.nextValue(), Departure, customer);
+    }
+
+    Arrivals arrivals_;
+    Services services_;
+    Resource servers_;
+    EntityPool<Customer> customers_;
+    BatchMeans waits_;
+    double warmup_;
+    bool warm_;
+};
+
+// one replication: the mean wait after a warm-up of the first 5% of
+// the run. arrivals and services use two halves of the stream.
+template <class Arrivals, class Services, class Maker>
+struct Experiment {
+    Experiment(unsigned servers, uint64_t events, double rate,
+               const Maker &maker):
+        servers_(servers), events_(events), rate_(rate), maker_(maker) {
+    }
+
+    double operator()(const Xoshiro256 &stream) const {
+        Xoshiro256 other(stream);
+        other.jump(uint64_t(1) << 63);
+        ServiceQueue<Arrivals, Services> queue(servers_, maker_.arrivals(stream),
+                                        maker_.services(other),
+                                        0.05*events_/rate_);
+        Simulator simulator;
+        simulator.schedule(0.0, ServiceQueue<Arrivals, Services>::Arrival);
+        simulator.run(queue, HUGE_VAL, events_);
+        return(queue.waits().mean());
+    }
+
+    unsigned servers_;
+    uint64_t events_;
+    double rate_;
+    Maker maker_;
+};
+
+// samplers of the two queues
+struct MMc {
+    ExponentialT<Xoshiro256> arrivals(const Xoshiro256 &s) const {
+        return(ExponentialT<Xoshiro256>(1.0/3.6, s));
+    }
+    ExponentialT<Xoshiro256> services(const Xoshiro256 &s) const {
+        return(ExponentialT<Xoshiro256>(1.0, s));
+    }
+};
+
+struct GG1 {
+    mErlangT<Xoshiro256> arrivals(const Xoshiro256 &s) const {
+        return(mErlangT<Xoshiro256>(1.0, 2, s));
+    }
+    GammaT<Xoshiro256> services(const Xoshiro256 &s) const {
+        return(GammaT<Xoshiro256>(2.0, 0.45, s));
+    }
+};
+
+// erlang c mean wait in line for M/M/c
+static double
+erlangC(double lambda, double mu, unsigned c)
+{
+    double a = lambda/mu;
+    double rho = a/c;
+    double term = 1.0;
+    double sum = 1.0;
+    for (unsigned k=1; k<c; ++k)
+    {
+        term *= a/k;
+        sum += term;
+    }
+    term *= a/c;
+    double wait = term/(1.0-rho);
+    double probability = wait/(sum + wait);
+    return(probability/(c*mu - lambda));
+}
+
+// run a queue on the pool and report
+template <class Arrivals, class Services, class Maker>
+static void
+report(ThreadPool &pool, const char *name, unsigned servers, double rate,
+       double expected, const char *reference)
+{
+    // two events per customer
+    uint64_t each = events/replications;
+    Experiment<Arrivals, Services, Maker> experiment(servers, each,
+                                                     2.0*rate, Maker());
+    ReplicationsT<Xoshiro256> runs(Xoshiro256(12345));
+
+    NanoSecTime t;
+    t.start();
+    runs.run(pool, experiment, replications);
+    t.stop();
+
+    double s = seconds(t);
+    printf("%s: wait %.4f +- %.4f (95%%), %s %.4f, "
+           "%.1f ns/event, %.3g events/s\n", name, runs.mean(),
+           runs.halfWidth(0.95), reference, expected,
+           1.0e9*s/(each*replications), each*replications/s);
+
+    // batch means from a single replication
+    Xoshiro256 stream(Xoshiro256(12345).substream(0));
+    Xoshiro256 other(stream);
+    other.jump(uint64_t(1) << 63);
+    Maker maker;
+    ServiceQueue<Arrivals, Services> queue(servers, maker.arrivals(stream),
+                                    maker.services(other),
+                                    0.05*each/(2.0*rate));
+    Simulator simulator;
+    simulator.schedule(0.0, ServiceQueue<Arrivals, Services>::Arrival);
+    simulator.run(queue, HUGE_VAL, each);
+    const BatchMeans &waits = queue.waits();
+    printf("%s: one run, batch means %.4f +- %.4f (95%%), %zu batches "
+           "of %llu, lag-1 %.3f, utilization %.4f\n", name, waits.mean(),
+           waits.halfWidth(0.95), waits.batches(),
+           (unsigned long long)waits.batchSize(), waits.lag1(),
+           queue.servers().utilization(simulator.now()));
+    fflush(stdout);
+}
+
+int
+main(int argc, char **argv)
+{
+    if (argc > 1) events = strtoull(argv[1], NULL, 0);
+    if (argc > 2) threads = atoi(argv[2]);
+    if (argc > 3) replications = atoi(argv[3]);
+    if (events < 1000 || threads < 1 || replications < 2)
+    {
+        fprintf(stderr, "usage: %s [events [threads [replications]]]\n",
+                argv[0]);
+        return(2);
+    }
+
+    printf("# %llu events, %u threads, %u replications\n",
+           (unsigned long long)events, threads, replications);
+
+    // future event list alone
+    static const size_t pendings[] = { 10, 1000, 100000, 1000000 };
+    for (size_t i=0; i<sizeof(pendings)/sizeof(pendings[0]); ++i)
+    {
+        uint64_t holds = events;
+        printf("hold, %zu pending: calendar %.1f ns, heap %.1f ns\n",
+               pendings[i], holdCalendar(pendings[i], holds),
+               holdHeap(pendings[i], holds));
+        fflush(stdout);
+    }
+
+    // queues
+    ThreadPool pool(threads);
+    report<ExponentialT<Xoshiro256>, ExponentialT<Xoshiro256>, MMc>(
+        pool, "M/M/4", 4, 3.6, erlangC(3.6, 1.0, 4), "erlang c");
+
+    // kingman: rho/(1-rho) (ca2+cs2)/2 E[S], ca2 = 1/2, cs2 = 1/2
+    report<mErlangT<Xoshiro256>, GammaT<Xoshiro256>, GG1>(
+        pool, "G/G/1", 1, 1.0, 0.9/0.1*0.5*0.9, "kingman");
+
+    return(0);
+}
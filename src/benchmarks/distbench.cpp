@@ -0,0 +1,236 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// distribution sampler throughput, every distribution on every engine
+//
+// usage: distbench [variates [trials]]
+//
+// each sampler is timed drawing one value at a time with nextValue()
+// and a block at a time with fill(). one untimed run warms caches and
+// tables up, then the given number of trials are timed, and the
+// median and fastest trial are reported.
+//
+// the output is comma-separated, one line per sampler, engine and
+// method, with a header line. lines starting with # are comments.
+// speedup is against nextValue() of the same distribution with the
+// default instantiation (Random, original engine), so above one is
+// faster than what the library has always done.
+
+// system headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+#include <map>
+#include <string>
+#include <algorithm>
+#include <iostream>
+
+// local headers
+#include "performance/NanoSecTime.h"
+#include "random/Random.h"
+#include "random/Xoshiro256.h"
+#include "random/PCG64.h"
+#include "random/Philox.h"
+#include "distributions/AliasDiscrete.h"
+#include "distributions/Bernoulli.h"
+#include "distributions/Beta.h"
+#include "distributions/Binomial.h"
+#include "distributions/DiscreteUniform.h"
+#include "distributions/Empirical.h"
+#include "distributions/Exponential.h"
+#include "distributions/Gamma.h"
+#include "distributions/Gaussian.h"
+#include "distributions/Geometric.h"
+#include "distributions/InverseCDFTable.h"
+#include "distributions/LogNormal.h"
+#include "distributions/NaiveArbitraryDiscrete.h"
+#include "distributions/NegativeBinomial.h"
+#include "distributions/PearsonTypeV.h"
+#include "distributions/PearsonTypeVI.h"
+#include "distributions/Poisson.h"
+#include "distributions/QPlaceArbitraryDiscrete.h"
+#include "distributions/Uniform.h"
+#include "distributions/Weibull.h"
+#include "distributions/mErlang.h"
+
+using namespace ombt;
+
+// run parameters
+static size_t variates = 1<<16;
+static int trials = 11;
+
+// nextValue() of the default instantiation, by distribution
+static std::map<std::string, double> baseline;
+
+// keeps the sampled values alive
+static volatile double sink = 0.0;
+
+// elapsed nano-seconds
+static double
+nanoSeconds(const NanoSecTime &t)
+{
+    return(1.0e9*t._seconds + t._nanoseconds);
+}
+
+// one line of output
+static void
+report(const char *distribution, const char *engine, const char *method,
+       std::vector<double> &ns)
+{
+    std::sort(ns.begin(), ns.end());
+    double median = ns[ns.size()/2];
+    double fastest = ns[0];
+
+    std::string key(distribution);
+    if (baseline.find(key) == baseline.end())
+        baseline[key] = median;
+
+    printf("%s,%s,%s,%d,%.3f,%.3f,%.4g,%.3f\n",
+           distribution, engine, method, trials, median, fastest,
+           1.0e9/median, baseline[key]/median);
+}
+
+// time nextValue() and fill() of one sampler
+template <class Sampler>
+static void
+bench(const char *distribution, const char *engine, Sampler sampler)
+{
+    std::vector<double> buffer(variates);
+    std::vector<double> ns(trials);
+    NanoSecTime t;
+
+    for (int r=-1; r<trials; ++r)
+    {
+        double sum = 0.0;
+        t.start();
+        for (size_t i=0; i<variates; ++i) sum += sampler.nextValue();
+        t.stop();
+        sink = sink + sum;
+        if (r >= 0) ns[r] = nanoSeconds(t)/variates;
+    }
+    report(distribution, engine, "next", ns);
+
+    for (int r=-1; r<trials; ++r)
+    {
+        t.start();
+        sampler.fill(&buffer[0], variates);
+        t.stop();
+        sink = sink + buffer[variates-1];
+        if (r >= 0) ns[r] = nanoSeconds(t)/variates;
+    }
+    report(distribution, engine, "fill", ns);
+}
+
+// the engine by itself, uniform (0,1) values
+template <class RNG>
+static void
+benchEngine(const char *engine, RNG rng)
+{
+    std::vector<double> buffer(variates);
+    std::vector<double> ns(trials);
+    NanoSecTime t;
+
+    for (int r=-1; r<trials; ++r)
+    {
+        double sum = 0.0;
+        t.start();
+        for (size_t i=0; i<variates; ++i) sum += rng.random0to1();
+        t.stop();
+        sink = sink + sum;
+        if (r >= 0) ns[r] = nanoSeconds(t)/variates;
+    }
+    report("engine", engine, "next", ns);
+
+    for (int r=-1; r<trials; ++r)
+    {
+        t.start();
+        rng.fill(&buffer[0], variates);
+        t.stop();
+        sink = sink + buffer[variates-1];
+        if (r >= 0) ns[r] = nanoSeconds(t)/variates;
+    }
+    report("engine", engine, "fill", ns);
+}
+
+// every distribution on one engine. the parameters cover the
+// regimes where the samplers switch methods.
+template <class RNG>
+static void
+benchAll(const char *engine, const RNG &rng)
+{
+    std::vector<double> mass;
+    for (int i=1; i<=10; ++i) mass.push_back(i);
+    std::vector<double> observed(100000);
+    GaussianT<Xoshiro256> normal(0.0, 1.0, Xoshiro256(1));
+    normal.fill(&observed[0], observed.size());
+
+    benchEngine(engine, rng);
+    bench("Uniform(0;1)", engine, UniformT<RNG>(0.0, 1.0, rng));
+    bench("DiscreteUniform(1;6)", engine,
+          DiscreteUniformT<RNG>(1.0, 6.0, rng));
+    bench("Bernoulli(0.3)", engine, BernoulliT<RNG>(0.3, rng));
+    bench("Geometric(0.3)", engine, GeometricT<RNG>(0.3, rng));
+    bench("Binomial(0.3;20)", engine, BinomialT<RNG>(0.3, 20, rng));
+    bench("Binomial(0.3;1000)", engine, BinomialT<RNG>(0.3, 1000, rng));
+    bench("NegativeBinomial(0.3;5)", engine,
+          NegativeBinomialT<RNG>(0.3, 5, rng));
+    bench("Poisson(3)", engine, PoissonT<RNG>(3.0, rng));
+    bench("Poisson(100)", engine, PoissonT<RNG>(100.0, rng));
+    bench("Exponential(1)", engine, ExponentialT<RNG>(1.0, rng));
+    bench("Gaussian(0;1)", engine, GaussianT<RNG>(0.0, 1.0, rng));
+    bench("LogNormal(1;1)", engine, LogNormalT<RNG>(1.0, 1.0, rng));
+    bench("Gamma(0.5;1)", engine, GammaT<RNG>(0.5, 1.0, rng));
+    bench("Gamma(2.5;1)", engine, GammaT<RNG>(2.5, 1.0, rng));
+    bench("mErlang(1;3)", engine, mErlangT<RNG>(1.0, 3, rng));
+    bench("Weibull(2;1)", engine, WeibullT<RNG>(2.0, 1.0, rng));
+    bench("Beta(2;3)", engine, BetaT<RNG>(2.0, 3.0, rng));
+    bench("PearsonTypeV(3;1)", engine, PearsonTypeVT<RNG>(3.0, 1.0, rng));
+    bench("PearsonTypeVI(2;3;1)", engine,
+          PearsonTypeVIT<RNG>(2.0, 3.0, 1.0, rng));
+    bench("InverseCDFTable(Gamma(0.5;1))", engine,
+          InverseCDFTableT<RNG>(GammaT<RNG>(0.5, 1.0, rng), rng));
+    bench("InverseCDFTable(Beta(2;3))", engine,
+          InverseCDFTableT<RNG>(BetaT<RNG>(2.0, 3.0, rng), rng));
+    bench("Empirical(100000)", engine, EmpiricalT<RNG>(observed, rng));
+    bench("Empirical(100000;0.1)", engine,
+          EmpiricalT<RNG>(observed, rng, 0.1));
+    bench("AliasDiscrete(10)", engine, AliasDiscreteT<RNG>(mass, rng));
+    bench("NaiveArbitraryDiscrete(10)", engine,
+          NaiveArbitraryDiscreteT<RNG>(mass, rng));
+    bench("QPlaceArbitraryDiscrete(3;10)", engine,
+          QPlaceArbitraryDiscreteT<RNG>(3, mass, rng));
+}
+
+int
+main(int argc, char **argv)
+{
+    if (argc > 1) variates = strtoul(argv[1], NULL, 0);
+    if (argc > 2) trials = atoi(argv[2]);
+    if (variates < 1 || trials < 1)
+    {
+        fprintf(stderr, "usage: %s [variates [trials]]\n", argv[0]);
+        return(2);
+    }
+
+    printf("# %zu variates per trial, 1 warmup and %d timed trials\n",
+           variates, trials);
+    printf("distribution,engine,method,trials,ns_median,ns_fastest,"
+           "variates_per_sec,speedup\n");
+
+    unsigned long key = 12345;
+
+    // the default instantiation first, it is the baseline
+    benchAll("Random:lcg", Random(Random::LCGEngine, key));
+    benchAll("Random:xoshiro", Random(Random::XoshiroEngine, key));
+    benchAll("Random:pcg", Random(Random::PCGEngine, key));
+    benchAll("Random:philox", Random(Random::PhiloxEngine, key));
+    benchAll("Xoshiro256", Xoshiro256(key));
+    benchAll("PCG64", PCG64(key));
+    benchAll("Philox", Philox(key));
+
+    return(0);
+}
@@ -0,0 +1,203 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// goodness-of-fit of every distribution sampler against its own
+// distribution function
+//
+// usage: distfit [variates [threads [alpha]]]
+//
+// each sampler draws the given number of variates on the threads
+// of a pool, and the chi-square, kolmogorov-smirnov and
+// anderson-darling tests are run on them, see GoodnessOfFit.h.
+// the output is comma-separated, one line per sampler, with a
+// header line. lines starting with # are comments.
+//
+// the exit status is 1 if any sampler fails a test at level alpha,
+// so a change to a sampler can be checked with
+//
+//     distfit 100000000 && echo ok
+//
+// with alpha = 0.001 about one run in 300 fails one of the three
+// tests by chance alone; a failure that repeats with another key
+// is real.
+
+// system headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+#include <iostream>
+
+// local headers
+#include "performance/NanoSecTime.h"
+#include "random/Xoshiro256.h"
+#include "threads/ThreadPool.h"
+#include "montecarlo/MonteCarlo.h"
+#include "montecarlo/GoodnessOfFit.h"
+#include "distributions/AliasDiscrete.h"
+#include "distributions/Bernoulli.h"
+#include "distributions/Beta.h"
+#include "distributions/Binomial.h"
+#include "distributions/DiscreteUniform.h"
+#include "distributions/Exponential.h"
+#include "distributions/Gamma.h"
+#include "distributions/Gaussian.h"
+#include "distributions/Geometric.h"
+#include "distributions/InverseCDFTable.h"
+#include "distributions/LogNormal.h"
+#include "distributions/NaiveArbitraryDiscrete.h"
+#include "distributions/NegativeBinomial.h"
+#include "distributions/PearsonTypeV.h"
+#include "distributions/PearsonTypeVI.h"
+#include "distributions/Poisson.h"
+#include "distributions/QPlaceArbitraryDiscrete.h"
+#include "distributions/Uniform.h"
+#include "distributions/Weibull.h"
+#include "distributions/mErlang.h"
+
+using namespace ombt;
+
+// run parameters
+static uint64_t variates = 10000000;
+static unsigned threads = 4;
+static double alpha = 1.0e-3;
+
+// samplers that failed
+static int failures = 0;
+
+// elapsed seconds
+static double
+seconds(const NanoSecTime &t)
+{
+    return(t._seconds + 1.0e-9*t._nanoseconds);
+}
+
+// a sampler of one distribution, with fixed parameters, on a stream
+template <class Dist, class Maker>
+struct Factory {
+    Factory(const Maker &maker): maker_(maker) { }
+    Dist operator()(const Xoshiro256 &s) const { return(maker_(s)); }
+    Maker maker_;
+};
+
+// test one distribution
+template <class Dist, class Maker>
+static void
+check(ThreadPool &pool, const MonteCarloT<Xoshiro256> &driver,
+      const char *distribution, GoodnessOfFit::Kind kind, Maker maker)
+{
+    Factory<Dist, Maker> factory(maker);
+    Dist reference = maker(Xoshiro256(0));
+
+    NanoSecTime t;
+    GoodnessOfFit fit(kind);
+    t.start();
+    fit.sample(pool, driver, factory, reference, variates);
+    t.stop();
+
+    bool passed = fit.passed(alpha);
+    if (!passed) ++failures;
+
+    printf("%s,%s,%llu,%llu,%.4f,%lu,%.4g,%.6g,%.4g,%.4f,%.4g,%.2f,%s\n",
+           distribution, (kind == GoodnessOfFit::Discrete) ? "discrete" :
+           "continuous", (unsigned long long)fit.count(),
+           (unsigned long long)fit.invalid(), fit.chiSquare(),
+           fit.chiSquareCells(), fit.chiSquareP(), fit.kolmogorovSmirnov(),
+           fit.kolmogorovSmirnovP(), fit.andersonDarling(),
+           fit.andersonDarlingP(), seconds(t), passed ? "pass" : "FAIL");
+    fflush(stdout);
+}
+
+int
+main(int argc, char **argv)
+{
+    if (argc > 1) variates = strtoull(argv[1], NULL, 0);
+    if (argc > 2) threads = atoi(argv[2]);
+    if (argc > 3) alpha = atof(argv[3]);
+    if (variates < 100 || threads < 1 || !(alpha > 0.0 && alpha < 1.0))
+    {
+        fprintf(stderr, "usage: %s [variates [threads [alpha]]]\n",
+                argv[0]);
+        return(2);
+    }
+
+    printf("# %llu variates, %u threads, alpha %g\n",
+           (unsigned long long)variates, threads, alpha);
+    printf("distribution,kind,variates,invalid,chi2,cells,chi2_p,"
+           "ks,ks_p,ad,ad_p,seconds,result\n");
+
+    typedef Xoshiro256 R;
+    typedef GoodnessOfFit G;
+    static const std::vector<double> mass = {
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 10
+    };
+
+    ThreadPool pool(threads);
+    MonteCarloT<R> driver(R(12345), 1<<22);
+
+    check<UniformT<R> >(pool, driver, "Uniform(0;1)", G::Continuous,
+        [](const R &s) { return(UniformT<R>(0.0, 1.0, s)); });
+    check<DiscreteUniformT<R> >(pool, driver, "DiscreteUniform(1;6)",
+        G::Discrete,
+        [](const R &s) { return(DiscreteUniformT<R>(1.0, 6.0, s)); });
+    check<BernoulliT<R> >(pool, driver, "Bernoulli(0.3)", G::Discrete,
+        [](const R &s) { return(BernoulliT<R>(0.3, s)); });
+    check<GeometricT<R> >(pool, driver, "Geometric(0.3)", G::Discrete,
+        [](const R &s) { return(GeometricT<R>(0.3, s)); });
+    check<BinomialT<R> >(pool, driver, "Binomial(0.3;20)", G::Discrete,
+        [](const R &s) { return(BinomialT<R>(0.3, 20, s)); });
+    check<BinomialT<R> >(pool, driver, "Binomial(0.3;1000)", G::Discrete,
+        [](const R &s) { return(BinomialT<R>(0.3, 1000, s)); });
+    check<NegativeBinomialT<R> >(pool, driver, "NegativeBinomial(0.3;5)",
+        G::Discrete,
+        [](const R &s) { return(NegativeBinomialT<R>(0.3, 5, s)); });
+    check<PoissonT<R> >(pool, driver, "Poisson(3)", G::Discrete,
+        [](const R &s) { return(PoissonT<R>(3.0, s)); });
+    check<PoissonT<R> >(pool, driver, "Poisson(100)", G::Discrete,
+        [](const R &s) { return(PoissonT<R>(100.0, s)); });
+    check<ExponentialT<R> >(pool, driver, "Exponential(1)", G::Continuous,
+        [](const R &s) { return(ExponentialT<R>(1.0, s)); });
+    check<GaussianT<R> >(pool, driver, "Gaussian(0;1)", G::Continuous,
+        [](const R &s) { return(GaussianT<R>(0.0, 1.0, s)); });
+    check<LogNormalT<R> >(pool, driver, "LogNormal(1;1)", G::Continuous,
+        [](const R &s) { return(LogNormalT<R>(1.0, 1.0, s)); });
+    check<GammaT<R> >(pool, driver, "Gamma(0.5;1)", G::Continuous,
+        [](const R &s) { return(GammaT<R>(0.5, 1.0, s)); });
+    check<GammaT<R> >(pool, driver, "Gamma(2.5;1)", G::Continuous,
+        [](const R &s) { return(GammaT<R>(2.5, 1.0, s)); });
+    check<mErlangT<R> >(pool, driver, "mErlang(1;3)", G::Continuous,
+        [](const R &s) { return(mErlangT<R>(1.0, 3, s)); });
+    check<WeibullT<R> >(pool, driver, "Weibull(2;1)", G::Continuous,
+        [](const R &s) { return(WeibullT<R>(2.0, 1.0, s)); });
+    check<BetaT<R> >(pool, driver, "Beta(2;3)", G::Continuous,
+        [](const R &s) { return(BetaT<R>(2.0, 3.0, s)); });
+    check<PearsonTypeVT<R> >(pool, driver, "PearsonTypeV(3;1)",
+        G::Continuous,
+        [](const R &s) { return(PearsonTypeVT<R>(3.0, 1.0, s)); });
+    check<PearsonTypeVIT<R> >(pool, driver, "PearsonTypeVI(2;3;1)",
+        G::Continuous,
+        [](const R &s) { return(PearsonTypeVIT<R>(2.0, 3.0, 1.0, s)); });
+    check<InverseCDFTableT<R> >(pool, driver,
+        "InverseCDFTable(Gamma(0.5;1))", G::Continuous,
+        [](const R &s) {
+            return(InverseCDFTableT<R>(GammaT<R>(0.5, 1.0, s), s)); });
+    check<InverseCDFTableT<R> >(pool, driver,
+        "InverseCDFTable(Beta(2;3))", G::Continuous,
+        [](const R &s) {
+            return(InverseCDFTableT<R>(BetaT<R>(2.0, 3.0, s), s)); });
+    check<AliasDiscreteT<R> >(pool, driver, "AliasDiscrete(10)",
+        G::Discrete,
+        [](const R &s) { return(AliasDiscreteT<R>(mass, s)); });
+    check<NaiveArbitraryDiscreteT<R> >(pool, driver,
+        "NaiveArbitraryDiscrete(10)", G::Discrete,
+        [](const R &s) { return(NaiveArbitraryDiscreteT<R>(mass, s)); });
+    check<QPlaceArbitraryDiscreteT<R> >(pool, driver,
+        "QPlaceArbitraryDiscrete(3;10)", G::Discrete,
+        [](const R &s) { return(QPlaceArbitraryDiscreteT<R>(3, mass, s)); });
+
+    printf("# %d failed\n", failures);
+    return((failures > 0) ? 1 : 0);
+}
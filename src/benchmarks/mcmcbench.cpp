@@ -0,0 +1,179 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// markov chain monte carlo benchmark
+//
+// usage: mcmcbench [iterations [threads [chains]]]
+//
+// each sampler runs the given number of iterations in all, split
+// over the chains on the threads of a pool, on two targets: a
+// gaussian in 5 dimensions with standard deviations 1 to 5, and a
+// banana in 2, x ~ N(0,1) and y ~ N((x^2-1)/2, 1/4), where y has
+// variance 3/4. the chains start far out, at +-5 to +-20. a tenth of
+// each chain is burn-in. reports time per iteration, iterations a
+// minute, the acceptance rate and evaluations of the target, and the
+// mean, variance, rhat and effective sample size of each coordinate.
+// for comparison, first a single metropolis chain the way it is
+// written by hand, one Gaussian::nextValue() per coordinate.
+
+// system headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+#include <iostream>
+
+// local headers
+#include "performance/NanoSecTime.h"
+#include "random/Xoshiro256.h"
+#include "threads/ThreadPool.h"
+#include "distributions/Gaussian.h"
+#include "montecarlo/MCMC.h"
+
+using namespace ombt;
+
+// run parameters
+static uint64_t iterations = 100000000;
+static unsigned threads = 4;
+static unsigned chains = 4;
+
+// elapsed seconds
+static double
+seconds(const NanoSecTime &t)
+{
+    return(t._seconds + 1.0e-9*t._nanoseconds);
+}
+
+// gaussian, standard deviation i+1 in coordinate i
+struct Normal {
+    size_t dimension() const { return(5); }
+    double logDensity(const double *x) const {
+        double sum = 0.0;
+        for (size_t i=0; i<5; ++i)
+        {
+            double z = x[i]/(i+1);
+            sum += z*z;
+        }
+        return(-0.5*sum);
+    }
+};
+
+// banana
+struct Banana {
+    size_t dimension() const { return(2); }
+    double logDensity(const double *x) const {
+        double y = x[1] - 0.5*(x[0]*x[0] - 1.0);
+        return(-0.5*(x[0]*x[0] + 4.0*y*y));
+    }
+};
+
+// metropolis by hand, in one thread
+static void
+byHand(uint64_t n)
+{
+    Normal target;
+    GaussianT<Xoshiro256> normal(0.0, 1.0, Xoshiro256(1));
+    Xoshiro256 uniform(Xoshiro256(1).substream(1));
+    std::vector<double> x(5, 0.0);
+    double logp = target.logDensity(&x[0]);
+    uint64_t accepted = 0;
+
+    NanoSecTime t;
+    t.start();
+    for (uint64_t k=0; k<n; ++k)
+    {
+        std::vector<double> y(x);
+        for (size_t i=0; i<5; ++i) y[i] += 0.5*(i+1)*normal.nextValue();
+        double logq = target.logDensity(&y[0]);
+        if (uniform.random0to1() < exp(logq - logp))
+        {
+            x = y;
+            logp = logq;
+            ++accepted;
+        }
+    }
+    t.stop();
+
+    double s = seconds(t);
+    printf("by hand, gaussian 5: %.1f ns/iteration, %.3g iterations/min, "
+           "acceptance %.3f\n", 1.0e9*s/n, 60.0*n/s, double(accepted)/n);
+    fflush(stdout);
+}
+
+// run a sampler on the pool and report
+template <class Sampler, class Target>
+static void
+report(ThreadPool &pool, const char *name, const Target &target)
+{
+    size_t dimension = target.dimension();
+    std::vector<double> starts(chains*dimension);
+    for (size_t k=0; k<starts.size(); ++k)
+    {
+        starts[k] = ((k%2) ? 5.0 : -5.0)*(1 + (k/dimension)%4);
+    }
+
+    uint64_t each = iterations/chains;
+    uint64_t burnin = each/10;
+    MCMCT<Xoshiro256> mcmc(Xoshiro256(12345), chains);
+
+    NanoSecTime t;
+    t.start();
+    mcmc.template run<Sampler>(pool, target, &starts[0], each-burnin,
+                               burnin);
+    t.stop();
+
+    double s = seconds(t);
+    uint64_t total = each*chains;
+    uint64_t evaluations = 0;
+    for (size_t k=0; k<chains; ++k) evaluations += mcmc.evaluations(k);
+    printf("%s: %.1f ns/iteration, %.3g iterations/min, acceptance %.3f, "
+           "%.2f evaluations/iteration\n", name, 1.0e9*s/total,
+           60.0*total/s, mcmc.acceptance(0),
+           double(evaluations)/(chains*(each-burnin)));
+
+    const ChainStatistics &statistics = mcmc.statistics();
+    for (size_t i=0; i<dimension; ++i)
+    {
+        printf("    x%zu: mean %8.4f +- %.4f, variance %8.4f, rhat %.4f, "
+               "ess %.0f\n", i, statistics.mean(i),
+               statistics.standardError(i), statistics.variance(i),
+               statistics.rhat(i), statistics.ess(i));
+    }
+    fflush(stdout);
+}
+
+int
+main(int argc, char **argv)
+{
+    if (argc > 1) iterations = strtoull(argv[1], NULL, 0);
+    if (argc > 2) threads = atoi(argv[2]);
+    if (argc > 3) chains = atoi(argv[3]);
+    if (iterations < 100000 || threads < 1 || chains < 2)
+    {
+        fprintf(stderr, "usage: %s [iterations [threads [chains]]]\n",
+                argv[0]);
+        return(2);
+    }
+
+    printf("# %llu iterations, %u threads, %u chains\n",
+           (unsigned long long)iterations, threads, chains);
+
+    byHand(iterations/10);
+
+    ThreadPool pool(threads);
+    Normal normal;
+    Banana banana;
+    report<MetropolisT<Xoshiro256, Normal> >(pool, "metropolis, gaussian 5",
+                                            normal);
+    report<SliceSamplerT<Xoshiro256, Normal> >(pool, "slice, gaussian 5",
+                                              normal);
+    report<MetropolisT<Xoshiro256, Banana> >(pool, "metropolis, banana",
+                                            banana);
+    report<SliceSamplerT<Xoshiro256, Banana> >(pool, "slice, banana",
+                                              banana);
+
+    return(0);
+}
@@ -0,0 +1,160 @@
+//
+// Copyright (C) 2010, OMBT LLC and Mike A. Rumore
+// All rights reserved.
+// Contact: Mike A. Rumore, (mike.a.rumore@gmail.com)
+//
+// special functions throughput, array kernels against libm
+//
+// usage: sfbench [elements [repetitions]]
+//
+// each function is timed over the same inputs three ways: a loop
+// calling libm (or the scalar form when libm has no equivalent),
+// a loop calling the scalar form, and the array form. the last
+// column is the largest difference from the reference in ulps,
+// or in epsilons where the reference is below one.
+
+// system headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <vector>
+#include <iostream>
+
+// local headers
+#include "performance/NanoSecTime.h"
+#include "specialfunctions/SpecialFunctions.h"
+
+using namespace ombt;
+
+// scalar and array signatures
+typedef double (*ScalarFn)(double);
+typedef void (*ArrayFn)(const double *, double *, size_t);
+
+// scalar wrappers
+static double ombtLogGamma(double x) { return(logGamma(x)); }
+static double ombtErf(double x) { return(errorFunction(x)); }
+static double ombtErfc(double x) { return(errorFunctionC(x)); }
+static double ombtNormalCdf(double x) { return(normalCdf(x)); }
+static double ombtNormalQuantile(double p) { return(normalQuantile(p)); }
+static double libmLogGamma(double x) { return(lgamma(x)); }
+static double libmNormalCdf(double x) { return(0.5*erfc(-x*M_SQRT1_2)); }
+
+// elapsed nano-seconds
+static double
+nanoSeconds(const NanoSecTime &t)
+{
+    return(1.0e9*t._seconds + t._nanoseconds);
+}
+
+// distance in units in the last place
+static double
+ulps(double a, double b)
+{
+    if (a == b || (isnan(a) && isnan(b))) return(0.0);
+    if (!isfinite(a) || !isfinite(b)) return(HUGE_VAL);
+    double u = nextafter(fabs(b), HUGE_VAL) - fabs(b);
+    return(fabs(a-b)/u);
+}
+
+// inputs spread over the interesting range of each function
+static void
+fillUniform(std::vector<double> &x, double lo, double hi)
+{
+    uint64_t s = 88172645463325252ULL;
+    for (size_t i=0; i<x.size(); ++i)
+    {
+        s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+        x[i] = lo + (hi-lo)*((s >> 11)*(1.0/9007199254740992.0));
+    }
+}
+
+static void
+run(const char *name, ScalarFn reference, ScalarFn scalar, ArrayFn array,
+    const std::vector<double> &x, int repetitions)
+{
+    size_t n = x.size();
+    std::vector<double> ref(n), sca(n), arr(n);
+
+    NanoSecTime t;
+    t.start();
+    for (int r=0; r<repetitions; ++r)
+    {
+        for (size_t i=0; i<n; ++i) ref[i] = reference(x[i]);
+    }
+    t.stop();
+    double tref = nanoSeconds(t)/(n*(double)repetitions);
+
+    t.start();
+    for (int r=0; r<repetitions; ++r)
+    {
+        for (size_t i=0; i<n; ++i) sca[i] = scalar(x[i]);
+    }
+    t.stop();
+    double tsca = nanoSeconds(t)/(n*(double)repetitions);
+
+    t.start();
+    for (int r=0; r<repetitions; ++r)
+    {
+        array(&x[0], &arr[0], n);
+    }
+    t.stop();
+    double tarr = nanoSeconds(t)/(n*(double)repetitions);
+
+    double maxulps = 0.0;
+    for (size_t i=0; i<n; ++i)
+    {
+        // below one compare absolute error, in units of epsilon,
+        // so zeros of the function do not dominate
+        double u = (fabs(ref[i]) < 1.0)
+                 ? fabs(arr[i]-ref[i])/DBL_EPSILON
+                 : ulps(arr[i], ref[i]);
+        if (u > maxulps) maxulps = u;
+    }
+
+    printf("%-16s %10.2f %10.2f %10.2f %8.2fx %10.2f\n",
+           name, tref, tsca, tarr, tref/tarr, maxulps);
+}
+
+int
+main(int argc, char **argv)
+{
+    size_t n = (argc > 1) ? strtoul(argv[1], NULL, 0) : 1<<16;
+    int repetitions = (argc > 2) ? atoi(argv[2]) : 100;
+
+    printf("%zu elements, %d repetitions, nano-seconds per element\n\n",
+           n, repetitions);
+    printf("%-16s %10s %10s %10s %9s %10s\n",
+           "function", "libm", "scalar", "array", "speedup", "max ulps");
+
+    std::vector<double> x(n);
+
+    fillUniform(x, -700.0, 700.0);
+    run("exp", exp, exp, exponential, x, repetitions);
+
+    fillUniform(x, -690.0, 690.0);
+    for (size_t i=0; i<n; ++i) x[i] = exp(x[i]);
+    run("log", log, log, logarithm, x, repetitions);
+
+    fillUniform(x, 0.01, 200.0);
+    run("logGamma", libmLogGamma, ombtLogGamma, logGamma, x, repetitions);
+
+    fillUniform(x, -6.0, 6.0);
+    run("erf", erf, ombtErf, errorFunction, x, repetitions);
+
+    fillUniform(x, -6.0, 26.0);
+    run("erfc", erfc, ombtErfc, errorFunctionC, x, repetitions);
+
+    fillUniform(x, -30.0, 8.0);
+    run("normalCdf", libmNormalCdf, ombtNormalCdf, normalCdf,
+        x, repetitions);
+
+    // no libm quantile, the scalar form is the reference
+    fillUniform(x, 0.0, 1.0);
+    run("normalQuantile", ombtNormalQuantile, ombtNormalQuantile,
+        normalQuantile, x, repetitions);
+
+    return(0);
+}